@@ -0,0 +1,322 @@
+/**
+ * @file batch_search.h
+ * @brief 批量查找：一次处理一组相互独立的查询，交错执行以隐藏内存延迟
+ * @details
+ * `search/` 中的函数每次调用只回答一个键，大表上每一步探测都要等一次缓存未命中，
+ * 而这些等待彼此之间并不相关。这里的批量接口接收一段查询，按查询的顺序写出结果：
+ *
+ * 1. `lower_bound_batch()`：[组预取](https://doi.org/10.1145/1272743.1272747)（group prefetching）。
+ *    无分支二分查找对每个查询都走同样多层，所以一组 kGroupSize 个查询可以按层同步推进：
+ *    每层先为组内每个查询算出下一次要访问的位置并预取，再依次比较，同一时刻有 kGroupSize 个未命中在路上；
+ * 2. `interpolation_search_batch()`：[AMAC](https://www.vldb.org/pvldb/vol9/p252-kocberber.pdf)
+ *    （异步内存访问链）。插值查找的步数因查询而异，无法按层同步，于是为每个查询保存一个小状态机，
+ *    轮流推进：每次推进只做一次探测的比较，算出下一个探测位置后预取并切换到下一个查询，
+ *    某个查询结束后立即在同一个槽位换上新的查询；
+ * 3. `hash_index`：与 `hash搜索.cpp` 一样用链地址法，但链表换成按桶连续存放的数组（CSR 布局），
+ *    `find_batch()` 把一次查找拆成"算哈希并预取桶头"、"读桶头并预取桶内元素"、"扫描桶"三个阶段，
+ *    每个阶段对一组查询执行完再进入下一阶段。
+ *
+ * 精确查找在找不到时返回 npos，与 `插值查找.cpp` 返回 -1 的约定一致。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::max
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint64_t
+#include <type_traits>  /// 用于 std::is_integral
+#include <vector>       /// 用于 std::vector
+
+/// 软件预取（只读），不支持的编译器上为空操作
+#if defined(__GNUC__)
+#define BATCH_SEARCH_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define BATCH_SEARCH_PREFETCH(p) ((void)(p))
+#endif
+
+/**
+ * @namespace search
+ * @brief 搜索算法
+ */
+namespace search {
+/**
+ * @namespace batch
+ * @brief 批量（交错执行的）查找
+ */
+namespace batch {
+constexpr size_t npos = size_t(-1);  ///< 精确查找找不到时的返回值
+constexpr size_t kGroupSize = 16;    ///< 同时在路上的查询个数
+
+/**
+ * @brief 批量 lower_bound（组预取）
+ * @param a 有序数组
+ * @param n 元素个数
+ * @param queries 查询
+ * @param m 查询个数
+ * @param out 输出，out[i] 是第一个不小于 queries[i] 的元素的下标，不存在时为 n
+ */
+template <typename T>
+void lower_bound_batch(const T *a, size_t n, const T *queries, size_t m, size_t *out) {
+    for (size_t g = 0; g < m; g += kGroupSize) {
+        const size_t count = std::min(kGroupSize, m - g);
+        const T *q = queries + g;
+        if (n == 0) {
+            std::fill(out + g, out + g + count, size_t(0));
+            continue;
+        }
+        const T *base[kGroupSize];
+        for (size_t i = 0; i < count; i++) base[i] = a;
+        for (size_t len = n; len > 1;) {
+            size_t half = len / 2;
+            size_t next_half = (len - half) / 2;
+            for (size_t i = 0; i < count; i++) {
+                base[i] += (base[i][half - 1] < q[i]) * half;
+                BATCH_SEARCH_PREFETCH(base[i] + (next_half > 0 ? next_half - 1 : 0));
+            }
+            len -= half;
+        }
+        for (size_t i = 0; i < count; i++) {
+            out[g + i] = size_t(base[i] - a) + (*base[i] < q[i]);
+        }
+    }
+}
+
+/**
+ * @brief 批量 lower_bound（std::vector 版本）
+ */
+template <typename T>
+std::vector<size_t> lower_bound_batch(const std::vector<T> &sorted,
+                                      const std::vector<T> &queries) {
+    std::vector<size_t> out(queries.size());
+    lower_bound_batch(sorted.data(), sorted.size(), queries.data(), queries.size(), out.data());
+    return out;
+}
+
+/**
+ * @brief 插值查找的一步：由 [lo, hi] 估算探测位置
+ * @details 用 double 计算比例，避免 `插值查找.cpp` 中先做整数除法造成的精度损失，
+ * 也避免有符号整数相减溢出。
+ *
+ * 超过 2^53 的 64 位整数转成 double 后可能相等（即使 a[lo] < a[hi]），这时 0/0 得到 NaN，
+ * 而把 NaN 转成 size_t 是未定义行为；所以分母为 0 时直接探测 lo，比例也先截断到 [0, 1]。
+ */
+template <typename T>
+inline size_t interpolate(const T *a, size_t lo, size_t hi, const T &x) {
+    const double low = double(a[lo]), high = double(a[hi]);
+    if (!(low < high)) {
+        return lo;
+    }
+    double ratio = (double(x) - low) / (high - low);
+    ratio = std::min(std::max(ratio, 0.0), 1.0);
+    size_t pos = lo + size_t(ratio * double(hi - lo));
+    return std::min(pos, hi);
+}
+
+/**
+ * @brief 插值查找一个键（逐个查询的版本，作为批量版本的对照）
+ * @returns 等于 x 的某个元素的下标，不存在时为 npos
+ */
+template <typename T>
+size_t interpolation_search(const T *a, size_t n, const T &x) {
+    if (n == 0 || x < a[0] || a[n - 1] < x) {
+        return npos;
+    }
+    size_t lo = 0, hi = n - 1;
+    while (a[lo] < a[hi]) {
+        size_t pos = interpolate(a, lo, hi, x);
+        if (a[pos] == x) {
+            return pos;
+        }
+        if (a[pos] < x) {
+            lo = pos + 1;
+        } else {
+            hi = pos - 1;
+        }
+        if (x < a[lo] || a[hi] < x) {
+            return npos;
+        }
+    }
+    return a[lo] == x ? lo : npos;
+}
+
+/**
+ * @brief 批量插值查找（AMAC）
+ * @tparam T 算术类型
+ * @param a 有序数组
+ * @param n 元素个数
+ * @param queries 查询
+ * @param m 查询个数
+ * @param out 输出，out[i] 是等于 queries[i] 的某个元素的下标，不存在时为 npos
+ */
+template <typename T>
+void interpolation_search_batch(const T *a, size_t n, const T *queries, size_t m,
+                                size_t *out) {
+    struct state {
+        size_t query;  // 查询编号，npos 表示空槽
+        size_t lo, hi, pos;  // 当前区间 [lo, hi] 与已经预取、等待比较的位置 pos
+    };
+    state slots[kGroupSize];
+    size_t next = 0;
+
+    // 为槽位换上下一个查询；区间为空或查询落在区间外时直接得出结果
+    auto refill = [&](state &s) {
+        while (next < m) {
+            size_t qi = next++;
+            const T &x = queries[qi];
+            if (n == 0 || x < a[0] || a[n - 1] < x) {
+                out[qi] = npos;
+                continue;
+            }
+            s = {qi, 0, n - 1, n == 1 ? 0 : interpolate(a, 0, n - 1, x)};
+            BATCH_SEARCH_PREFETCH(a + s.pos);
+            return;
+        }
+        s.query = npos;
+    };
+
+    size_t active = 0;
+    for (auto &s : slots) {
+        refill(s);
+        active += s.query != npos;
+    }
+    while (active > 0) {
+        for (auto &s : slots) {
+            if (s.query == npos) continue;
+            const T &x = queries[s.query];
+            bool done = false;
+            if (a[s.pos] == x) {
+                out[s.query] = s.pos;
+                done = true;
+            } else if (a[s.pos] < x ? s.pos == s.hi : s.pos == s.lo) {
+                out[s.query] = npos;  // x 应在的一侧已经没有元素
+                done = true;
+            } else {
+                if (a[s.pos] < x) {
+                    s.lo = s.pos + 1;
+                } else {
+                    s.hi = s.pos - 1;
+                }
+                if (x < a[s.lo] || a[s.hi] < x) {
+                    out[s.query] = npos;
+                    done = true;
+                } else if (!(a[s.lo] < a[s.hi])) {
+                    s.pos = s.lo;  // 区间内所有值相等，下一次比较即可得出结果
+                } else {
+                    s.pos = interpolate(a, s.lo, s.hi, x);
+                }
+            }
+            if (done) {
+                refill(s);
+                active -= s.query == npos;
+            } else {
+                BATCH_SEARCH_PREFETCH(a + s.pos);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 批量插值查找（std::vector 版本）
+ */
+template <typename T>
+std::vector<size_t> interpolation_search_batch(const std::vector<T> &sorted,
+                                               const std::vector<T> &queries) {
+    std::vector<size_t> out(queries.size());
+    interpolation_search_batch(sorted.data(), sorted.size(), queries.data(), queries.size(),
+                               out.data());
+    return out;
+}
+
+/**
+ * @brief 链地址法的静态哈希索引（CSR 布局），支持批量查找
+ * @details 桶数取不小于元素个数的 2 的幂，哈希函数为斐波那契乘法哈希（取乘积的高位），
+ * 比 `hash搜索.cpp` 的除法取余更快，并且对规律的键分布更均匀。
+ * 同一个键出现多次时，返回最先出现的位置。
+ * @tparam K 整数键类型
+ */
+template <typename K>
+class hash_index {
+    static_assert(std::is_integral<K>::value, "键必须是整数");
+
+ public:
+    /**
+     * @param keys 要建立索引的键，查找结果是键在这个数组中的下标
+     */
+    explicit hash_index(const std::vector<K> &keys) {
+        bits_ = 0;
+        while ((size_t(1) << bits_) < keys.size()) bits_++;
+        size_t buckets = size_t(1) << bits_;
+        offsets_.assign(buckets + 1, 0);
+        for (const K &k : keys) offsets_[bucket(k) + 1]++;
+        for (size_t b = 0; b < buckets; b++) offsets_[b + 1] += offsets_[b];
+        slots_.resize(keys.size());
+        std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+        for (size_t i = 0; i < keys.size(); i++) {
+            slots_[fill[bucket(keys[i])]++] = {keys[i], i};
+        }
+    }
+
+    /**
+     * @brief 查找一个键
+     * @returns 键在构建时数组中的下标，不存在时为 npos
+     */
+    size_t find(const K &key) const {
+        size_t b = bucket(key);
+        for (size_t s = offsets_[b]; s < offsets_[b + 1]; s++) {
+            if (slots_[s].key == key) return slots_[s].position;
+        }
+        return npos;
+    }
+
+    /**
+     * @brief 批量查找（组预取），out[i] 对应 queries[i]
+     */
+    void find_batch(const K *queries, size_t m, size_t *out) const {
+        size_t b[kGroupSize];
+        for (size_t g = 0; g < m; g += kGroupSize) {
+            const size_t count = std::min(kGroupSize, m - g);
+            const K *q = queries + g;
+            for (size_t i = 0; i < count; i++) {
+                b[i] = bucket(q[i]);
+                BATCH_SEARCH_PREFETCH(&offsets_[b[i]]);
+            }
+            for (size_t i = 0; i < count; i++) {
+                BATCH_SEARCH_PREFETCH(slots_.data() + offsets_[b[i]]);
+            }
+            for (size_t i = 0; i < count; i++) {
+                size_t result = npos;
+                for (size_t s = offsets_[b[i]]; s < offsets_[b[i] + 1]; s++) {
+                    if (slots_[s].key == q[i]) {
+                        result = slots_[s].position;
+                        break;
+                    }
+                }
+                out[g + i] = result;
+            }
+        }
+    }
+
+    /**
+     * @brief 批量查找（std::vector 版本）
+     */
+    std::vector<size_t> find_batch(const std::vector<K> &queries) const {
+        std::vector<size_t> out(queries.size());
+        find_batch(queries.data(), queries.size(), out.data());
+        return out;
+    }
+
+ private:
+    struct slot {
+        K key;
+        size_t position;
+    };
+    unsigned bits_;
+    std::vector<size_t> offsets_;  ///< 桶 b 的元素位于 slots_[offsets_[b], offsets_[b + 1])
+    std::vector<slot> slots_;
+
+    size_t bucket(const K &key) const {
+        if (bits_ == 0) return 0;
+        return size_t((uint64_t(key) * 0x9E3779B97F4A7C15ull) >> (64 - bits_));
+    }
+};
+}  // namespace batch
+}  // namespace search
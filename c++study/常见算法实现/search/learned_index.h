@@ -0,0 +1,254 @@
+/**
+ * @file learned_index.h
+ * @brief 学习索引：[PGM 索引](https://pgm.di.unipi.it/)式的分段线性模型
+ * @details
+ * `插值查找.cpp` 用一条直线（首尾两个元素连线）预测键的位置，只在键均匀分布时有效，
+ * 对偏斜的分布（对数正态、带突发的时间戳等）会退化到 \f$O(n)\f$ 次探测。
+ * 学习索引把"键 → 在有序数组中的位置"这个函数用若干段直线近似，每段保证误差不超过 ε：
+ *
+ * 1. 构建：按键的顺序扫描，维护当前段所有可行斜率组成的"锥"（shrinking cone），
+ *    加入一个点后锥为空就结束当前段、从这个点开始新段，\f$O(n)\f$ 时间；
+ * 2. 递归：各段的第一个键本身也是有序数组，用同样的方法（误差 ε_r）再建一层，直到只剩一段；
+ * 3. 查找：从顶层往下，每层用模型预测位置，只在预测位置附近 \f$2\varepsilon + 3\f$ 个元素内二分，
+ *    最底层的窗口在原数组上，用 `static_search.h` 的无分支二分完成"最后一公里"。
+ *
+ * 对有重复键的数组，每段重复键的末尾额外加一个点（键的后继 → 这段之后的位置），
+ * 保证查询落在两个相邻键之间时预测误差同样有界。
+ *
+ * 查找返回与 std::lower_bound 相同的位置（第一个不小于 x 的元素的下标），结果是精确的；
+ * 模型只占 `memory_bytes()` 字节，通常远小于键本身。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::max, std::upper_bound
+#include <cmath>        /// 用于 std::nextafter
+#include <cstddef>      /// 用于 size_t
+#include <limits>       /// 用于 std::numeric_limits
+#include <type_traits>  /// 用于 std::is_integral, std::make_unsigned
+#include <vector>       /// 用于 std::vector
+
+#include "./static_search.h"
+
+/**
+ * @namespace search
+ * @brief 搜索算法
+ */
+namespace search {
+/**
+ * @namespace learned_index
+ * @brief 学习索引
+ */
+namespace learned_index {
+
+/**
+ * @brief b - a（要求 a <= b），整数键用无符号减法，跨越整个值域时也不会溢出
+ */
+template <typename K>
+inline double key_distance(const K &a, const K &b) {
+    if constexpr (std::is_integral<K>::value) {
+        using U = typename std::make_unsigned<K>::type;
+        return double(U(U(b) - U(a)));
+    } else {
+        return double(b) - double(a);
+    }
+}
+
+/**
+ * @brief 比 k 大的最小的键，k 已经是最大值时返回 false
+ */
+template <typename K>
+inline bool key_successor(const K &k, K *next) {
+    if (k == std::numeric_limits<K>::max()) {
+        return false;
+    }
+    if constexpr (std::is_integral<K>::value) {
+        *next = k + 1;
+    } else {
+        *next = std::nextafter(k, std::numeric_limits<K>::max());
+    }
+    return true;
+}
+
+/**
+ * @brief 一段线性模型：键 x（x >= key）的预测位置为 intercept + slope * (x - key)
+ */
+template <typename K>
+struct segment {
+    K key;             ///< 这一段的第一个键
+    double slope;      ///< 斜率
+    size_t intercept;  ///< 第一个键的位置
+};
+
+/**
+ * @brief 用收缩锥算法把点列 (x, y)（x 严格递增，y 不减）切分成误差不超过 epsilon 的线段
+ */
+template <typename K>
+class segmenter {
+ public:
+    explicit segmenter(size_t epsilon) : epsilon_(double(epsilon)) {}
+
+    /** @brief 加入一个点，x 必须大于之前所有点 */
+    void add(const K &x, size_t y) {
+        if (!open_) {
+            start(x, y);
+            return;
+        }
+        double dx = key_distance(first_.key, x);
+        double dy = double(y) - double(first_.intercept);
+        double lo = std::max(slope_lo_, (dy - epsilon_) / dx);
+        double hi = std::min(slope_hi_, (dy + epsilon_) / dx);
+        if (lo > hi) {
+            close();
+            start(x, y);
+        } else {
+            slope_lo_ = lo;
+            slope_hi_ = hi;
+        }
+    }
+
+    /** @brief 结束最后一段，返回所有线段 */
+    std::vector<segment<K>> finish() {
+        if (open_) {
+            close();
+        }
+        return std::move(segments_);
+    }
+
+ private:
+    double epsilon_;
+    bool open_ = false;
+    segment<K> first_{};
+    double slope_lo_ = 0, slope_hi_ = 0;
+    std::vector<segment<K>> segments_;
+
+    void start(const K &x, size_t y) {
+        first_ = {x, 0.0, y};
+        slope_lo_ = 0;
+        slope_hi_ = std::numeric_limits<double>::infinity();
+        open_ = true;
+    }
+
+    void close() {
+        // 只有一个点时斜率无关紧要
+        first_.slope = slope_hi_ == std::numeric_limits<double>::infinity()
+                           ? 0.0
+                           : (slope_lo_ + slope_hi_) / 2;
+        segments_.push_back(first_);
+        open_ = false;
+    }
+};
+
+/**
+ * @brief PGM 式的多层分段线性学习索引
+ * @tparam K 算术类型的键
+ */
+template <typename K>
+class pgm_index {
+    static_assert(std::is_arithmetic<K>::value, "键必须是算术类型");
+
+ public:
+    /**
+     * @param sorted 有序数组（可以有重复）
+     * @param epsilon 最底层模型的最大误差，决定最后一公里查找的窗口大小
+     * @param epsilon_recursive 上层模型的最大误差
+     */
+    explicit pgm_index(const std::vector<K> &sorted, size_t epsilon = 64,
+                       size_t epsilon_recursive = 4)
+        : keys_(sorted), epsilon_(epsilon), epsilon_recursive_(epsilon_recursive) {
+        if (keys_.empty()) {
+            return;
+        }
+        segmenter<K> bottom(epsilon_);
+        for (size_t i = 0; i < keys_.size();) {
+            size_t j = i + 1;
+            while (j < keys_.size() && keys_[j] == keys_[i]) j++;
+            bottom.add(keys_[i], i);
+            // 一段重复键之后、下一个键之前的查询都应该落在 j
+            K next;
+            if (j - i > 1 && key_successor(keys_[i], &next) &&
+                (j == keys_.size() || next < keys_[j])) {
+                bottom.add(next, j);
+            }
+            i = j;
+        }
+        levels_.push_back(bottom.finish());
+        while (levels_.back().size() > 1) {
+            const auto &below = levels_.back();
+            segmenter<K> upper(epsilon_recursive_);
+            for (size_t i = 0; i < below.size(); i++) upper.add(below[i].key, i);
+            levels_.push_back(upper.finish());
+        }
+    }
+
+    /** @brief 元素个数 */
+    size_t size() const { return keys_.size(); }
+
+    /** @brief 层数 */
+    size_t height() const { return levels_.size(); }
+
+    /** @brief 最底层的段数 */
+    size_t segment_count() const { return levels_.empty() ? 0 : levels_[0].size(); }
+
+    /** @brief 模型（所有层的线段）占用的字节数，不含键本身 */
+    size_t memory_bytes() const {
+        size_t bytes = 0;
+        for (const auto &level : levels_) bytes += level.size() * sizeof(segment<K>);
+        return bytes;
+    }
+
+    /**
+     * @brief 第一个不小于 x 的元素的下标，不存在时返回 size()
+     */
+    size_t lower_bound(const K &x) const {
+        if (keys_.empty()) {
+            return 0;
+        }
+        size_t seg = 0;
+        for (size_t level = levels_.size() - 1; level > 0; level--) {
+            const auto &below = levels_[level - 1];
+            size_t lo, hi;
+            window(levels_[level], seg, x, below.size(), epsilon_recursive_, &lo, &hi);
+            // 最后一个第一个键不大于 x 的段，x 比所有键都小时取第 0 段
+            auto it = std::upper_bound(below.begin() + lo, below.begin() + hi, x,
+                                       [](const K &v, const segment<K> &s) { return v < s.key; });
+            seg = it == below.begin() ? 0 : size_t(it - below.begin()) - 1;
+        }
+        size_t lo, hi;
+        window(levels_[0], seg, x, keys_.size(), epsilon_, &lo, &hi);
+        return lo + static_search::branchless_lower_bound(keys_.data() + lo, hi - lo, x);
+    }
+
+    /**
+     * @brief 精确查找
+     * @returns 第一个等于 x 的元素的下标，不存在时返回 -1（即 size_t 的最大值）
+     */
+    size_t find(const K &x) const {
+        size_t pos = lower_bound(x);
+        return pos < keys_.size() && keys_[pos] == x ? pos : size_t(-1);
+    }
+
+ private:
+    std::vector<K> keys_;
+    size_t epsilon_, epsilon_recursive_;
+    std::vector<std::vector<segment<K>>> levels_;  ///< levels_[0] 预测 keys_ 中的位置
+
+    /**
+     * @brief 用 level 中第 seg 段预测 x 的位置，得到答案所在的窗口 [lo, hi)
+     * @details 预测值夹在本段第一个键的位置与下一段第一个键的位置之间，
+     * 所以跨段的查询也满足误差界；窗口两侧各多留 1 个位置，抵消浮点舍入和相邻键之间的查询。
+     */
+    static void window(const std::vector<segment<K>> &level, size_t seg, const K &x, size_t n,
+                       size_t epsilon, size_t *lo, size_t *hi) {
+        const segment<K> &s = level[seg];
+        size_t end = seg + 1 < level.size() ? level[seg + 1].intercept : n;
+        size_t pos = s.intercept;
+        if (s.key < x) {
+            double predicted = double(s.intercept) + s.slope * key_distance(s.key, x);
+            pos = predicted >= double(end) ? end : std::max(s.intercept, size_t(predicted));
+        }
+        *lo = pos > epsilon + 1 ? pos - epsilon - 1 : 0;
+        *hi = std::min(n, pos + epsilon + 2);
+    }
+};
+}  // namespace learned_index
+}  // namespace search
@@ -0,0 +1,394 @@
+/**
+ * @file selection.h
+ * @brief 原地线性时间选择：内省选择（introselect）、Floyd–Rivest 选择、多分位数与并行分位数
+ * @details
+ * `中位数查找.cpp` 的 `median_of_medians` 每层递归都复制子数组，还要求元素互不相同。
+ * 这里的函数都在原数组上工作，语义与 std::nth_element 相同：返回后 a[k] 是第 k 小（从 0 开始）的元素，
+ * a[0, k) 都不大于它，a(k, n) 都不小于它。
+ *
+ * 1. `median_of_medians_select()`：五个一组取中位数，中位数交换到数组前部后递归选出基准，
+ *    三路分区后等于基准的元素一次排除，最坏 \f$O(n)\f$，但常数大，只作为兜底；
+ * 2. `introselect()`：三数取中（大区间 ninther）的快速选择，Hoare 分区在等于基准的元素处两侧都停下，
+ *    大量重复值的延迟数据上仍然平分；迭代次数超过 2*log2(n) 时改用中位数的中位数，保证最坏 \f$O(n)\f$；
+ * 3. `floyd_rivest_select()`：[Floyd–Rivest](https://doi.org/10.1145/360680.360694) 算法，
+ *    先在一个 \f$O(n^{2/3})\f$ 的子区间上递归选出两个紧贴第 k 小的基准，
+ *    期望比较次数 \f$n + \min(k, n - k) + o(n)\f$；
+ * 4. `quantiles()`：一次调用求多个分位数（如 p50/p90/p99/p999）。先选中间的秩，
+ *    再只在左右两半里分别处理更小/更大的秩，总时间 \f$O(n \log q)\f$；
+ * 5. `quantiles_parallel()`：不修改输入。先抽样排序，为每个秩在样本中取一个包含它的窄区间，
+ *    多线程一遍扫描统计落在区间下方的元素个数并收集区间内的候选，最后只在候选上做选择；
+ *    区间没有包住目标秩（概率极小）时退回顺序版本。
+ *
+ * 分位数 q 对应的秩采用最近秩法：\f$\lceil q n \rceil - 1\f$，限制在 [0, n-1] 内。
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::min, std::max, std::sort
+#include <cmath>       /// 用于 std::ceil, std::exp, std::log, std::sqrt
+#include <cstddef>     /// 用于 size_t, ptrdiff_t
+#include <cstdint>     /// 用于 uint64_t
+#include <functional>  /// 用于 std::less
+#include <random>      /// 用于 std::mt19937_64
+#include <utility>     /// 用于 std::swap, std::pair
+#include <vector>      /// 用于 std::vector
+
+#include "../sorting/parallel_merge_sort.h"
+
+/**
+ * @namespace search
+ * @brief 搜索算法
+ */
+namespace search {
+/**
+ * @namespace selection
+ * @brief 选择（第 k 小元素与分位数）算法
+ */
+namespace selection {
+constexpr size_t kInsertionThreshold = 16;      ///< 不超过这个长度的区间直接插入排序
+constexpr size_t kFloydRivestSample = 600;      ///< Floyd–Rivest 超过这个长度才抽样
+constexpr size_t kParallelThreshold = 1 << 20;  ///< 并行分位数的最小规模
+constexpr size_t kParallelSample = 1 << 16;     ///< 并行分位数的样本大小
+
+/**
+ * @brief 插入排序（小区间）
+ */
+template <typename T, typename Compare>
+void insertion_sort(T *a, size_t n, Compare comp) {
+    for (size_t i = 1; i < n; i++) {
+        T x = std::move(a[i]);
+        size_t j = i;
+        for (; j > 0 && comp(x, a[j - 1]); j--) a[j] = std::move(a[j - 1]);
+        a[j] = std::move(x);
+    }
+}
+
+/**
+ * @brief 三路分区（Dijkstra）：按与 pivot 的关系把 a 分成小于、等于、大于三段
+ * @returns 等于 pivot 的一段 [first, second)
+ */
+template <typename T, typename Compare>
+std::pair<size_t, size_t> partition3(T *a, size_t n, const T &pivot, Compare comp) {
+    size_t lt = 0, i = 0, gt = n;
+    while (i < gt) {
+        if (comp(a[i], pivot)) {
+            std::swap(a[lt++], a[i++]);
+        } else if (comp(pivot, a[i])) {
+            std::swap(a[i], a[--gt]);
+        } else {
+            i++;
+        }
+    }
+    return {lt, gt};
+}
+
+template <typename T, typename Compare>
+void median_of_medians_select(T *a, size_t n, size_t k, Compare comp);
+
+/**
+ * @brief 中位数的中位数：返回的基准保证两侧至少各有约 3n/10 个元素
+ * @details 每组 5 个元素插入排序后，把中位数交换到数组前部，再对这些中位数递归选择。
+ */
+template <typename T, typename Compare>
+T median_of_medians_pivot(T *a, size_t n, Compare comp) {
+    size_t groups = 0;
+    for (size_t i = 0; i < n; i += 5) {
+        size_t len = std::min<size_t>(5, n - i);
+        insertion_sort(a + i, len, comp);
+        std::swap(a[groups++], a[i + len / 2]);
+    }
+    median_of_medians_select(a, groups, groups / 2, comp);
+    return a[groups / 2];
+}
+
+/**
+ * @brief 最坏线性时间的选择（BFPRT），作为 introselect 的兜底
+ * @param a 数组
+ * @param n 元素个数
+ * @param k 要选的秩（从 0 开始）
+ * @param comp 比较函数
+ */
+template <typename T, typename Compare>
+void median_of_medians_select(T *a, size_t n, size_t k, Compare comp) {
+    while (n > kInsertionThreshold) {
+        T pivot = median_of_medians_pivot(a, n, comp);
+        auto eq = partition3(a, n, pivot, comp);
+        if (k < eq.first) {
+            n = eq.first;
+        } else if (k >= eq.second) {
+            a += eq.second;
+            n -= eq.second;
+            k -= eq.second;
+        } else {
+            return;
+        }
+    }
+    insertion_sort(a, n, comp);
+}
+
+/**
+ * @brief 返回 a[i]、a[j]、a[l] 中位数的下标
+ */
+template <typename T, typename Compare>
+size_t median3(const T *a, size_t i, size_t j, size_t l, Compare comp) {
+    if (comp(a[j], a[i])) std::swap(i, j);
+    if (comp(a[l], a[j])) {
+        j = comp(a[l], a[i]) ? i : l;
+    }
+    return j;
+}
+
+/**
+ * @brief Hoare 分区：以 a[p] 为基准，遇到等于基准的元素两侧都停下并交换
+ * @details 大量重复值时两侧仍然大致平分，不会退化。
+ * @returns 基准的最终位置 j，a[0, j) 不大于基准，a(j, n) 不小于基准
+ */
+template <typename T, typename Compare>
+size_t hoare_partition(T *a, size_t n, size_t p, Compare comp) {
+    std::swap(a[0], a[p]);
+    const T &pivot = a[0];
+    size_t i = 0, j = n;
+    for (;;) {
+        do {
+            i++;
+        } while (i < n && comp(a[i], pivot));
+        do {
+            j--;
+        } while (comp(pivot, a[j]));  // a[0] 是哨兵
+        if (i >= j) {
+            break;
+        }
+        std::swap(a[i], a[j]);
+    }
+    std::swap(a[0], a[j]);
+    return j;
+}
+
+/**
+ * @brief 内省选择：快速选择 + 中位数的中位数兜底
+ * @param a 数组
+ * @param n 元素个数
+ * @param k 要选的秩（从 0 开始），必须小于 n
+ * @param comp 比较函数
+ */
+template <typename T, typename Compare = std::less<T>>
+void introselect(T *a, size_t n, size_t k, Compare comp = Compare()) {
+    size_t budget = 0;
+    for (size_t m = n; m > 1; m >>= 1) budget += 2;
+    while (n > kInsertionThreshold) {
+        if (budget-- == 0) {
+            median_of_medians_select(a, n, k, comp);
+            return;
+        }
+        size_t p;
+        if (n < 128) {
+            p = median3(a, 0, n / 2, n - 1, comp);
+        } else {
+            size_t s = n / 8;
+            p = median3(a, median3(a, 0, s, 2 * s, comp),
+                        median3(a, n / 2 - s, n / 2, n / 2 + s, comp),
+                        median3(a, n - 1 - 2 * s, n - 1 - s, n - 1, comp), comp);
+        }
+        size_t j = hoare_partition(a, n, p, comp);
+        if (k < j) {
+            n = j;
+        } else if (k > j) {
+            a += j + 1;
+            n -= j + 1;
+            k -= j + 1;
+        } else {
+            return;
+        }
+    }
+    insertion_sort(a, n, comp);
+}
+
+/**
+ * @brief Floyd–Rivest 选择
+ * @param a 数组
+ * @param n 元素个数
+ * @param k 要选的秩（从 0 开始），必须小于 n
+ * @param comp 比较函数
+ */
+template <typename T, typename Compare = std::less<T>>
+void floyd_rivest_select(T *a, size_t n, size_t k, Compare comp = Compare()) {
+    ptrdiff_t left = 0, right = ptrdiff_t(n) - 1, kk = ptrdiff_t(k);
+    while (right > left) {
+        if (size_t(right - left) > kFloydRivestSample) {
+            // 在以 k 为中心、按比例缩小的子区间上递归，使 a[k] 成为两个紧贴第 k 小的基准之一
+            double m = double(right - left + 1);
+            double i = double(kk - left + 1);
+            double z = std::log(m);
+            double s = 0.5 * std::exp(2 * z / 3);
+            double sd = 0.5 * std::sqrt(z * s * (m - s) / m) * (i < m / 2 ? -1 : 1);
+            ptrdiff_t lo = std::max(left, ptrdiff_t(double(kk) - i * s / m + sd));
+            ptrdiff_t hi = std::min(right, ptrdiff_t(double(kk) + (m - i) * s / m + sd));
+            floyd_rivest_select(a + lo, size_t(hi - lo + 1), size_t(kk - lo), comp);
+        }
+        // 以 a[k] 为基准做 Hoare 分区，基准先放在 left，必要时与 right 交换作为哨兵
+        T t = a[kk];
+        ptrdiff_t i = left, j = right;
+        std::swap(a[left], a[kk]);
+        if (comp(t, a[right])) std::swap(a[right], a[left]);
+        while (i < j) {
+            std::swap(a[i], a[j]);
+            i++;
+            j--;
+            while (comp(a[i], t)) i++;
+            while (comp(t, a[j])) j--;
+        }
+        if (!comp(a[left], t) && !comp(t, a[left])) {
+            std::swap(a[left], a[j]);
+        } else {
+            j++;
+            std::swap(a[j], a[right]);
+        }
+        if (j <= kk) left = j + 1;
+        if (kk <= j) right = j - 1;
+    }
+}
+
+/**
+ * @brief 分位数 q 在 n 个元素中的秩（最近秩法）
+ */
+inline size_t quantile_rank(size_t n, double q) {
+    double r = std::ceil(q * double(n)) - 1;
+    if (r <= 0) return 0;
+    return std::min(n - 1, size_t(r));
+}
+
+/**
+ * @brief 多重选择：ranks 是有序、互不相同的 count 个秩（相对于 a）
+ * @details 先选中间的秩 k，之后左侧的秩只需在 a[0, k) 中选，右侧的秩只需在 a(k, n) 中选。
+ */
+template <typename T, typename Compare>
+void multi_select(T *a, size_t n, const size_t *ranks, size_t count, Compare comp) {
+    if (count == 0) {
+        return;
+    }
+    size_t mid = count / 2;
+    size_t k = ranks[mid];
+    introselect(a, n, k, comp);
+    multi_select(a, k, ranks, mid, comp);
+    std::vector<size_t> right(ranks + mid + 1, ranks + count);
+    for (auto &r : right) r -= k + 1;
+    multi_select(a + k + 1, n - k - 1, right.data(), right.size(), comp);
+}
+
+/**
+ * @brief 一次求多个分位数（原地，会重排数组）
+ * @param a 数组
+ * @param n 元素个数，必须大于 0
+ * @param qs 分位数，取值 [0, 1]，例如 {0.5, 0.9, 0.99, 0.999}
+ * @param comp 比较函数
+ * @returns 与 qs 一一对应的分位数值
+ */
+template <typename T, typename Compare = std::less<T>>
+std::vector<T> quantiles(T *a, size_t n, const std::vector<double> &qs,
+                         Compare comp = Compare()) {
+    std::vector<size_t> ranks;
+    for (double q : qs) ranks.push_back(quantile_rank(n, q));
+    std::vector<size_t> sorted = ranks;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    multi_select(a, n, sorted.data(), sorted.size(), comp);
+    std::vector<T> result;
+    for (size_t r : ranks) result.push_back(a[r]);
+    return result;
+}
+
+/**
+ * @brief 一次求多个分位数（std::vector 版本，会重排数组）
+ */
+template <typename T, typename Compare = std::less<T>>
+std::vector<T> quantiles(std::vector<T> *data, const std::vector<double> &qs,
+                         Compare comp = Compare()) {
+    return quantiles(data->data(), data->size(), qs, comp);
+}
+
+/**
+ * @brief 并行求多个分位数，不修改输入
+ * @param a 数组
+ * @param n 元素个数，必须大于 0
+ * @param qs 分位数，取值 [0, 1]
+ * @param num_threads 线程数
+ * @param comp 比较函数
+ * @returns 与 qs 一一对应的分位数值，与 quantiles() 的结果相同
+ */
+template <typename T, typename Compare = std::less<T>>
+std::vector<T> quantiles_parallel(const T *a, size_t n, const std::vector<double> &qs,
+                                  size_t num_threads, Compare comp = Compare()) {
+    if (n < kParallelThreshold || num_threads <= 1) {
+        std::vector<T> copy(a, a + n);
+        return quantiles(copy.data(), n, qs, comp);
+    }
+
+    // 抽样并排序，为每个秩在样本中取一个约 ±3 个标准差宽的区间 [lo, hi]
+    std::mt19937_64 rng(n);
+    std::vector<T> sample(kParallelSample);
+    for (auto &x : sample) x = a[rng() % n];
+    std::sort(sample.begin(), sample.end(), comp);
+    struct bracket {
+        size_t rank;
+        bool has_lo, has_hi;
+        T lo, hi;
+    };
+    const double s = double(kParallelSample);
+    const double d = 3 * std::sqrt(s);
+    std::vector<bracket> brackets;
+    for (double q : qs) {
+        bracket b;
+        b.rank = quantile_rank(n, q);
+        double pos = double(b.rank) / double(n) * s;
+        b.has_lo = pos - d >= 0;
+        b.has_hi = pos + d < s;
+        b.lo = b.has_lo ? sample[size_t(pos - d)] : T();
+        b.hi = b.has_hi ? sample[size_t(pos + d)] : T();
+        brackets.push_back(b);
+    }
+
+    // 一遍扫描：每块统计落在各区间下方的元素个数，并收集各区间内的元素
+    const size_t q = brackets.size();
+    const size_t num_chunks = num_threads * 4;
+    const size_t chunk = (n + num_chunks - 1) / num_chunks;
+    std::vector<std::vector<size_t>> below(num_chunks, std::vector<size_t>(q, 0));
+    std::vector<std::vector<std::vector<T>>> candidates(num_chunks,
+                                                        std::vector<std::vector<T>>(q));
+    sorting::parallel_merge_sort::parallel_for(num_chunks, num_threads, [&](size_t c) {
+        const size_t begin = c * chunk, end = std::min(n, begin + chunk);
+        for (size_t i = begin; i < end; i++) {
+            const T &x = a[i];
+            for (size_t j = 0; j < q; j++) {
+                const bracket &b = brackets[j];
+                if (b.has_lo && comp(x, b.lo)) {
+                    below[c][j]++;
+                } else if (!b.has_hi || !comp(b.hi, x)) {
+                    candidates[c][j].push_back(x);
+                }
+            }
+        }
+    });
+
+    std::vector<T> result;
+    for (size_t j = 0; j < q; j++) {
+        size_t count_below = 0;
+        std::vector<T> merged;
+        for (size_t c = 0; c < num_chunks; c++) {
+            count_below += below[c][j];
+            merged.insert(merged.end(), candidates[c][j].begin(), candidates[c][j].end());
+            std::vector<T>().swap(candidates[c][j]);
+        }
+        size_t rank = brackets[j].rank;
+        if (rank < count_below || rank - count_below >= merged.size()) {
+            // 样本区间没有包住目标秩，退回到顺序选择
+            std::vector<T> copy(a, a + n);
+            introselect(copy.data(), n, rank, comp);
+            result.push_back(copy[rank]);
+            continue;
+        }
+        introselect(merged.data(), merged.size(), rank - count_below, comp);
+        result.push_back(merged[rank - count_below]);
+    }
+    return result;
+}
+}  // namespace selection
+}  // namespace search
@@ -0,0 +1,275 @@
+/**
+ * @file static_search.h
+ * @brief 由有序数组构建的静态查找索引：[Eytzinger](https://algorithmica.org/en/eytzinger) 布局与
+ * [S-tree](https://algorithmica.org/en/s-tree)（静态 B 树）布局
+ * @details
+ * `插值查找.cpp`、`jump查找.cpp` 和 `斐波那契数列搜索.cpp` 都直接在有序数组上探测，
+ * 表很大时二分查找前面的每一层都落在不同的缓存行上，每层一次缓存未命中。这里提供三种 lower_bound：
+ *
+ * 1. `branchless_lower_bound()`：在原数组上做无分支二分查找（`base += (base[half - 1] < x) * half`，
+ *    编译成条件传送），并预取下一层的两个候选位置；
+ * 2. `eytzinger_index`：把数组按 BFS 顺序重排，结点 k 的孩子是 2k 和 2k+1。前几层挤在同一批缓存行里，
+ *    并且一个 64 字节缓存行正好包含结点 k 往下第 log2(64 / sizeof(T)) 层的全部后代，
+ *    所以每层预取 `k * (64 / sizeof(T))` 就能把内存延迟提前几层发出去；
+ * 3. `s_tree_index`：每个结点存 B = 16 个有序的键（int32 正好一个缓存行），有 B + 1 个孩子，
+ *    树高只有 \f$\log_{17} n\f$。结点内用"比 x 小的键的个数"作为下标，无分支；
+ *    定义了 `__AVX2__` 时 int32 键用两次 256 位比较加 popcount 完成，否则是可以自动向量化的标量循环。
+ *
+ * 所有 lower_bound 都返回原有序数组中第一个不小于 x 的元素的下标，不存在时返回 n。
+ * 构建时间 \f$O(n)\f$，索引额外保存每个位置对应的原下标。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::max
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 int32_t, uint32_t
+#include <limits>       /// 用于 std::numeric_limits
+#include <memory>       /// 用于 std::unique_ptr
+#include <new>          /// 用于 std::align_val_t
+#include <type_traits>  /// 用于 std::is_trivially_copyable
+#include <vector>       /// 用于 std::vector
+
+#if defined(__AVX2__)
+#include <immintrin.h>  /// 用于 AVX2 指令
+#endif
+
+/// 软件预取（只读、保留在所有缓存层级），不支持的编译器上为空操作
+#if defined(__GNUC__)
+#define STATIC_SEARCH_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define STATIC_SEARCH_PREFETCH(p) ((void)(p))
+#endif
+
+/**
+ * @namespace search
+ * @brief 搜索算法
+ */
+namespace search {
+/**
+ * @namespace static_search
+ * @brief 静态查找索引
+ */
+namespace static_search {
+constexpr size_t kCacheLine = 64;  ///< 缓存行大小（字节）
+
+/**
+ * @brief 按缓存行对齐的数组（只用于可平凡复制的键类型，不调用构造函数）
+ */
+template <typename T>
+class aligned_array {
+    static_assert(std::is_trivially_copyable<T>::value, "键类型必须可平凡复制");
+
+ public:
+    aligned_array() = default;
+    explicit aligned_array(size_t n)
+        : data_(static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(kCacheLine)))),
+          size_(n) {}
+
+    T &operator[](size_t i) { return data_.get()[i]; }
+    const T &operator[](size_t i) const { return data_.get()[i]; }
+    T *data() { return data_.get(); }
+    const T *data() const { return data_.get(); }
+    size_t size() const { return size_; }
+
+ private:
+    struct deleter {
+        void operator()(T *p) const { ::operator delete(p, std::align_val_t(kCacheLine)); }
+    };
+    std::unique_ptr<T, deleter> data_;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief 有序数组上的无分支 lower_bound
+ * @param a 有序数组
+ * @param n 元素个数
+ * @param x 要查找的值
+ * @returns 第一个不小于 x 的元素的下标，不存在时返回 n
+ */
+template <typename T>
+size_t branchless_lower_bound(const T *a, size_t n, const T &x) {
+    if (n == 0) {
+        return 0;
+    }
+    const T *base = a;
+    while (n > 1) {
+        size_t half = n / 2;
+        // 下一层会访问 base[half / 2] 或 base[half + half / 2]，两者都预取
+        STATIC_SEARCH_PREFETCH(base + half / 2);
+        STATIC_SEARCH_PREFETCH(base + half + half / 2);
+        base += (base[half - 1] < x) * half;
+        n -= half;
+    }
+    return size_t(base - a) + (*base < x);
+}
+
+/**
+ * @brief Eytzinger（BFS）布局的静态查找索引
+ * @tparam T 键类型，需要支持 `operator<`
+ */
+template <typename T>
+class eytzinger_index {
+ public:
+    /**
+     * @param sorted 有序数组
+     */
+    explicit eytzinger_index(const std::vector<T> &sorted)
+        : n_(sorted.size()), keys_(sorted.size() + 1), rank_(sorted.size() + 1) {
+        size_t next = 0;
+        build(sorted, 1, &next);
+        rank_[0] = n_;  // lower_bound 落到 0 号结点表示不存在
+    }
+
+    /** @brief 元素个数 */
+    size_t size() const { return n_; }
+
+    /** @brief 索引占用的字节数 */
+    size_t memory_bytes() const { return (n_ + 1) * (sizeof(T) + sizeof(size_t)); }
+
+    /**
+     * @brief 第一个不小于 x 的元素在原有序数组中的下标，不存在时返回 size()
+     */
+    size_t lower_bound(const T &x) const {
+        constexpr size_t kPrefetchStride = std::max<size_t>(1, kCacheLine / sizeof(T));
+        const T *b = keys_.data();
+        size_t k = 1;
+        while (k <= n_) {
+            STATIC_SEARCH_PREFETCH(b + k * kPrefetchStride);
+            k = 2 * k + (b[k] < x);
+        }
+        // 去掉末尾连续的 1（最后一次向左走之后的所有向右走），再去掉那一次向左走
+        k >>= count_trailing_ones(k) + 1;
+        return rank_[k];
+    }
+
+ private:
+    size_t n_;
+    aligned_array<T> keys_;     ///< keys_[k] 是 BFS 编号为 k 的结点（从 1 开始）
+    std::vector<size_t> rank_;  ///< rank_[k] 是结点 k 在原有序数组中的下标
+
+    void build(const std::vector<T> &sorted, size_t k, size_t *next) {
+        if (k <= n_) {
+            build(sorted, 2 * k, next);
+            keys_[k] = sorted[*next];
+            rank_[k] = (*next)++;
+            build(sorted, 2 * k + 1, next);
+        }
+    }
+
+    static unsigned count_trailing_ones(size_t k) {
+        unsigned c = 0;
+        while (k & 1) {
+            k >>= 1;
+            c++;
+        }
+        return c;
+    }
+};
+
+/**
+ * @brief 统计结点中比 x 小的键的个数（结点内的键有序，结果就是应该走的孩子编号）
+ */
+template <typename T, size_t B>
+inline size_t node_rank(const T *node, const T &x) {
+    size_t count = 0;
+    for (size_t i = 0; i < B; i++) {
+        count += node[i] < x;
+    }
+    return count;
+}
+
+#if defined(__AVX2__)
+template <>
+inline size_t node_rank<int32_t, 16>(const int32_t *node, const int32_t &x) {
+    __m256i v = _mm256_set1_epi32(x);
+    __m256i lo = _mm256_cmpgt_epi32(v, _mm256_load_si256((const __m256i *)node));
+    __m256i hi = _mm256_cmpgt_epi32(v, _mm256_load_si256((const __m256i *)(node + 8)));
+    unsigned mask = unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(lo))) |
+                    (unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(hi))) << 8);
+    return size_t(__builtin_popcount(mask));
+}
+#endif
+
+/**
+ * @brief S-tree（静态 B 树）布局的静态查找索引
+ * @details 结点 k 的第 i 个孩子是 k * (B + 1) + i + 1，结点按中序依次填入有序数组的元素，
+ * 最后一个结点不足 B 个时用 T 的上界补齐（对应的下标为 n）：浮点数用 +∞，其它类型用最大值。
+ * 补齐的键在中序上排在所有元素之后，仍然是有序的，所以等于它的元素先被选中。
+ * 浮点数若用最大有限值补齐，+∞ 会排在补齐的键之前，lower_bound 的结果就错了；NaN 不能作为键。
+ * @tparam T 键类型，需要支持 `operator<` 和 `std::numeric_limits<T>`
+ * @tparam B 每个结点的键数
+ */
+template <typename T, size_t B = 16>
+class s_tree_index {
+ public:
+    /**
+     * @param sorted 有序数组
+     */
+    explicit s_tree_index(const std::vector<T> &sorted)
+        : n_(sorted.size()),
+          blocks_((sorted.size() + B - 1) / B),
+          keys_(std::max<size_t>(blocks_, 1) * B),
+          rank_(std::max<size_t>(blocks_, 1) * B) {
+        size_t next = 0;
+        build(sorted, 0, &next);
+    }
+
+    /** @brief 元素个数 */
+    size_t size() const { return n_; }
+
+    /** @brief 索引占用的字节数 */
+    size_t memory_bytes() const { return keys_.size() * (sizeof(T) + sizeof(size_t)); }
+
+    /**
+     * @brief 第一个不小于 x 的元素在原有序数组中的下标，不存在时返回 size()
+     */
+    size_t lower_bound(const T &x) const {
+        // 循环中只记录最后一个候选键的位置，最后再读一次 rank_：
+        // 如果每层都读 rank_，每层就要多一次缓存未命中（rank_ 与 keys_ 是两个数组）
+        size_t slot = keys_.size();
+        size_t k = 0;
+        while (k < blocks_) {
+            const T *node = keys_.data() + k * B;
+            size_t i = node_rank<T, B>(node, x);
+            slot = i < B ? k * B + i : slot;
+            k = child(k, i);
+        }
+        return slot < keys_.size() ? rank_[slot] : n_;
+    }
+
+ private:
+    size_t n_;
+    size_t blocks_;
+    aligned_array<T> keys_;     ///< 第 k 个结点的键位于 [k * B, (k + 1) * B)
+    std::vector<size_t> rank_;  ///< 每个键在原有序数组中的下标，补齐的位置为 n
+
+    static size_t child(size_t k, size_t i) { return k * (B + 1) + i + 1; }
+
+    /// 补齐用的键：不小于任何可能的键
+    static T pad() {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return std::numeric_limits<T>::infinity();
+        } else {
+            return std::numeric_limits<T>::max();
+        }
+    }
+
+    void build(const std::vector<T> &sorted, size_t k, size_t *next) {
+        if (k >= blocks_) {
+            return;
+        }
+        for (size_t i = 0; i < B; i++) {
+            build(sorted, child(k, i), next);
+            if (*next < n_) {
+                keys_[k * B + i] = sorted[*next];
+                rank_[k * B + i] = (*next)++;
+            } else {
+                keys_[k * B + i] = pad();
+                rank_[k * B + i] = n_;
+            }
+        }
+        build(sorted, child(k, B), next);
+    }
+};
+}  // namespace static_search
+}  // namespace search
@@ -27,6 +27,9 @@
  *
  * \note 本算法仅适用于包含唯一元素的数组
  *
+ * 原地、允许重复元素的线性时间选择（introselect、Floyd–Rivest）以及一次求多个分位数，
+ * 见 `selection.h`。
+ *
  * 下面是一些可以用来测试算法的示例列表：
  * A = [1,2,3,4,5,1000,8,9,99]（包含唯一元素）
  * B = [1,2,3,4,5,6]（包含唯一元素）
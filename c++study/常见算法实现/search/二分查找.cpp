@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @brief 二分查找的几种实现（无分支二分、Eytzinger 布局、S-tree 布局）的测试与基准测试
+ * @details 算法本身见 `static_search.h`。用 `-mavx2` 编译可以启用 S-tree 的 SIMD 结点比较。
+ *
+ * 用法：`./a.out [最大规模]`，基准测试从 1e6 个键开始，每次乘以 10，直到最大规模（默认 1e7，
+ * 最大可以到 1e9，需要约 1e9 * (4 + 8) * 3 字节内存）。
+ */
+#include <algorithm>  /// 用于 std::lower_bound, std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 int32_t
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <limits>     /// 用于 std::numeric_limits
+#include <random>     /// 用于 std::mt19937
+#include <utility>    /// 用于 std::make_pair
+#include <vector>     /// 用于 std::vector
+
+#include "./static_search.h"
+
+using search::static_search::branchless_lower_bound;
+using search::static_search::eytzinger_index;
+using search::static_search::s_tree_index;
+
+/**
+ * @brief 对一个有序数组检查所有实现与 std::lower_bound 一致
+ */
+template <typename T>
+static void check(const std::vector<T> &sorted, const std::vector<T> &queries) {
+    eytzinger_index<T> eytzinger(sorted);
+    s_tree_index<T> s_tree(sorted);
+    for (const T &x : queries) {
+        size_t expected = std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin();
+        assert(branchless_lower_bound(sorted.data(), sorted.size(), x) == expected);
+        assert(eytzinger.lower_bound(x) == expected);
+        assert(s_tree.lower_bound(x) == expected);
+    }
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937 rng(5);
+
+    // 第1个测试：各种规模（包括 0、1、S-tree 结点边界），查询覆盖数组内外的值
+    for (size_t n : {0, 1, 2, 15, 16, 17, 100, 272, 273, 1000, 4913, 100000}) {
+        std::vector<int32_t> sorted(n);
+        for (auto &v : sorted) v = int32_t(rng() % 1000000) - 500000;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<int32_t> queries = {std::numeric_limits<int32_t>::min(),
+                                        std::numeric_limits<int32_t>::max()};
+        for (int i = 0; i < 2000; i++) queries.push_back(int32_t(rng() % 1200000) - 600000);
+        for (int32_t v : sorted) queries.push_back(v);
+        check(sorted, queries);
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：大量重复元素，lower_bound 必须返回第一个
+    std::vector<int32_t> dup(5000);
+    for (auto &v : dup) v = int32_t(rng() % 8);
+    std::sort(dup.begin(), dup.end());
+    check(dup, std::vector<int32_t>{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8});
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：64 位键与浮点键（走标量结点比较）
+    std::vector<uint64_t> big(3000);
+    for (auto &v : big) v = (uint64_t(rng()) << 32) | rng();
+    std::sort(big.begin(), big.end());
+    check(big, std::vector<uint64_t>(big.begin(), big.begin() + 500));
+    std::vector<double> real = {-2.5, -1, 0, 0.5, 0.5, 3, 7.25};
+    check(real, std::vector<double>{-3, -2.5, 0.25, 0.5, 7.25, 8});
+    // 包含 ±∞ 的浮点键：S-tree 补齐的键不能小于 +∞
+    const double inf = std::numeric_limits<double>::infinity();
+    const double dmax = std::numeric_limits<double>::max();
+    const std::vector<double> inf_queries = {-inf, -1, 0, 1e300, dmax, inf};
+    check(std::vector<double>{-inf, -1, 0, 2, inf, inf}, inf_queries);
+    std::vector<double> wide(40);
+    for (size_t i = 0; i < wide.size(); i++) wide[i] = i < 30 ? double(i) : i < 33 ? dmax : inf;
+    check(wide, inf_queries);
+    const float finf = std::numeric_limits<float>::infinity();
+    check(std::vector<float>{-1, 0, finf},
+          std::vector<float>{0, std::numeric_limits<float>::max(), finf});
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 与 std::lower_bound 对比的基准测试（单位 ns/查询）
+ */
+static void benchmark(size_t max_size) {
+    const size_t num_queries = 1 << 22;
+    std::mt19937 rng(9);
+    std::cout << "\n基准测试（随机 int32 键，单位 ns/查询）\n";
+    for (size_t n = 1000000; n <= max_size; n *= 10) {
+        std::vector<int32_t> sorted(n);
+        for (auto &v : sorted) v = int32_t(rng());
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<int32_t> queries(num_queries);
+        for (auto &q : queries) q = int32_t(rng());
+
+        eytzinger_index<int32_t> eytzinger(sorted);
+        s_tree_index<int32_t> s_tree(sorted);
+
+        // 把结果累加起来，防止编译器把查找优化掉
+        auto time = [&](auto lower_bound) {
+            size_t checksum = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int32_t q : queries) checksum += lower_bound(q);
+            auto t1 = std::chrono::steady_clock::now();
+            return std::make_pair(
+                std::chrono::duration<double, std::nano>(t1 - t0).count() / num_queries,
+                checksum);
+        };
+        auto stl = time([&](int32_t q) {
+            return size_t(std::lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+        });
+        auto branchless =
+            time([&](int32_t q) { return branchless_lower_bound(sorted.data(), n, q); });
+        auto eyt = time([&](int32_t q) { return eytzinger.lower_bound(q); });
+        auto stree = time([&](int32_t q) { return s_tree.lower_bound(q); });
+        assert(stl.second == branchless.second && stl.second == eyt.second &&
+               stl.second == stree.second);
+
+        std::cout << "n = " << n << "\tstd::lower_bound: " << stl.first
+                  << "\t无分支: " << branchless.first << "\tEytzinger: " << eyt.first
+                  << "\tS-tree: " << stree.first << "\n";
+    }
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000);
+    return 0;
+}
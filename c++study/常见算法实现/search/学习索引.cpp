@@ -0,0 +1,186 @@
+/**
+ * @file
+ * @brief 学习索引（PGM 式分段线性模型）的测试，以及与插值查找、二分查找的基准测试
+ * @details 算法本身见 `learned_index.h`，对照的插值查找是 `batch_search.h` 中逐个查询的版本。
+ *
+ * 用法：`./a.out [键的个数]`，默认 1e7。基准测试在三种键分布上进行：
+ * 均匀分布、对数正态分布、以及模拟真实数据的带突发的时间戳（昼夜周期 + 随机的密集突发）。
+ */
+#include <algorithm>  /// 用于 std::lower_bound, std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cmath>      /// 用于 std::sin
+#include <cstdint>    /// 用于 int32_t, int64_t
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <limits>     /// 用于 std::numeric_limits
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+#include "./batch_search.h"
+#include "./learned_index.h"
+
+using search::learned_index::pgm_index;
+
+/**
+ * @brief 检查学习索引与 std::lower_bound 一致
+ */
+template <typename K>
+static void check(const std::vector<K> &sorted, const std::vector<K> &queries,
+                  size_t epsilon) {
+    pgm_index<K> index(sorted, epsilon, epsilon);
+    for (const K &x : queries) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), x);
+        assert(index.lower_bound(x) == size_t(it - sorted.begin()));
+        bool present = it != sorted.end() && *it == x;
+        assert(index.find(x) == (present ? size_t(it - sorted.begin()) : size_t(-1)));
+    }
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(13);
+
+    // 第1个测试：各种规模和误差界，查询覆盖数组内外的值
+    for (size_t epsilon : {0, 1, 4, 64}) {
+        for (size_t n : {0, 1, 2, 3, 17, 100, 1000, 100000}) {
+            std::vector<int32_t> sorted(n);
+            for (auto &v : sorted) v = int32_t(rng() % 1000000) - 500000;
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<int32_t> queries = {std::numeric_limits<int32_t>::min(),
+                                            std::numeric_limits<int32_t>::max()};
+            for (int i = 0; i < 2000; i++) queries.push_back(int32_t(rng() % 1200000) - 600000);
+            for (int32_t v : sorted) queries.insert(queries.end(), {v - 1, v, v + 1});
+            check(sorted, queries, epsilon);
+        }
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：大量重复元素（每段重复之后的查询要落到下一个键），全部相等，以及相邻的重复段
+    std::vector<int32_t> dup(5000);
+    for (auto &v : dup) v = int32_t(rng() % 20) * 3;
+    std::sort(dup.begin(), dup.end());
+    std::vector<int32_t> small_queries;
+    for (int32_t q = -2; q <= 62; q++) small_queries.push_back(q);
+    std::vector<int32_t> adjacent = {1, 1, 1, 2, 2, 3, 3, 3, 3, 4, 9, 9, 10};
+    for (size_t epsilon : {0, 1, 8}) {
+        check(dup, small_queries, epsilon);
+        check(std::vector<int32_t>(1000, 7), small_queries, epsilon);
+        check(adjacent, small_queries, epsilon);
+    }
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：跨越整个 int64 范围的键、偏斜分布的浮点键
+    std::vector<int64_t> wide = {std::numeric_limits<int64_t>::min(),
+                                 std::numeric_limits<int64_t>::min(), -5, 0, 3,
+                                 std::numeric_limits<int64_t>::max(),
+                                 std::numeric_limits<int64_t>::max()};
+    for (int i = 0; i < 3000; i++) wide.push_back(int64_t(rng()));
+    std::sort(wide.begin(), wide.end());
+    std::vector<int64_t> wide_queries(wide.begin(), wide.end());
+    for (int i = 0; i < 3000; i++) wide_queries.push_back(int64_t(rng()));
+    wide_queries.push_back(std::numeric_limits<int64_t>::min() + 1);
+    wide_queries.push_back(std::numeric_limits<int64_t>::max() - 1);
+    check(wide, wide_queries, 2);
+
+    std::lognormal_distribution<double> lognormal(0, 2);
+    std::vector<double> real(20000);
+    for (auto &v : real) v = lognormal(rng);
+    real.push_back(real[7]);
+    std::sort(real.begin(), real.end());
+    std::vector<double> real_queries(real.begin(), real.end());
+    for (int i = 0; i < 3000; i++) real_queries.push_back(lognormal(rng));
+    check(real, real_queries, 8);
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 生成 n 个有序的键
+ * @param kind 0 均匀分布，1 对数正态分布，2 带突发的时间戳
+ */
+static std::vector<int64_t> generate(int kind, size_t n, std::mt19937_64 &rng) {
+    std::vector<int64_t> keys(n);
+    if (kind == 0) {
+        for (auto &v : keys) v = int64_t(rng() >> 1);
+    } else if (kind == 1) {
+        std::lognormal_distribution<double> lognormal(0, 2);
+        for (auto &v : keys) v = int64_t(lognormal(rng) * 1e9);
+    } else {
+        // 毫秒时间戳：到达率随一天的时间正弦变化，偶尔出现持续数秒、到达率高 1000 倍的突发
+        std::exponential_distribution<double> gap(1.0);
+        double t = 1.6e12, burst_end = 0;
+        for (auto &v : keys) {
+            double day = std::sin(t / 86400000.0 * 2 * 3.141592653589793);
+            double mean = 50.0 * (1.5 + day);
+            if (t < burst_end) {
+                mean /= 1000;
+            } else if (rng() % 100000 == 0) {
+                burst_end = t + 5000;
+            }
+            t += gap(rng) * mean;
+            v = int64_t(t);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+/**
+ * @brief 在三种分布上比较二分查找、插值查找与学习索引（单位 ns/查询）
+ * @param n 键的个数
+ */
+static void benchmark(size_t n) {
+    const size_t num_queries = 1 << 20;
+    const char *names[] = {"均匀分布", "对数正态分布", "带突发的时间戳"};
+    std::mt19937_64 rng(21);
+    for (int kind = 0; kind < 3; kind++) {
+        std::vector<int64_t> keys = generate(kind, n, rng);
+        std::vector<int64_t> queries(num_queries);
+        for (auto &q : queries) q = keys[rng() % n];
+
+        // 把结果累加起来，防止编译器把查找优化掉；count 是实际使用的查询个数
+        auto time = [&](size_t count, auto lookup) {
+            size_t checksum = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; i++) checksum += keys[lookup(queries[i])] == queries[i];
+            auto t1 = std::chrono::steady_clock::now();
+            assert(checksum == count);
+            (void)checksum;
+            return std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+        };
+
+        std::cout << "\n" << names[kind] << "（n = " << n << "，单位 ns/查询）\n";
+        std::cout << "std::lower_bound: " << time(num_queries, [&](int64_t q) {
+            return size_t(std::lower_bound(keys.begin(), keys.end(), q) - keys.begin());
+        }) << "\n";
+        // 插值查找在偏斜分布上每次查询可能要探测 O(n) 次，只测少量查询
+        std::cout << "插值查找: " << time(kind == 0 ? num_queries : 1000, [&](int64_t q) {
+            return search::batch::interpolation_search(keys.data(), n, q);
+        }) << "\n";
+        for (size_t epsilon : {16, 64, 256}) {
+            auto t0 = std::chrono::steady_clock::now();
+            pgm_index<int64_t> index(keys, epsilon);
+            auto t1 = std::chrono::steady_clock::now();
+            double ns = time(num_queries, [&](int64_t q) { return index.lower_bound(q); });
+            std::cout << "学习索引 ε = " << epsilon << ": " << ns
+                      << "\t段数: " << index.segment_count() << "\t层数: " << index.height()
+                      << "\t模型大小: " << index.memory_bytes() << " 字节（"
+                      << double(index.memory_bytes()) / n << " 字节/键）\t构建: "
+                      << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms\n";
+        }
+    }
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000);
+    return 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @brief 批量查找（组预取的二分查找、AMAC 插值查找、CSR 哈希索引）的测试与基准测试
+ * @details 算法本身见 `batch_search.h`。
+ *
+ * 用法：`./a.out [键的个数]`，默认 1 << 24。基准测试比较逐个查询的循环与批量接口（单位 ns/查询）。
+ */
+#include <algorithm>  /// 用于 std::lower_bound, std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 int32_t, int64_t
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <limits>     /// 用于 std::numeric_limits
+#include <random>     /// 用于 std::mt19937_64
+#include <vector>     /// 用于 std::vector
+
+#include "./batch_search.h"
+
+namespace batch = search::batch;
+
+/**
+ * @brief 对一个有序数组检查三种批量查找与逐个查找的结果一致
+ */
+template <typename T>
+static void check(const std::vector<T> &sorted, const std::vector<T> &queries) {
+    std::vector<size_t> lb = batch::lower_bound_batch(sorted, queries);
+    std::vector<size_t> interp = batch::interpolation_search_batch(sorted, queries);
+    batch::hash_index<T> index(sorted);
+    std::vector<size_t> hashed = index.find_batch(queries);
+    for (size_t i = 0; i < queries.size(); i++) {
+        const T &x = queries[i];
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), x);
+        bool present = it != sorted.end() && *it == x;
+        assert(lb[i] == size_t(it - sorted.begin()));
+
+        // 有重复元素时插值查找可以返回任意一个相等元素的下标
+        assert(interp[i] == batch::interpolation_search(sorted.data(), sorted.size(), x) ||
+               (present && interp[i] != batch::npos && sorted[interp[i]] == x));
+        if (present) {
+            assert(interp[i] != batch::npos && sorted[interp[i]] == x);
+        } else {
+            assert(interp[i] == batch::npos);
+        }
+
+        // 哈希索引返回第一次出现的位置，也就是 lower_bound
+        assert(hashed[i] == index.find(x));
+        assert(hashed[i] == (present ? size_t(it - sorted.begin()) : batch::npos));
+    }
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(12);
+
+    // 第1个测试：各种规模（包括 0、1 和不是 kGroupSize 整数倍的查询数），查询覆盖数组内外的值
+    for (size_t n : {0, 1, 2, 3, 15, 16, 17, 100, 1000, 100000}) {
+        std::vector<int32_t> sorted(n);
+        for (auto &v : sorted) v = int32_t(rng() % 1000000) - 500000;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<int32_t> queries = {std::numeric_limits<int32_t>::min(),
+                                        std::numeric_limits<int32_t>::max()};
+        for (int i = 0; i < 1999; i++) queries.push_back(int32_t(rng() % 1200000) - 600000);
+        for (int32_t v : sorted) queries.push_back(v);
+        check(sorted, queries);
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：大量重复元素，以及全部相等的数组
+    std::vector<int32_t> dup(5000);
+    for (auto &v : dup) v = int32_t(rng() % 8) * 3;
+    std::sort(dup.begin(), dup.end());
+    std::vector<int32_t> small_queries;
+    for (int32_t q = -2; q <= 25; q++) small_queries.push_back(q);
+    check(dup, small_queries);
+    check(std::vector<int32_t>(1000, 7), small_queries);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：跨越整个 int64 范围的键（插值时相减不能溢出）
+    std::vector<int64_t> wide = {std::numeric_limits<int64_t>::min(), -5, 0, 3,
+                                 std::numeric_limits<int64_t>::max()};
+    for (int i = 0; i < 3000; i++) wide.push_back(int64_t(rng()));
+    std::sort(wide.begin(), wide.end());
+    std::vector<int64_t> wide_queries(wide.begin(), wide.end());
+    for (int i = 0; i < 3000; i++) wide_queries.push_back(int64_t(rng()));
+    wide_queries.push_back(std::numeric_limits<int64_t>::min() + 1);
+    wide_queries.push_back(std::numeric_limits<int64_t>::max() - 1);
+    check(wide, wide_queries);
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：2^63 附近的 uint64 键，相邻的键转成 double 后相等（插值的分母为 0）
+    std::vector<uint64_t> close;
+    for (uint64_t i = 0; i < 4000; i += 1 + rng() % 3) close.push_back((uint64_t(1) << 63) + i);
+    std::vector<uint64_t> close_queries = {0, std::numeric_limits<uint64_t>::max()};
+    for (uint64_t i = 0; i < 4100; i++) close_queries.push_back((uint64_t(1) << 63) + i);
+    check(close, close_queries);
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 逐个查询与批量查询的基准测试（单位 ns/查询）
+ * @param n 键的个数
+ */
+static void benchmark(size_t n) {
+    const size_t num_queries = 1 << 22;
+    std::mt19937_64 rng(9);
+    std::vector<int64_t> sorted(n);
+    for (auto &v : sorted) v = int64_t(rng() >> 1);
+    std::sort(sorted.begin(), sorted.end());
+    // 一半查询命中，一半随机（几乎都不命中）
+    std::vector<int64_t> queries(num_queries);
+    for (size_t i = 0; i < num_queries; i++) {
+        queries[i] = i % 2 == 0 ? sorted[rng() % n] : int64_t(rng() >> 1);
+    }
+    batch::hash_index<int64_t> index(sorted);
+    std::vector<size_t> out(num_queries);
+
+    // 把结果累加起来，防止编译器把查找优化掉
+    auto checksum = [&]() {
+        size_t sum = 0;
+        for (size_t r : out) sum += r;
+        return sum;
+    };
+    auto time = [&](auto run) {
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / num_queries;
+    };
+
+    std::cout << "\n基准测试（n = " << n << "，随机 int64 键，单位 ns/查询）\n";
+    double single = time([&] {
+        for (size_t i = 0; i < num_queries; i++) {
+            out[i] = size_t(std::lower_bound(sorted.begin(), sorted.end(), queries[i]) -
+                            sorted.begin());
+        }
+    });
+    size_t expected = checksum();
+    double batched = time([&] {
+        batch::lower_bound_batch(sorted.data(), n, queries.data(), num_queries, out.data());
+    });
+    assert(checksum() == expected);
+    std::cout << "二分查找\t逐个: " << single << "\t批量: " << batched << "\n";
+
+    single = time([&] {
+        for (size_t i = 0; i < num_queries; i++) {
+            out[i] = batch::interpolation_search(sorted.data(), n, queries[i]);
+        }
+    });
+    expected = checksum();
+    batched = time([&] {
+        batch::interpolation_search_batch(sorted.data(), n, queries.data(), num_queries,
+                                          out.data());
+    });
+    assert(checksum() == expected);
+    std::cout << "插值查找\t逐个: " << single << "\t批量: " << batched << "\n";
+
+    single = time([&] {
+        for (size_t i = 0; i < num_queries; i++) out[i] = index.find(queries[i]);
+    });
+    expected = checksum();
+    batched = time([&] { index.find_batch(queries.data(), num_queries, out.data()); });
+    assert(checksum() == expected);
+    std::cout << "哈希查找\t逐个: " << single << "\t批量: " << batched << "\n";
+    (void)expected;
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(1) << 24);
+    return 0;
+}
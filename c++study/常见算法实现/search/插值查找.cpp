@@ -16,6 +16,9 @@
  * 平均时间复杂度	        O(log2(log2 n))
  * 空间复杂度	            O(1)
  *
+ * 键分布偏斜（对数正态、带突发的时间戳等）时，可以改用 `learned_index.h` 中的学习索引，
+ * 它用误差有界的分段线性模型代替单条直线，查找步数不依赖于分布。
+ *
  * @author [Lajat Manekar](https://github.com/Lazeeez)
  * @author Unknown author
  *******************************************************************************/
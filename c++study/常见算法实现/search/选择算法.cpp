@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @brief 原地选择算法（内省选择、Floyd–Rivest、中位数的中位数）与多分位数的测试和基准测试
+ * @details 算法本身见 `selection.h`。
+ *
+ * 用法：`./a.out [元素个数] [线程数]`，默认 1e7 个元素、硬件线程数。
+ * 基准测试的数据模拟延迟样本：对数正态分布、以微秒取整，因此有大量重复值。
+ */
+#include <algorithm>   /// 用于 std::nth_element, std::sort
+#include <cassert>     /// 用于 assert
+#include <chrono>      /// 用于基准测试计时
+#include <cstdint>     /// 用于 uint32_t
+#include <cstdlib>     /// 用于 std::strtoull
+#include <functional>  /// 用于 std::greater
+#include <iostream>    /// 用于输入输出操作
+#include <random>      /// 用于 std::mt19937_64
+#include <string>      /// 用于 std::string
+#include <thread>      /// 用于 std::thread::hardware_concurrency
+#include <vector>      /// 用于 std::vector
+
+#include "./selection.h"
+
+namespace sel = search::selection;
+
+/**
+ * @brief 检查 select 之后 a[k] 是第 k 小的元素，且两侧满足划分
+ */
+template <typename T, typename Select, typename Compare = std::less<T>>
+static void check_select(std::vector<T> a, size_t k, Select select, Compare comp = Compare()) {
+    std::vector<T> sorted = a;
+    std::sort(sorted.begin(), sorted.end(), comp);
+    select(a.data(), a.size(), k, comp);
+    assert(!comp(a[k], sorted[k]) && !comp(sorted[k], a[k]));
+    for (size_t i = 0; i < k; i++) assert(!comp(a[k], a[i]));
+    for (size_t i = k + 1; i < a.size(); i++) assert(!comp(a[i], a[k]));
+    // 元素的多重集合不变
+    std::sort(a.begin(), a.end(), comp);
+    assert(a == sorted);
+}
+
+/**
+ * @brief 用三种选择算法各检查一遍
+ */
+template <typename T, typename Compare = std::less<T>>
+static void check_all(const std::vector<T> &a, size_t k, Compare comp = Compare()) {
+    check_select(a, k, [](T *p, size_t n, size_t r, Compare c) { sel::introselect(p, n, r, c); },
+                 comp);
+    check_select(
+        a, k, [](T *p, size_t n, size_t r, Compare c) { sel::floyd_rivest_select(p, n, r, c); },
+        comp);
+    check_select(
+        a, k,
+        [](T *p, size_t n, size_t r, Compare c) { sel::median_of_medians_select(p, n, r, c); },
+        comp);
+}
+
+/**
+ * @brief 生成测试数据
+ * @param kind 0 随机，1 有序，2 逆序，3 少量不同值，4 全部相等，5 风琴管（先升后降）
+ */
+static std::vector<int> generate(int kind, size_t n, std::mt19937_64 &rng) {
+    std::vector<int> a(n);
+    for (size_t i = 0; i < n; i++) {
+        switch (kind) {
+            case 0: a[i] = int(rng() % 1000000); break;
+            case 1: a[i] = int(i); break;
+            case 2: a[i] = int(n - i); break;
+            case 3: a[i] = int(rng() % 4); break;
+            case 4: a[i] = 42; break;
+            default: a[i] = int(i < n / 2 ? i : n - i); break;
+        }
+    }
+    return a;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(14);
+
+    // 第1个测试：各种分布与规模（跨过插入排序和 Floyd–Rivest 抽样的阈值），秩取两端和中间
+    for (int kind = 0; kind < 6; kind++) {
+        for (size_t n : {1, 2, 5, 16, 17, 100, 601, 1000, 20000}) {
+            std::vector<int> a = generate(kind, n, rng);
+            for (size_t k : {size_t(0), n / 3, n / 2, n - 1, size_t(rng() % n)}) check_all(a, k);
+        }
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：自定义比较函数（第 k 大）与浮点数
+    std::vector<double> d(5000);
+    for (auto &x : d) x = double(rng() % 100000) / 7;
+    for (size_t k : {0, 1, 2500, 4999}) check_all(d, k, std::greater<double>());
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：原 `中位数查找.cpp` 的用例
+    check_all(std::vector<int>{25, 21, 98, 100, 76, 22, 43, 60, 89, 87}, 3);
+    std::vector<int> c{1, 2, 3, 4, 5, 1000, 8, 9, 99};
+    sel::introselect(c.data(), c.size(), 7);
+    assert(c[7] == 99);
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：多分位数与并行分位数（超过并行阈值，含大量重复值）与逐个排序结果一致
+    const std::vector<double> qs = {0.5, 0.9, 0.99, 0.999, 0, 1, 0.5};
+    for (size_t n : {size_t(1), size_t(7), size_t(1000), sel::kParallelThreshold + 12345}) {
+        for (int kind : {0, 3, 5}) {
+            std::vector<int> a = generate(kind, n, rng);
+            std::vector<int> sorted = a;
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<int> expected;
+            for (double q : qs) expected.push_back(sorted[sel::quantile_rank(n, q)]);
+            std::vector<int> work = a;
+            assert(sel::quantiles(&work, qs) == expected);
+            assert(sel::quantiles_parallel(a.data(), n, qs, 4) == expected);
+        }
+    }
+    assert(sel::quantile_rank(1000, 0.5) == 499);
+    assert(sel::quantile_rank(1000, 0.999) == 998);
+    assert(sel::quantile_rank(1000, 1) == 999);
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 在模拟的延迟数据上比较各算法（单位 ms）
+ */
+static void benchmark(size_t n, size_t threads) {
+    std::mt19937_64 rng(99);
+    std::lognormal_distribution<double> latency(5, 1.2);
+    std::vector<uint32_t> data(n);
+    for (auto &x : data) x = uint32_t(latency(rng));
+    const std::vector<double> qs = {0.5, 0.9, 0.99, 0.999};
+    std::vector<size_t> ranks;
+    for (double q : qs) ranks.push_back(sel::quantile_rank(n, q));
+
+    auto time = [&](const std::string &name, auto run) {
+        std::vector<uint32_t> work = data;
+        auto t0 = std::chrono::steady_clock::now();
+        std::vector<uint32_t> result = run(&work);
+        auto t1 = std::chrono::steady_clock::now();
+        std::cout << name << ": " << std::chrono::duration<double, std::milli>(t1 - t0).count()
+                  << " ms\t";
+        for (uint32_t r : result) std::cout << r << " ";
+        std::cout << "\n";
+        return result;
+    };
+
+    std::cout << "\n基准测试（n = " << n << "，对数正态延迟，p50/p90/p99/p999）\n";
+    auto expected = time("std::nth_element × 4", [&](std::vector<uint32_t> *a) {
+        std::vector<uint32_t> r;
+        for (size_t k : ranks) {
+            std::nth_element(a->begin(), a->begin() + k, a->end());
+            r.push_back((*a)[k]);
+        }
+        return r;
+    });
+    auto each = [&](auto select) {
+        return [&, select](std::vector<uint32_t> *a) {
+            std::vector<uint32_t> r;
+            for (size_t k : ranks) {
+                select(a->data(), n, k);
+                r.push_back((*a)[k]);
+            }
+            return r;
+        };
+    };
+    auto check = [&](const std::vector<uint32_t> &r) {
+        assert(r == expected);
+        (void)r;
+    };
+    check(time("introselect × 4", each([](uint32_t *a, size_t m, size_t k) {
+                   sel::introselect(a, m, k);
+               })));
+    check(time("floyd_rivest_select × 4", each([](uint32_t *a, size_t m, size_t k) {
+                   sel::floyd_rivest_select(a, m, k);
+               })));
+    check(time("median_of_medians_select × 4", each([](uint32_t *a, size_t m, size_t k) {
+                   sel::median_of_medians_select(a, m, k, std::less<uint32_t>());
+               })));
+    check(time("quantiles", [&](std::vector<uint32_t> *a) { return sel::quantiles(a, qs); }));
+    check(time("quantiles_parallel（" + std::to_string(threads) + " 线程）",
+               [&](std::vector<uint32_t> *a) {
+                   return sel::quantiles_parallel(a->data(), n, qs, threads);
+               }));
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                              : std::max(1u, std::thread::hardware_concurrency());
+    benchmark(n, threads);
+    return 0;
+}
@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief 实现 [Gnome 排序](https://en.wikipedia.org/wiki/Gnome_sort) 算法
+ * @brief 测试 [Gnome 排序](https://en.wikipedia.org/wiki/Gnome_sort) 算法，实现见 `gnome_sort.h`
  * @author [beqakd](https://github.com/beqakd)
  * @author [Krishna Vedala](https://github.com/kvedala)
  * @details
@@ -16,63 +16,7 @@
 #include <cassert>    // 引入 assert 用于断言
 #include <iostream>   // 引入输入输出操作
 
-/**
- * @namespace sorting
- * 排序算法
- */
-namespace sorting {
-/**
- * 该实现适用于 C 风格的数组输入，数组在原地修改。
- * @param [in,out] arr 要排序的数组。
- * @param size 数组的大小
- */
-template <typename T>
-void gnomeSort(T *arr, int size) {
-    // 处理一些简单情况
-    if (size <= 1) {
-        return;
-    }
-
-    int index = 0;  // 初始化变量
-    while (index < size) {
-        // 检查是否需要交换
-        if ((index == 0) || (arr[index] >= arr[index - 1])) {
-            index++;  // 如果当前元素不小于前一个元素，继续移动
-        } else {
-            std::swap(arr[index], arr[index - 1]);  // 交换元素
-            index--;  // 交换后需要检查前一个元素
-        }
-    }
-}
-
-/**
- * 该实现适用于 C++ 风格的数组输入。函数的参数是按值传递，因此会创建数组的副本，
- * 并对副本进行修改，最后返回排序后的数组。
- * @tparam T 数组元素的数据类型
- * @tparam size 数组的大小
- * @param [in] arr 要排序的数组。
- * @return 排序后的数组
- */
-template <typename T, size_t size>
-std::array<T, size> gnomeSort(std::array<T, size> arr) {
-    // 处理一些简单情况
-    if (size <= 1) {
-        return arr;
-    }
-
-    int index = 0;  // 初始化循环索引
-    while (index < size) {
-        // 检查是否需要交换
-        if ((index == 0) || (arr[index] >= arr[index - 1])) {
-            index++;  // 如果当前元素不小于前一个元素，继续移动
-        } else {
-            std::swap(arr[index], arr[index - 1]);  // 交换元素
-            index--;  // 交换后需要检查前一个元素
-        }
-    }
-    return arr;  // 返回排序后的数组
-}
-}  // namespace sorting
+#include "./gnome_sort.h"
 
 /**
  * 测试函数
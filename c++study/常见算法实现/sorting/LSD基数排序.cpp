@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @brief [LSD 基数排序](https://en.wikipedia.org/wiki/Radix_sort) 的测试与基准测试
+ * @details 算法本身见 `lsd_radix_sort.h`。这里验证整数、浮点数和键值对的排序结果，
+ * 并与 std::sort 对比速度。
+ */
+#include <algorithm>  /// 用于 std::sort, std::stable_sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 int32_t, uint64_t
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <vector>     /// 用于 std::vector
+
+#include "./lsd_radix_sort.h"
+
+/**
+ * @brief 检查基数排序与 std::sort 的结果一致
+ */
+template <typename T>
+static void check(std::vector<T> arr) {
+    std::vector<T> expected = arr;
+    std::sort(expected.begin(), expected.end());
+    sorting::lsd_radix_sort::radix_sort(&arr);
+    assert(arr == expected);
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(2024);
+
+    // 第1个测试：无符号整数（包括高位全为 0、需要跳过的轮次）
+    check(std::vector<uint64_t>{432, 234, 143, 332, 123});
+    check(std::vector<uint64_t>{});
+    check(std::vector<uint64_t>{1});
+    std::vector<uint32_t> u32(10000);
+    std::vector<uint64_t> u64(10000), small_ids(10000);
+    for (size_t i = 0; i < u64.size(); i++) {
+        u32[i] = uint32_t(rng());
+        u64[i] = rng();
+        small_ids[i] = rng() % 100000;
+    }
+    check(u32);
+    check(u64);
+    check(small_ids);
+
+    // 每轮 8 位
+    std::vector<uint64_t> bytes = u64, buffer(u64.size());
+    sorting::lsd_radix_sort::sort_by_key<8>(bytes.data(), buffer.data(), bytes.size(),
+                                            [](uint64_t x) { return x; });
+    std::sort(u64.begin(), u64.end());
+    assert(bytes == u64);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：有符号整数
+    std::vector<int32_t> i32(10000);
+    std::vector<int64_t> i64(10000);
+    for (size_t i = 0; i < i64.size(); i++) {
+        i32[i] = int32_t(rng());
+        i64[i] = int64_t(rng() % 2001) - 1000;
+    }
+    i32.push_back(INT32_MIN);
+    i32.push_back(INT32_MAX);
+    check(i32);
+    check(i64);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：浮点数（正负数、零、极值）
+    std::vector<float> f32(10000);
+    std::vector<double> f64(10000);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (size_t i = 0; i < f64.size(); i++) {
+        f32[i] = float(dist(rng));
+        f64[i] = dist(rng);
+    }
+    f64.push_back(0.0);
+    f64.push_back(-1e300);
+    f64.push_back(1e-300);
+    check(f32);
+    check(f64);
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：键值对按 key 稳定排序
+    std::vector<std::pair<int32_t, uint32_t>> pairs(10000);
+    for (size_t i = 0; i < pairs.size(); i++) {
+        pairs[i] = {int32_t(rng() % 50) - 25, uint32_t(i)};
+    }
+    std::vector<std::pair<int32_t, uint32_t>> expected = pairs;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const std::pair<int32_t, uint32_t> &a,
+                        const std::pair<int32_t, uint32_t> &b) {
+                         return a.first < b.first;
+                     });
+    sorting::lsd_radix_sort::radix_sort(&pairs);
+    assert(pairs == expected);
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 与 std::sort 对比的基准测试
+ * @returns void
+ */
+static void benchmark() {
+    const size_t n = 10000000;
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> ids(n);
+    std::vector<uint32_t> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        ids[i] = rng() % 1000000000000ULL;  // 40 位左右的 ID，高位轮次会被跳过
+        keys[i] = uint32_t(rng());
+    }
+
+    auto run = [](const char *name, auto arr) {
+        auto copy = arr;
+        auto t0 = std::chrono::steady_clock::now();
+        sorting::lsd_radix_sort::radix_sort(&arr);
+        auto t1 = std::chrono::steady_clock::now();
+        std::sort(copy.begin(), copy.end());
+        auto t2 = std::chrono::steady_clock::now();
+        assert(arr == copy);
+        double radix = std::chrono::duration<double, std::nano>(t1 - t0).count() / arr.size();
+        double stl = std::chrono::duration<double, std::nano>(t2 - t1).count() / arr.size();
+        std::cout << name << "\tradix_sort: " << radix << "\tstd::sort: " << stl
+                  << "\t加速比: " << stl / radix << "\n";
+    };
+
+    std::cout << "\n基准测试（n = " << n << "，单位 ns/元素）\n";
+    run("uint64 ID", ids);
+    run("uint32", keys);
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();      // 运行自我测试
+    benchmark();  // 与 std::sort 对比
+    return 0;
+}
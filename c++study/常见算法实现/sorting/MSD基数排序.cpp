@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief 原地 MSD 基数排序（American flag sort）的测试与基准测试
+ * @details 算法本身见 `msd_radix_sort.h`。这里验证单线程和多线程下的排序结果，
+ * 并与 std::sort 和 LSD 基数排序对比速度。
+ */
+#include <algorithm>  /// 用于 std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 int32_t, uint64_t
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <thread>     /// 用于 std::thread::hardware_concurrency
+#include <vector>     /// 用于 std::vector
+
+#include "./lsd_radix_sort.h"
+#include "./msd_radix_sort.h"
+
+/**
+ * @brief 检查 American flag sort 与 std::sort 的结果一致
+ */
+template <typename T>
+static void check(std::vector<T> arr, size_t num_threads) {
+    std::vector<T> expected = arr;
+    std::sort(expected.begin(), expected.end());
+    sorting::msd_radix_sort::american_flag_sort(&arr, num_threads);
+    assert(arr == expected);
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(99);
+
+    for (size_t threads : {1, 4}) {
+        std::cout << "线程数: " << threads << "\n";
+
+        // 第1个测试：小数组（插入排序）与特殊情况
+        check(std::vector<uint32_t>{}, threads);
+        check(std::vector<uint32_t>{3, 1, 2}, threads);
+        check(std::vector<uint64_t>(1000, 42), threads);
+        std::cout << "第1个测试: 通过！\n";
+
+        // 第2个测试：无符号与有符号整数，包括高位字节全部相同的情况
+        std::vector<uint64_t> u64(200000), low_bits(200000);
+        std::vector<int32_t> i32(200000);
+        for (size_t i = 0; i < u64.size(); i++) {
+            u64[i] = rng();
+            low_bits[i] = rng() % 70000;
+            i32[i] = int32_t(rng());
+        }
+        check(u64, threads);
+        check(low_bits, threads);
+        check(i32, threads);
+        std::cout << "第2个测试: 通过！\n";
+
+        // 第3个测试：浮点数与大量重复值
+        std::vector<double> f64(200000);
+        std::vector<int16_t> dup(200000);
+        std::uniform_real_distribution<double> dist(-1e3, 1e3);
+        for (size_t i = 0; i < f64.size(); i++) {
+            f64[i] = dist(rng);
+            dup[i] = int16_t(rng() % 10) - 5;
+        }
+        check(f64, threads);
+        check(dup, threads);
+        std::cout << "第3个测试: 通过！\n";
+    }
+}
+
+/**
+ * @brief 与 std::sort、LSD 基数排序对比的基准测试
+ * @returns void
+ */
+static void benchmark() {
+    const size_t n = 10000000;
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> input(n);
+    for (auto &x : input) {
+        x = rng();
+    }
+
+    std::vector<uint64_t> a = input, b = input, c = input;
+    auto t0 = std::chrono::steady_clock::now();
+    sorting::msd_radix_sort::american_flag_sort(&a, threads);
+    auto t1 = std::chrono::steady_clock::now();
+    sorting::lsd_radix_sort::radix_sort(&b);
+    auto t2 = std::chrono::steady_clock::now();
+    std::sort(c.begin(), c.end());
+    auto t3 = std::chrono::steady_clock::now();
+    assert(a == c && b == c);
+
+    auto ns = [n](std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double, std::nano>(d).count() / n;
+    };
+    std::cout << "\n基准测试（n = " << n << "，uint64，单位 ns/元素）\n";
+    std::cout << "american_flag_sort（" << threads << " 线程）: " << ns(t1 - t0)
+              << "\nLSD radix_sort: " << ns(t2 - t1)
+              << "\nstd::sort: " << ns(t3 - t2) << "\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();      // 运行自我测试
+    benchmark();  // 对比速度
+    return 0;
+}
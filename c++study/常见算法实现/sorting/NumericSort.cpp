@@ -5,33 +5,17 @@
 // 使用常规排序会得到 1,10,100,2,20,200,3,30,300，
 // 即使我们知道正确的排序顺序应该是 1,2,3,10,20,30,100,200,300。
 
-// 这个程序使用了一个比较器来按数字顺序而不是字母数字顺序对数组进行排序。
+// 这个程序使用了一个比较器来按数字顺序而不是字母数字顺序对数组进行排序，
+// 比较器本身见 numeric_sort.h。
 
 #include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
 
-// 定义比较器函数，用于按数字顺序排序
-bool NumericSort(std::string a, std::string b) {
-    // 去掉前导零
-    while (a[0] == '0') {
-        a.erase(a.begin());
-    }
-    while (b[0] == '0') {
-        b.erase(b.begin());
-    }
-
-    int n = a.length();  // 获取字符串 a 的长度
-    int m = b.length();  // 获取字符串 b 的长度
+#include "./numeric_sort.h"
 
-    // 如果两个字符串长度相等，则按字典顺序排序
-    if (n == m)
-        return a < b;
-
-    // 否则按字符串的长度排序，长度短的排在前面
-    return n < m;
-}
+using sorting::numeric_sort::NumericSort;
 
 int main() {
     int n;
@@ -0,0 +1,72 @@
+/**
+ * @file bead_sort.h
+ * @brief [珠排序（重力排序）](https://en.wikipedia.org/wiki/Bead_sort) 的实现
+ * @details
+ * 把每个数 a[i] 看作第 i 行上的 a[i] 颗珠子，让珠子沿每根柱子落到底部，
+ * 再数出每一行剩下的珠子数。只能排序非负整数，
+ * 时间与空间都是 \f$O(n \cdot \max a_i)\f$，适合值域很小的输入。
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace bead_sort
+ * @brief 珠排序的实现函数
+ */
+namespace bead_sort {
+/**
+ * @brief 执行珠子排序算法的函数
+ * @tparam T 整数类型，元素必须非负
+ * @param a 待排序数组
+ * @param len 元素个数
+ */
+template <typename T>
+void beadSort(T *a, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    // 找到最大元素
+    size_t max = size_t(a[0]);
+    for (size_t i = 1; i < len; i++)
+        if (size_t(a[i]) > max)
+            max = size_t(a[i]);
+
+    // 分配内存，beads[i * max + j] 表示第 i 行第 j 根柱子上有没有珠子
+    std::vector<unsigned char> beads(max * len, 0);
+    auto bead = [&](size_t i, size_t j) -> unsigned char & { return beads[i * max + j]; };
+
+    // 标记珠子
+    for (size_t i = 0; i < len; i++)
+        for (size_t j = 0; j < size_t(a[i]); j++) bead(i, j) = 1;  // 在对应位置标记珠子
+
+    for (size_t j = 0; j < max; j++) {
+        // 计算每根柱子上的珠子数量
+        size_t sum = 0;
+        for (size_t i = 0; i < len; i++) {
+            sum += bead(i, j);  // 统计珠子数
+            bead(i, j) = 0;     // 将当前珠子位置重置为0
+        }
+
+        // 将珠子向下移动
+        for (size_t i = len - sum; i < len; i++) bead(i, j) = 1;  // 在底部放置珠子
+    }
+
+    // 使用珠子将排序后的值放入数组中
+    for (size_t i = 0; i < len; i++) {
+        size_t j;
+        for (j = 0; j < max && bead(i, j); j++) {
+            // 统计珠子数
+        }
+
+        a[i] = T(j);  // 将珠子数量赋值回原数组
+    }
+}
+}  // namespace bead_sort
+}  // namespace sorting
@@ -0,0 +1,81 @@
+/**
+ * @file bitonic_sort.h
+ * @brief [Bitonic 排序](https://en.wikipedia.org/wiki/Bitonic_sorter) 的实现
+ * @details
+ * 来源：https://www.geeksforgeeks.org/bitonic-sort/
+ *
+ * 先把前半部分按相反方向、后半部分按目标方向递归排序，得到一个 Bitonic 序列，
+ * 再用 bitonicMerge 把它合并成有序序列。比较-交换的位置与数据无关，
+ * 所以同样的结构也可以直接展开成排序网络（见 `sorting_network.h`）。
+ *
+ * bitonicMerge 以小于 cnt 的最大的 2 的幂为跨度，前一半按相反方向排序，
+ * 所以长度不必是 2 的幂（见 Lang 的 "Bitonic sorting network for n not a power of 2"）。
+ *
+ * 时间复杂度 \f$O(n \log^2 n)\f$，额外空间 \f$O(\log n)\f$（递归栈）。
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <utility>  /// 用于 std::swap
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace bitonic_sort
+ * @brief Bitonic 排序的实现函数
+ */
+namespace bitonic_sort {
+/**
+ * @brief 参数 dir 表示排序方向，升序（1）或降序（0）；
+ * 如果 (a[i] > a[j]) 与方向一致，则交换 a[i] 和 a[j]。
+ */
+template <typename T>
+void compAndSwap(T a[], size_t i, size_t j, bool dir) {
+    if (dir == (a[j] < a[i])) {
+        std::swap(a[i], a[j]);
+    }
+}
+
+/**
+ * @brief 按 dir 方向合并从 low 开始、长度为 cnt 的 Bitonic 序列
+ */
+template <typename T>
+void bitonicMerge(T a[], size_t low, size_t cnt, bool dir) {
+    if (cnt > 1) {
+        size_t k = 1;  // 小于 cnt 的最大的 2 的幂
+        while (k * 2 < cnt) {
+            k *= 2;
+        }
+        for (size_t i = low; i < low + cnt - k; i++) {
+            compAndSwap(a, i, i + k, dir);
+        }
+        bitonicMerge(a, low, k, dir);
+        bitonicMerge(a, low + k, cnt - k, dir);
+    }
+}
+
+/**
+ * @brief 把前半部分按相反方向、后半部分按 dir 方向排序，得到 Bitonic 序列后合并
+ */
+template <typename T>
+void bitonicSort(T a[], size_t low, size_t cnt, bool dir) {
+    if (cnt > 1) {
+        size_t k = cnt / 2;
+        bitonicSort(a, low, k, !dir);
+        bitonicSort(a, low + k, cnt - k, dir);
+        bitonicMerge(a, low, cnt, dir);
+    }
+}
+
+/**
+ * @brief 对长度为 N 的数组排序，up 为 true 时升序
+ */
+template <typename T>
+void sort(T a[], size_t N, bool up = true) {
+    bitonicSort(a, 0, N, up);
+}
+}  // namespace bitonic_sort
+}  // namespace sorting
@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief [Bogosort 算法的实现](https://en.wikipedia.org/wiki/Bogosort)
+ * @brief [Bogosort 算法](https://en.wikipedia.org/wiki/Bogosort)的测试，实现见 `bogosort.h`
  *
  * @details
  *      在计算机科学中，bogosort（也称为排列排序、傻排序、慢排序、散弹排序、随机排序、猴子排序、bobosort 或洗牌排序）是一种极其低效的排序算法，基于生成与测试的范式。该算法有两种版本：一个是确定性版本，它会枚举所有排列，直到找到一个已排序的排列；另一个是随机版本，它随机排列输入。这里实现的是随机版本。
@@ -16,48 +16,7 @@
 #include <cassert>
 #include <random>
 
-
-/**
- * @namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-
-/**
- * 用于洗牌数组中元素的函数。（供参考）
- * @tparam T 数组的类型
- * @tparam N 数组的长度
- * @param arr 要洗牌的数组
- * @returns 洗牌后的新数组
- */
-template <typename T, size_t N>
-std::array <T, N> shuffle (std::array <T, N> arr) {
-    for (int i = 0; i < N; i++) {
-        // 将第 i 个索引的元素与一个随机索引（小于数组大小）交换
-        std::swap(arr[i], arr[std::rand() % N]);
-    }
-    return arr;
-}
-
-/**
- * 实现随机化的 Bogosort 算法并对给定数组中的元素进行排序。
- * @tparam T 数组的类型
- * @tparam N 数组的长度
- * @param arr 要排序的数组
- * @returns 排序后的新数组
- */
-template <typename T, size_t N>
-std::array <T, N> randomized_bogosort (std::array <T, N> arr) {
-    // 直到数组排序完成
-    std::random_device random_device; // 获取随机设备
-    std::mt19937 generator(random_device()); // 生成随机数生成器
-    while (!std::is_sorted(arr.begin(), arr.end())) {
-        std::shuffle(arr.begin(), arr.end(), generator); // 使用随机生成器对数组进行洗牌
-    }
-    return arr;
-}
-
-}  // namespace sorting
+#include "./bogosort.h"
 
 /**
  * 显示数组的函数
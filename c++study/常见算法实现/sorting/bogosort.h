@@ -0,0 +1,77 @@
+/**
+ * @file bogosort.h
+ * @brief [Bogosort 算法的实现](https://en.wikipedia.org/wiki/Bogosort)
+ *
+ * @details
+ *      在计算机科学中，bogosort（也称为排列排序、傻排序、慢排序、散弹排序、随机排序、猴子排序、bobosort 或洗牌排序）是一种极其低效的排序算法，基于生成与测试的范式。该算法有两种版本：一个是确定性版本，它会枚举所有排列，直到找到一个已排序的排列；另一个是随机版本，它随机排列输入。这里实现的是随机版本。
+ *
+ * ### 算法
+ * 一直随机打乱数组，直到数组被排序。
+ *
+ * @author [Deep Raval](https://github.com/imdeep2905)
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::is_sorted, std::shuffle
+#include <array>      /// 用于 std::array
+#include <cstddef>    /// 用于 size_t
+#include <cstdlib>    /// 用于 std::rand
+#include <random>     /// 用于 std::mt19937
+#include <utility>    /// 用于 std::swap
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+
+/**
+ * 用于洗牌数组中元素的函数。（供参考）
+ * @tparam T 数组的类型
+ * @tparam N 数组的长度
+ * @param arr 要洗牌的数组
+ * @returns 洗牌后的新数组
+ */
+template <typename T, size_t N>
+std::array <T, N> shuffle (std::array <T, N> arr) {
+    for (size_t i = 0; i < N; i++) {
+        // 将第 i 个索引的元素与一个随机索引（小于数组大小）交换
+        std::swap(arr[i], arr[std::rand() % N]);
+    }
+    return arr;
+}
+
+/**
+ * 实现随机化的 Bogosort 算法并对给定数组中的元素进行排序。
+ * @tparam T 数组的类型
+ * @tparam N 数组的长度
+ * @param arr 要排序的数组
+ * @returns 排序后的新数组
+ */
+template <typename T, size_t N>
+std::array <T, N> randomized_bogosort (std::array <T, N> arr) {
+    // 直到数组排序完成
+    std::random_device random_device; // 获取随机设备
+    std::mt19937 generator(random_device()); // 生成随机数生成器
+    while (!std::is_sorted(arr.begin(), arr.end())) {
+        std::shuffle(arr.begin(), arr.end(), generator); // 使用随机生成器对数组进行洗牌
+    }
+    return arr;
+}
+
+/**
+ * 原地对 std::vector 做随机 Bogosort，期望洗牌 \f$n!\f$ 次，只能用于很小的数组
+ * @tparam T 元素类型
+ * @param arr 要排序的数组
+ */
+template <typename T>
+void bogosort(std::vector<T> *arr) {
+    std::random_device random_device;
+    std::mt19937 generator(random_device());
+    while (!std::is_sorted(arr->begin(), arr->end())) {
+        std::shuffle(arr->begin(), arr->end(), generator);
+    }
+}
+
+}  // namespace sorting
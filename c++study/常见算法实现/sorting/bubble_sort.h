@@ -0,0 +1,66 @@
+/**
+ * @file bubble_sort.h
+ * @brief [冒泡排序](https://en.wikipedia.org/wiki/Bubble_sort) 的迭代与递归实现
+ * @details
+ * 每一轮比较相邻元素并把较大的交换到后面，最大的元素像气泡一样“冒”到末尾。
+ * 迭代版本在一轮没有发生交换时提前结束，所以最好情况（已经有序）是 \f$O(n)\f$；
+ * 递归版本每次递归固定最后一个元素，递归深度为 \f$n\f$。
+ * 两者平均与最差情况的时间复杂度都是 \f$O(n^2)\f$。
+ */
+#pragma once
+
+#include <cstdint>  /// 用于 uint64_t
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief 带提前结束的冒泡排序
+ * @tparam T 数组中元素的数据类型
+ * @param nums 要排序的数组
+ */
+template <typename T>
+void bubble_sort(std::vector<T> *nums) {
+    const size_t n = nums->size();
+    bool swap_check = true;  // 用来标记上一轮是否进行过交换
+    for (size_t i = 0; i < n && swap_check; i++) {
+        swap_check = false;
+        for (size_t j = 0; j + 1 < n - i; j++) {  // 每一轮“冒泡”出一个最大值
+            if ((*nums)[j + 1] < (*nums)[j]) {
+                swap_check = true;
+                std::swap((*nums)[j], (*nums)[j + 1]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 递归冒泡排序算法的实现。函数接受一个数组，并通过递归进行排序。
+ *        该函数还接受第二个参数 `n`，它表示数组的大小。
+ *
+ * @tparam T 数组中元素的数据类型
+ * @param nums 指向元素数组的指针。
+ * @param n 数组的大小
+ */
+template <typename T>
+void recursive_bubble_sort(std::vector<T> *nums, uint64_t n) {
+    if (n <= 1) {  //!< 基本情况，当数组的大小不超过1时直接返回
+        return;
+    }
+
+    // 遍历整个数组
+    for (uint64_t i = 0; i < n - 1; i++) {
+        //!< 如果当前数字比下一个数字大，则交换它们的位置
+        if ((*nums)[i + 1] < (*nums)[i]) {
+            std::swap((*nums)[i], (*nums)[i + 1]);
+        }
+    }
+
+    //!< 递归调用，在每次递归后固定一个元素（即排好序的最后一个元素）
+    recursive_bubble_sort(nums, n - 1);
+}
+}  // namespace sorting
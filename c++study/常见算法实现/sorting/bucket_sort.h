@@ -0,0 +1,64 @@
+/**
+ * @file bucket_sort.h
+ * @brief [桶排序（Bucket Sort）](https://en.wikipedia.org/wiki/Bucket_sort) 的实现
+ * @details
+ * 1. 创建 n 个空桶；
+ * 2. 按值在 [min, max] 中的相对位置把元素分配到桶中，不要求元素在 [0, 1) 范围内；
+ * 3. 对每个桶内的元素排序；
+ * 4. 按桶的顺序把元素合并回原数组。
+ *
+ * 输入均匀分布时期望时间 \f$O(n)\f$，额外空间 \f$O(n)\f$。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::sort, std::minmax_element
+#include <cstddef>    /// 用于 size_t
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace bucket_sort
+ * @brief 桶排序的实现函数
+ */
+namespace bucket_sort {
+/**
+ * @brief 使用桶排序算法对数组 arr[] 进行排序，数组大小为 n
+ * @tparam T 算术类型
+ */
+template <typename T>
+void bucketSort(T arr[], size_t n) {
+    if (n < 2) {
+        return;
+    }
+    auto [lo, hi] = std::minmax_element(arr, arr + n);
+    const double min = double(*lo);
+    const double range = double(*hi) - min;
+    if (!(range > 0)) {
+        return;  // 所有元素相等
+    }
+
+    // 1) 创建 n 个空桶
+    std::vector<std::vector<T>> b(n);
+
+    // 2) 将数组元素分配到不同的桶中，桶号随值单调不减
+    for (size_t i = 0; i < n; i++) {
+        size_t bi = std::min(n - 1, size_t((double(arr[i]) - min) / range * double(n - 1)));
+        b[bi].push_back(arr[i]);
+    }
+
+    // 3) 对每个桶内的元素进行排序
+    for (size_t i = 0; i < n; i++) {
+        std::sort(b[i].begin(), b[i].end());
+    }
+
+    // 4) 将所有桶中的元素合并到原数组 arr[] 中
+    size_t index = 0;
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < b[i].size(); j++) arr[index++] = b[i][j];
+}
+}  // namespace bucket_sort
+}  // namespace sorting
@@ -0,0 +1,86 @@
+/**
+ *
+ * \file comb_sort.h
+ * \brief [Comb Sort算法](https://en.wikipedia.org/wiki/Comb_sort)
+ *
+ * \author
+ *
+ * \details
+ * - 是冒泡排序算法的改进版本
+ * - 冒泡排序比较相邻元素，而Comb Sort使用大于1的间隔（gap）
+ * - 最佳时间复杂度：O(n)
+ *   最坏时间复杂度：O(n^2)
+ *
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::max
+#include <cstddef>    /// 用于 size_t
+#include <utility>    /// 用于 std::swap
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace comb_sort
+ * @brief Comb Sort 的实现函数
+ */
+namespace comb_sort {
+/**
+ *
+ * 通过将当前gap缩小1.3倍来计算下一个gap
+ * @param gap 当前gap
+ * @return 新的gap
+ *
+ */
+inline size_t FindNextGap(size_t gap) {
+    gap = (gap * 10) / 13;  // 按照1.3的缩小因子计算新的gap
+
+    // 返回gap，确保gap不小于1
+    return std::max<size_t>(1, gap);
+}
+
+/** 
+ * CombSort排序函数
+ *
+ * @param arr 需要排序的数组
+ * @param l 数组的起始索引
+ * @param r 数组的结束索引（不含）
+ *
+ */
+template <typename T>
+void CombSort(T *arr, size_t l, size_t r) {
+    if (r - l < 2) {  // size_t 下 r - gap 不能回绕
+        return;
+    }
+    /**
+     *
+     * 初始gap设置为数组的最大值，即r，避免传递数组大小n的参数，使用r来初始化gap。
+     *
+     */
+    size_t gap = r;  // 设置初始gap为数组的大小
+
+    // 初始化swapped为true，确保循环运行
+    bool swapped = true;
+
+    // 只要gap不等于1，或者有元素被交换，就继续运行
+    while (gap != 1 || swapped) {
+        // 计算下一个gap
+        gap = FindNextGap(gap);
+
+        // 设置swapped为false，表示没有元素被交换
+        swapped = false;
+
+        // 使用当前gap比较所有元素
+        for (size_t i = l; i < r - gap; ++i) {
+            if (arr[i + gap] < arr[i]) {
+                std::swap(arr[i], arr[i + gap]);  // 交换元素
+                swapped = true;  // 标记为已交换
+            }
+        }
+    }
+}
+}  // namespace comb_sort
+}  // namespace sorting
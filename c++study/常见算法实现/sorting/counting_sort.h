@@ -0,0 +1,80 @@
+/**
+ * @file counting_sort.h
+ * @brief [计数排序（Counting Sort）](https://en.wikipedia.org/wiki/Counting_sort) 的实现
+ * @details
+ * 统计每个取值出现的次数，求前缀和得到每个取值在输出中的结束位置，再从后往前把元素放到输出中（稳定）。
+ * 时间 \f$O(n + k)\f$，额外空间 \f$O(n + k)\f$，k 是取值范围的大小，只适合值域较小的整数。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::minmax_element
+#include <cstddef>    /// 用于 size_t
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace counting_sort
+ * @brief 计数排序的实现函数
+ */
+namespace counting_sort {
+/**
+ * @brief 对整数数组做计数排序，计数数组的大小是 max - min + 1
+ * @tparam T 整数类型
+ * @param arr 要排序的数组
+ */
+template <typename T>
+void counting_sort(std::vector<T> *arr) {
+    if (arr->size() < 2) {
+        return;
+    }
+    auto [lo, hi] = std::minmax_element(arr->begin(), arr->end());
+    const T min = *lo;
+    std::vector<size_t> count(size_t(*hi - min) + 1, 0);
+
+    // 统计每个值的出现次数，再求前缀和，count[v] 表示不大于 v 的元素个数
+    for (const T &x : *arr) ++count[size_t(x - min)];
+    for (size_t i = 1; i < count.size(); ++i) count[i] += count[i - 1];
+
+    // 反向填充输出数组，保持稳定
+    std::vector<T> output(arr->size());
+    for (size_t i = arr->size(); i-- > 0;) {
+        output[--count[size_t((*arr)[i] - min)]] = (*arr)[i];
+    }
+    arr->swap(output);
+}
+
+/**
+ * @brief 计数排序函数，返回排序后的字符串
+ * @param arr 输入字符串
+ * @returns 排序后的字符串
+ */
+inline std::string countSort(std::string arr) {
+    std::string output(arr.size(), '\0');  // 用于存储排序后的字符串，长度与输入相同
+
+    size_t count[256] = {};  // 假设字符集为 ASCII，最多有 256 个不同字符
+    size_t i;
+
+    // 统计字符串中每个字符的出现次数
+    for (i = 0; arr[i]; ++i) ++count[(unsigned char)arr[i]];
+
+    // 计算每个字符的累计频率，count[i] 表示小于等于字符 i 的字符数量
+    for (i = 1; i < 256; ++i) count[i] += count[i - 1];
+
+    // 反向填充输出数组，根据字符的累计频率
+    for (i = 0; arr[i]; ++i) {
+        output[count[(unsigned char)arr[i]] - 1] = arr[i];  // 将当前字符放到正确的位置
+        --count[(unsigned char)arr[i]];  // 更新字符的计数
+    }
+
+    // 将排序后的结果复制回原始数组
+    for (i = 0; arr[i]; ++i) arr[i] = output[i];
+
+    return arr;
+}
+}  // namespace counting_sort
+}  // namespace sorting
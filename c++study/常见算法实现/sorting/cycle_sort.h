@@ -0,0 +1,86 @@
+/**
+ * @file cycle_sort.h
+ * @brief 实现 [Cycle Sort](https://en.wikipedia.org/wiki/Cycle_sort) 算法
+ * @details
+ * Cycle Sort 是一种排序算法，它在最好情况下时间复杂度为 \f$O(n^2)\f$，在最坏情况下也是 \f$O(n^2)\f$。
+ * 如果一个元素已经在正确的位置上，就不做任何操作。如果元素不在正确的位置上，我们需要通过计算正确的位置
+ * 将其移到正确的位置。需要注意处理重复元素。
+ * @author [TsungHan Ho](https://github.com/dalaoqi)
+ */
+#pragma once
+
+#include <cstddef>  /// 引入 size_t
+#include <utility>  /// 引入 std::swap
+#include <vector>   /// 引入 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace cycle_sort
+ * @brief [Cycle Sort](https://en.wikipedia.org/wiki/Cycle_sort) 算法相关的函数
+ */
+namespace cycle_sort {
+
+/**
+ * @brief 原地 Cycle Sort：每个元素最多被写一次
+ * @tparam T 数组元素的类型
+ * @param arr 需要排序的数组
+ */
+template <typename T>
+void cycle_sort(std::vector<T> *arr_ptr) {
+    std::vector<T> &arr = *arr_ptr;
+    for (size_t cycle_start = 0; cycle_start + 1 < arr.size(); cycle_start++) {
+        // 初始化元素
+        T item = arr[cycle_start];
+
+        // 计算比当前元素小的元素的个数，这个数字就是当前元素的正确位置
+        size_t pos = cycle_start;
+        for (size_t i = cycle_start + 1; i < arr.size(); i++) {
+            if (arr[i] < item) {
+                pos++;  // 统计比当前元素小的个数
+            }
+        }
+
+        // 如果元素已经在正确的位置，则跳过
+        if (pos == cycle_start) {
+            continue;
+        }
+
+        // 处理重复元素
+        while (item == arr[pos]) pos += 1;
+        std::swap(item, arr[pos]);  // 将元素交换到其正确位置
+
+        // 处理剩余的元素
+        while (pos != cycle_start) {
+            pos = cycle_start;
+            // 计算当前元素的正确位置
+            for (size_t i = cycle_start + 1; i < arr.size(); i++) {
+                if (arr[i] < item) {
+                    pos += 1;
+                }
+            }
+
+            // 处理重复元素（arr[cycle_start] 是这个环空出来的位置，不能跳过）
+            while (pos != cycle_start && item == arr[pos]) pos += 1;
+            std::swap(item, arr[pos]);  // 将元素交换到正确位置
+        }
+    }
+}
+
+/**
+ * @brief 实现 Cycle Sort 算法的主函数
+ * @tparam T 数组元素的类型
+ * @param in_arr 需要排序的数组
+ * @returns 排序后的数组
+ */
+template <typename T>
+std::vector<T> cycleSort(const std::vector<T> &in_arr) {
+    std::vector<T> arr(in_arr);  // 创建一个副本用于排序
+    cycle_sort(&arr);
+    return arr;
+}
+}  // namespace cycle_sort
+}  // namespace sorting
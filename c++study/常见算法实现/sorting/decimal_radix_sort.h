@@ -0,0 +1,132 @@
+/**
+ * @file decimal_radix_sort.h
+ * @brief 按十进制位进行的 [基数排序](https://en.wikipedia.org/wiki/Radix_sort)
+ * @details
+ * 从最低位到最高位，每一轮按当前十进制位做一次稳定排序，d 轮之后整个数组有序，
+ * 其中 d 是最大元素的十进制位数。只适用于非负整数。
+ *
+ * - radixsort：每一轮对 0~9 的每个数字各扫描一遍数组，把该位等于这个数字的元素依次取出，O(10·d·n)；
+ * - radix_sort::radix：每一轮用计数排序（`step_ith`）按当前位分配，O(d·(n + 10))。
+ *
+ * 位权用整数累乘得到，不经过浮点的 `pow`；最大值接近 uint64_t 上限时，位权乘 10 之前先检查，避免溢出。
+ * 按 8 位一组、针对 uint64_t 优化过的版本见 `lsd_radix_sort.h`。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::max_element
+#include <cstddef>    /// 用于 size_t
+#include <cstdint>    /// 用于 uint64_t
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法集合
+ */
+namespace sorting {
+/**
+ * @brief 基数排序函数，对非负整数数组 a[0..n) 排序
+ */
+template <typename T>
+void radixsort(T a[], int n) {
+    std::vector<T> output(n > 0 ? n : 0);  // 临时数组用于存储排序后的数组
+
+    T max = 0;  // 用于记录数组中的最大值
+    // 找出数组中的最大值
+    for (int i = 0; i < n; ++i) {
+        if (max < a[i]) {
+            max = a[i];
+        }
+    }
+
+    int maxdigits = 0;  // 最大值的位数
+    // 计算最大值的位数
+    while (max) {
+        maxdigits++;
+        max /= 10;
+    }
+
+    // 对每一位进行排序（从低位到高位），t 是当前位的权值
+    uint64_t t = 1;
+    for (int j = 0; j < maxdigits; j++) {
+        int k = 0;  // 用于将排序结果存放到 output 数组中
+        // 依次取出当前位等于 0, 1, ..., 9 的数字，保持原来的相对顺序
+        for (uint64_t p = 0; p < 10; p++) {
+            for (int i = 0; i < n; i++) {
+                if ((uint64_t(a[i]) / t) % 10 == p) {
+                    output[k] = a[i];  // 将符合条件的数字放入 output 数组
+                    k++;
+                }
+            }
+        }
+
+        // 将排序后的结果复制回原数组
+        for (int i = 0; i < n; ++i) {
+            a[i] = output[i];
+        }
+
+        if (j + 1 < maxdigits) {  // 最高位之后不再乘 10，避免溢出
+            t *= 10;
+        }
+    }
+}
+
+/**
+ * @namespace radix_sort
+ * @brief [基数排序](https://en.wikipedia.org/wiki/Radix_sort)算法相关函数
+ */
+namespace radix_sort {
+/**
+ * @brief 根据当前位进行排序，使用稳定排序方法。
+ * @param cur_digit - 当前位的权值（1, 10, 100, ...），用于按照该位进行排序
+ * @param ar - 需要排序的向量
+ * @returns 排序后到当前位的结果
+ */
+inline std::vector<uint64_t> step_ith(uint64_t cur_digit,
+                                      const std::vector<uint64_t> &ar) {
+    size_t n = ar.size();                 // 获取数组大小
+    std::vector<size_t> position(10, 0);  // 位置数组，用于存储每个数字（0-9）出现的频率
+    // 统计每个数字在当前位的出现频率
+    for (size_t i = 0; i < n; ++i) {
+        position[(ar[i] / cur_digit) % 10]++;  // 获取当前位的值，并更新频率
+    }
+
+    size_t cur = 0;
+    // 计算每个数字（0-9）在当前位置的起始位置
+    for (int i = 0; i < 10; ++i) {
+        size_t a = position[i];
+        position[i] = cur;  // 记录每个数字的起始位置
+        cur += a;           // 更新当前位的起始位置
+    }
+
+    std::vector<uint64_t> temp(n);  // 临时数组，用于存储排序后的元素
+    // 根据当前位的值将元素放入正确的位置
+    for (size_t i = 0; i < n; ++i) {
+        temp[position[(ar[i] / cur_digit) % 10]++] = ar[i];  // 将元素放入正确的桶中
+    }
+
+    return temp;  // 返回根据当前位排序后的数组
+}
+
+/**
+ * @brief 根据每一位进行基数排序。
+ * @param ar - 需要排序的向量
+ * @returns 排序后的向量
+ */
+inline std::vector<uint64_t> radix(const std::vector<uint64_t> &ar) {
+    if (ar.empty()) {
+        return ar;
+    }
+    uint64_t max_ele = *std::max_element(ar.begin(), ar.end());  // 获取数组中的最大元素
+    std::vector<uint64_t> temp = ar;  // 临时数组用于排序
+
+    // 根据每一位进行排序，直到最大元素的位数
+    for (uint64_t i = 1; max_ele / i > 0; i *= 10) {
+        temp = step_ith(i, temp);  // 根据当前位排序
+        if (i > max_ele / 10) {    // 已经是最高位，i 再乘 10 可能溢出
+            break;
+        }
+    }
+    return temp;  // 返回最终排序后的数组
+}
+}  // namespace radix_sort
+}  // namespace sorting
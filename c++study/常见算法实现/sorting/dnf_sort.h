@@ -0,0 +1,71 @@
+/**
+ * @file dnf_sort.h
+ * @brief [DNF 排序](https://www.geeksforgeeks.org/sort-an-array-of-0s-1s-and-2s/) 算法的实现
+ * @details
+ * 在一次遍历中对只包含 0、1 和 2 的数组进行排序（荷兰国旗问题）。
+ * [0, lo) 是 0，[lo, mid) 是 1，[hi, n) 是 2，[mid, hi) 尚未处理。
+ * 由于只有一次遍历，因此其时间复杂度为 O(n)。
+ * @author [Sujal Gupta](https://github.com/heysujal)
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace dnf_sort
+ * @brief [DNF 排序](https://en.wikipedia.org/wiki/Dutch_national_flag_problem) 算法实现
+ */
+namespace dnf_sort {
+/**
+ * @brief 原地 DNF 排序
+ * @tparam T 整数类型
+ * @param arr 需要排序的数组，元素只能是 0、1 或 2
+ */
+template <typename T>
+void dnf_sort(std::vector<T> *arr) {
+    size_t lo = 0;            // 0 的边界
+    size_t mid = 0;           // 1 的边界
+    size_t hi = arr->size();  // 2 的边界（不含）
+
+    // 进行排序，直到所有元素都在正确的位置
+    while (mid < hi) {
+        switch ((*arr)[mid]) {
+            // 如果当前元素是 0：与 lo 位置交换，并移动 lo 和 mid
+            case 0:
+                std::swap((*arr)[lo++], (*arr)[mid++]);
+                break;
+
+            // 如果当前元素是 1：已经在正确的位置，直接向后移动
+            case 1:
+                mid++;
+                break;
+
+            // 如果当前元素是 2：与 hi 前面的位置交换，交换过来的元素还要再检查
+            case 2:
+                std::swap((*arr)[mid], (*arr)[--hi]);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief 主函数实现 DNF 排序
+ * @tparam T 数组的类型
+ * @param in_arr 需要排序的数组
+ * @returns 排序后的数组
+ */
+template <typename T>
+std::vector<T> dnfSort(const std::vector<T> &in_arr) {
+    std::vector<T> arr(in_arr);  // 创建数组副本，以免修改原始数组
+    dnf_sort(&arr);
+    return arr;  // 返回排序后的数组
+}
+}  // namespace dnf_sort
+}  // namespace sorting
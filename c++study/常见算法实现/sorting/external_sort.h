@@ -0,0 +1,494 @@
+/**
+ * @file external_sort.h
+ * @brief [外部归并排序](https://en.wikipedia.org/wiki/External_sorting)：对大于内存的定长记录文件排序
+ * @details
+ * 输入文件由连续的定长记录（可平凡复制的类型 T）组成，排序分两个阶段：
+ *
+ * 1. **生成有序 run**：每次按内存预算读入尽可能多的记录，在内存中排序后写到临时目录。
+ *    按整数/浮点键排序时使用 `lsd_radix_sort.h`（本仓库中最快的内存排序），
+ *    使用一般比较函数时使用 `parallel_merge_sort.h`（稳定、可多线程）；
+ * 2. **k 路归并**：用 `parallel_merge_sort.h` 中的败者树合并所有 run。每个 run 的读取和
+ *    输出的写入都是双缓冲的：消费一个缓冲区时，后台线程已经在读（写）另一个缓冲区。
+ *    run 的数量超过内存能容纳的路数时，先分组合并成更少、更长的 run，再做最后一轮。
+ *
+ * 输入可以用 `std::fread` 读取，也可以（在 POSIX 系统上）用 `mmap` 映射后直接读取。
+ * 内存预算、临时目录、I/O 缓冲区大小和排序线程数都可以通过 `config` 配置。
+ * 出错时抛出 `std::runtime_error`。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::max
+#include <chrono>       /// 用于生成临时文件名
+#include <cstdio>       /// 用于 std::FILE, std::fread, std::fwrite
+#include <cstring>      /// 用于 std::memcpy
+#include <filesystem>   /// 用于 std::filesystem::temp_directory_path
+#include <functional>   /// 用于 std::less
+#include <future>       /// 用于 std::async, std::future
+#include <memory>       /// 用于 std::unique_ptr
+#include <set>          /// 用于 std::set
+#include <stdexcept>    /// 用于 std::runtime_error
+#include <string>       /// 用于 std::string
+#include <type_traits>  /// 用于 std::is_trivially_copyable
+#include <utility>      /// 用于 std::swap
+#include <vector>       /// 用于 std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>     /// 用于 open
+#include <sys/mman.h>  /// 用于 mmap
+#include <sys/stat.h>  /// 用于 fstat
+#include <unistd.h>    /// 用于 close
+#define EXTERNAL_SORT_HAS_MMAP 1
+#endif
+
+#include "./lsd_radix_sort.h"
+#include "./parallel_merge_sort.h"
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace external_sort
+ * @brief 外部归并排序
+ */
+namespace external_sort {
+/**
+ * @brief 外部排序的配置
+ */
+struct config {
+    size_t memory_budget = size_t(256) << 20;  ///< 排序可使用的内存（字节）
+    std::string temp_dir;                      ///< 临时目录，为空时使用系统临时目录
+    size_t io_buffer_bytes = size_t(1) << 20;  ///< 归并时每个缓冲区的最大字节数
+    size_t num_threads = 1;                    ///< 生成 run 时的排序线程数
+    bool use_mmap = false;                     ///< 是否用 mmap 读取输入（仅 POSIX）
+};
+
+/**
+ * @brief 排序过程的统计信息
+ */
+struct stats {
+    size_t records = 0;       ///< 记录总数
+    size_t initial_runs = 0;  ///< 第一阶段生成的 run 个数
+    size_t merge_passes = 0;  ///< 归并的轮数（包括最后一轮）
+};
+
+/**
+ * @brief 打开文件，失败时抛出异常
+ */
+inline std::FILE *open_file(const std::string &path, const char *mode) {
+    std::FILE *f = std::fopen(path.c_str(), mode);
+    if (f == nullptr) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+    return f;
+}
+
+/**
+ * @brief 用 fread 顺序读取记录的输入源
+ */
+template <typename T>
+class file_source {
+ public:
+    explicit file_source(const std::string &path) : f_(open_file(path, "rb")) {}
+    ~file_source() { std::fclose(f_); }
+    file_source(const file_source &) = delete;
+    file_source &operator=(const file_source &) = delete;
+
+    /**
+     * @brief 读取至多 max 条记录，返回实际读取的条数，0 表示结束
+     * @details 按字节读取：按记录读取时 fread 只统计完整的记录，末尾不完整的记录会被悄悄丢掉
+     */
+    size_t read(T *out, size_t max) {
+        size_t bytes = std::fread(static_cast<void *>(out), 1, max * sizeof(T), f_);
+        if (bytes < max * sizeof(T) && std::ferror(f_)) {
+            throw std::runtime_error("读取输入文件失败");
+        }
+        if (bytes % sizeof(T) != 0) {
+            throw std::runtime_error("输入文件大小不是记录大小的整数倍");
+        }
+        return bytes / sizeof(T);
+    }
+
+ private:
+    std::FILE *f_;
+};
+
+#ifdef EXTERNAL_SORT_HAS_MMAP
+/**
+ * @brief 用 mmap 映射整个输入文件的输入源，读取时直接从映射区复制
+ */
+template <typename T>
+class mmap_source {
+ public:
+    explicit mmap_source(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("无法打开文件: " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("无法获取文件大小: " + path);
+        }
+        size_ = size_t(st.st_size);
+        if (size_ % sizeof(T) != 0) {
+            ::close(fd);
+            throw std::runtime_error("输入文件大小不是记录大小的整数倍: " + path);
+        }
+        if (size_ > 0) {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("mmap 失败: " + path);
+            }
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char *>(p);
+        }
+        ::close(fd);
+    }
+    ~mmap_source() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char *>(data_), size_);
+        }
+    }
+    mmap_source(const mmap_source &) = delete;
+    mmap_source &operator=(const mmap_source &) = delete;
+
+    /** @brief 读取至多 max 条记录，返回实际读取的条数，0 表示结束 */
+    size_t read(T *out, size_t max) {
+        size_t n = std::min(max, (size_ - pos_) / sizeof(T));
+        std::memcpy(static_cast<void *>(out), data_ + pos_, n * sizeof(T));
+        pos_ += n * sizeof(T);
+        return n;
+    }
+
+ private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+};
+#endif
+
+/**
+ * @brief 双缓冲的 run 读取器：消费当前缓冲区的同时，后台线程读取下一块
+ */
+template <typename T>
+class run_reader {
+ public:
+    run_reader(const std::string &path, size_t buffer_records)
+        : f_(open_file(path, "rb")), cur_(buffer_records), next_(buffer_records) {
+        prefetch();
+        refill();
+    }
+    ~run_reader() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+        std::fclose(f_);
+    }
+    run_reader(const run_reader &) = delete;
+    run_reader &operator=(const run_reader &) = delete;
+
+    bool empty() const { return pos_ == len_; }
+    const T &head() const { return cur_[pos_]; }
+    void pop() {
+        if (++pos_ == len_) {
+            refill();
+        }
+    }
+
+ private:
+    std::FILE *f_;
+    std::vector<T> cur_, next_;
+    size_t pos_ = 0, len_ = 0;
+    std::future<size_t> pending_;
+
+    void prefetch() {
+        std::FILE *f = f_;
+        T *dst = next_.data();
+        size_t n = next_.size();
+        pending_ = std::async(std::launch::async, [f, dst, n]() {
+            size_t got = std::fread(dst, sizeof(T), n, f);
+            if (got < n && std::ferror(f)) {
+                throw std::runtime_error("读取临时文件失败");
+            }
+            return got;
+        });
+    }
+
+    void refill() {
+        len_ = pending_.get();
+        pos_ = 0;
+        std::swap(cur_, next_);  // 交换 vector 不会移动数据，后台线程写入的正是新的 cur_
+        if (len_ > 0) {
+            prefetch();
+        }
+    }
+};
+
+/**
+ * @brief 双缓冲的记录写入器：填充当前缓冲区的同时，后台线程写出上一块
+ */
+template <typename T>
+class record_writer {
+ public:
+    record_writer(const std::string &path, size_t buffer_records)
+        : f_(open_file(path, "wb")), cur_(std::max<size_t>(buffer_records, 1)),
+          spare_(cur_.size()) {}
+    ~record_writer() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+        if (f_ != nullptr) {
+            std::fclose(f_);
+        }
+    }
+    record_writer(const record_writer &) = delete;
+    record_writer &operator=(const record_writer &) = delete;
+
+    void push(const T &x) {
+        cur_[len_++] = x;
+        if (len_ == cur_.size()) {
+            flush();
+        }
+    }
+
+    /** @brief 写出一整块连续的记录（用于写 run） */
+    void write(const T *data, size_t n) {
+        if (pending_.valid()) {
+            pending_.get();
+        }
+        if (n > 0 && std::fwrite(data, sizeof(T), n, f_) != n) {
+            throw std::runtime_error("写入文件失败");
+        }
+    }
+
+    /** @brief 写出剩余数据并关闭文件 */
+    void close() {
+        flush();
+        if (pending_.valid()) {
+            pending_.get();
+        }
+        int rc = std::fclose(f_);
+        f_ = nullptr;
+        if (rc != 0) {
+            throw std::runtime_error("关闭文件失败");
+        }
+    }
+
+ private:
+    std::FILE *f_;
+    std::vector<T> cur_, spare_;
+    size_t len_ = 0;
+    std::future<void> pending_;
+
+    void flush() {
+        if (pending_.valid()) {
+            pending_.get();
+        }
+        std::swap(cur_, spare_);
+        std::FILE *f = f_;
+        const T *src = spare_.data();
+        size_t n = len_;
+        len_ = 0;
+        pending_ = std::async(std::launch::async, [f, src, n]() {
+            if (n > 0 && std::fwrite(src, sizeof(T), n, f) != n) {
+                throw std::runtime_error("写入文件失败");
+            }
+        });
+    }
+};
+
+/**
+ * @brief 外部排序的执行过程
+ * @tparam T 记录类型，必须可平凡复制
+ * @tparam Compare 记录的比较函数
+ */
+template <typename T, typename Compare>
+class sorter {
+    static_assert(std::is_trivially_copyable<T>::value, "记录必须可平凡复制");
+
+ public:
+    sorter(const config &cfg, Compare comp) : cfg_(cfg), comp_(comp) {
+        dir_ = cfg.temp_dir.empty() ? std::filesystem::temp_directory_path().string()
+                                    : cfg.temp_dir;
+        prefix_ = "extsort_" +
+                  std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+                  "_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + "_";
+    }
+
+    /// 删除所有还存在的临时文件，包括因异常而没能进入 runs_ 的文件
+    ~sorter() {
+        for (const auto &path : temp_files_) {
+            std::remove(path.c_str());
+        }
+    }
+
+    /**
+     * @brief 执行排序
+     * @param source 输入源（file_source 或 mmap_source）
+     * @param output 输出文件路径
+     * @param sort_run 对内存中的一段记录排序的函数：sort_run(T *data, size_t n)
+     */
+    template <typename Source, typename RunSorter>
+    stats run(Source &source, const std::string &output, RunSorter sort_run) {
+        stats st;
+
+        // 第一阶段：生成有序 run
+        {
+            size_t capacity = std::max<size_t>(1, cfg_.memory_budget / (2 * sizeof(T)));
+            std::vector<T> block(capacity);
+            for (size_t n = source.read(block.data(), capacity); n > 0;
+                 n = source.read(block.data(), capacity)) {
+                sort_run(block.data(), n);
+                std::string path = new_run_path();
+                record_writer<T> w(path, 1);
+                w.write(block.data(), n);
+                w.close();
+                runs_.push_back(path);
+                st.records += n;
+            }
+        }
+        st.initial_runs = runs_.size();
+
+        // 第二阶段：分组归并，直到剩余 run 能在一轮中合并完
+        const size_t fan_in = max_fan_in();
+        while (runs_.size() > fan_in) {
+            std::vector<std::string> next;
+            for (size_t i = 0; i < runs_.size(); i += fan_in) {
+                std::vector<std::string> group(
+                    runs_.begin() + i, runs_.begin() + std::min(i + fan_in, runs_.size()));
+                std::string path = new_run_path();
+                merge(group, path);
+                for (const auto &g : group) {
+                    remove_temp(g);
+                }
+                next.push_back(path);
+            }
+            runs_.swap(next);
+            st.merge_passes++;
+        }
+        merge(runs_, output);
+        st.merge_passes++;
+        return st;
+    }
+
+ private:
+    config cfg_;
+    Compare comp_;
+    std::string dir_, prefix_;
+    std::vector<std::string> runs_;
+    std::set<std::string> temp_files_;  ///< 已分配路径、尚未删除的临时文件
+    size_t counter_ = 0;
+
+    /// 分配一个新的临时文件路径；在创建文件之前登记，写到一半抛出异常时析构函数也能删除它
+    std::string new_run_path() {
+        std::string path =
+            (std::filesystem::path(dir_) / (prefix_ + std::to_string(counter_++) + ".run")).string();
+        temp_files_.insert(path);
+        return path;
+    }
+
+    void remove_temp(const std::string &path) {
+        std::remove(path.c_str());
+        temp_files_.erase(path);
+    }
+
+    /** 每路两个缓冲区，输出两个缓冲区 */
+    size_t buffer_records(size_t k) const {
+        size_t bytes = std::min(cfg_.io_buffer_bytes, cfg_.memory_budget / (2 * (k + 1)));
+        return std::max<size_t>(1, bytes / sizeof(T));
+    }
+
+    size_t max_fan_in() const {
+        size_t k = cfg_.memory_budget / (2 * std::max<size_t>(cfg_.io_buffer_bytes, sizeof(T)));
+        return std::max<size_t>(2, k > 1 ? k - 1 : 1);
+    }
+
+    /** 用败者树把若干 run 合并到 output */
+    void merge(const std::vector<std::string> &inputs, const std::string &output) {
+        size_t records = buffer_records(inputs.size());
+        std::vector<std::unique_ptr<run_reader<T>>> readers;
+        for (const auto &path : inputs) {
+            readers.emplace_back(new run_reader<T>(path, records));
+        }
+        record_writer<T> out(output, records);
+
+        auto beats = [&readers, this](size_t a, size_t b) {
+            if (readers[a]->empty()) return false;
+            if (readers[b]->empty()) return true;
+            if (comp_(readers[b]->head(), readers[a]->head())) return false;
+            if (comp_(readers[a]->head(), readers[b]->head())) return true;
+            return a < b;
+        };
+        auto tree = parallel_merge_sort::make_loser_tree(readers.size(), beats);
+        while (!readers.empty()) {
+            size_t w = tree.winner();
+            if (readers[w]->empty()) {
+                break;
+            }
+            out.push(readers[w]->head());
+            readers[w]->pop();
+            tree.replay(w);
+        }
+        out.close();
+    }
+};
+
+/**
+ * @brief 按比较函数对定长记录文件进行外部排序（run 用并行归并排序生成，整体稳定）
+ * @param input 输入文件路径
+ * @param output 输出文件路径
+ * @param cfg 配置
+ * @param comp 比较函数
+ * @returns 统计信息
+ */
+template <typename T, typename Compare = std::less<T>>
+stats sort_file(const std::string &input, const std::string &output,
+                const config &cfg = config(), Compare comp = Compare()) {
+    sorter<T, Compare> s(cfg, comp);
+    auto sort_run = [&cfg, &comp](T *data, size_t n) {
+        parallel_merge_sort::parallel_merge_sort(data, n, cfg.num_threads, comp);
+    };
+#ifdef EXTERNAL_SORT_HAS_MMAP
+    if (cfg.use_mmap) {
+        mmap_source<T> source(input);
+        return s.run(source, output, sort_run);
+    }
+#endif
+    file_source<T> source(input);
+    return s.run(source, output, sort_run);
+}
+
+/**
+ * @brief 按整数/浮点键对定长记录文件进行外部排序（run 用 LSD 基数排序生成，整体稳定）
+ * @param input 输入文件路径
+ * @param output 输出文件路径
+ * @param cfg 配置
+ * @param key 从记录中取出整数或浮点键的函数
+ * @returns 统计信息
+ */
+template <typename T, typename KeyFn>
+stats sort_file_by_key(const std::string &input, const std::string &output,
+                       const config &cfg, KeyFn key) {
+    auto radix = [key](const T &x) { return lsd_radix_sort::radix_key(key(x)); };
+    auto comp = [radix](const T &a, const T &b) { return radix(a) < radix(b); };
+    sorter<T, decltype(comp)> s(cfg, comp);
+
+    std::vector<T> scratch;  // 基数排序的缓冲区在各个 run 之间复用
+    auto sort_run = [&scratch, radix](T *data, size_t n) {
+        scratch.resize(std::max(scratch.size(), n));
+        lsd_radix_sort::sort_by_key(data, scratch.data(), n, radix);
+    };
+#ifdef EXTERNAL_SORT_HAS_MMAP
+    if (cfg.use_mmap) {
+        mmap_source<T> source(input);
+        return s.run(source, output, sort_run);
+    }
+#endif
+    file_source<T> source(input);
+    return s.run(source, output, sort_run);
+}
+}  // namespace external_sort
+}  // namespace sorting
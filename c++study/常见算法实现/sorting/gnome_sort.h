@@ -0,0 +1,75 @@
+/**
+ * @file gnome_sort.h
+ * @brief 实现 [Gnome 排序](https://en.wikipedia.org/wiki/Gnome_sort) 算法
+ * @author [beqakd](https://github.com/beqakd)
+ * @author [Krishna Vedala](https://github.com/kvedala)
+ * @details
+ * Gnome 排序算法虽然不是最优的排序算法，但它是一个常用的排序算法。
+ * 该算法通过反复检查数组中的相邻元素对，如果它们已经按正确的顺序排列，就检查下一个元素对，否则交换它们。
+ * 这个过程不断重复，直到没有交换发生为止，这表明数组已经按升序排列。
+ * 
+ * 该算法的时间复杂度是 \f$O(n^2)\f$，在某些情况下它的时间复杂度可以是 \f$O(n)\f$。
+ */
+#pragma once
+
+#include <array>    /// 用于 std::array
+#include <cstddef>  /// 用于 size_t
+#include <utility>  /// 用于 std::swap
+
+/**
+ * @namespace sorting
+ * 排序算法
+ */
+namespace sorting {
+/**
+ * 该实现适用于 C 风格的数组输入，数组在原地修改。
+ * @param [in,out] arr 要排序的数组。
+ * @param size 数组的大小
+ */
+template <typename T>
+void gnomeSort(T *arr, size_t size) {
+    // 处理一些简单情况
+    if (size <= 1) {
+        return;
+    }
+
+    size_t index = 0;  // 初始化变量
+    while (index < size) {
+        // 检查是否需要交换
+        if ((index == 0) || !(arr[index] < arr[index - 1])) {
+            index++;  // 如果当前元素不小于前一个元素，继续移动
+        } else {
+            std::swap(arr[index], arr[index - 1]);  // 交换元素
+            index--;  // 交换后需要检查前一个元素
+        }
+    }
+}
+
+/**
+ * 该实现适用于 C++ 风格的数组输入。函数的参数是按值传递，因此会创建数组的副本，
+ * 并对副本进行修改，最后返回排序后的数组。
+ * @tparam T 数组元素的数据类型
+ * @tparam size 数组的大小
+ * @param [in] arr 要排序的数组。
+ * @return 排序后的数组
+ */
+template <typename T, size_t size>
+std::array<T, size> gnomeSort(std::array<T, size> arr) {
+    // 处理一些简单情况
+    if (size <= 1) {
+        return arr;
+    }
+
+    size_t index = 0;  // 初始化循环索引
+    while (index < size) {
+        // 检查是否需要交换
+        if ((index == 0) || !(arr[index] < arr[index - 1])) {
+            index++;  // 如果当前元素不小于前一个元素，继续移动
+        } else {
+            std::swap(arr[index], arr[index - 1]);  // 交换元素
+            index--;  // 交换后需要检查前一个元素
+        }
+    }
+    return arr;  // 返回排序后的数组
+}
+}  // namespace sorting
@@ -0,0 +1,77 @@
+/**
+ * \file heap_sort.h
+ * \brief [堆排序算法](https://en.wikipedia.org/wiki/Heapsort) 实现
+ *
+ * \author [Ayaan Khan](http://github.com/ayaankhan98)
+ *
+ * \details
+ * 堆排序是一种基于比较的排序算法。
+ * 堆排序可以被看作是改进版的选择排序：
+ * 与选择排序相似，堆排序将输入分为已排序区间和未排序区间，
+ * 每次从未排序区间中提取最大元素并将其插入已排序区间。
+ * 不同于选择排序，堆排序通过维护一个堆数据结构来高效地找到每一步中的最大元素，
+ * 而不需要在未排序区间进行线性扫描。
+ *
+ * 时间复杂度 - \f$O(n \log(n))\f$
+ *
+ */
+#pragma once
+
+#include <utility>  /// 用于 std::swap
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace heap_sort
+ * @brief 堆排序的实现函数
+ */
+namespace heap_sort {
+/**
+ * 堆化过程可以被看作是从底向上构建堆，通过不断向下筛选以满足堆的性质。
+ *
+ * @param arr 要排序的数组
+ * @param n 数组大小
+ * @param i 要比较的节点位置（在二叉树中为元素位置）
+ *
+ */
+template <typename T>
+void heapify(T *arr, int n, int i) {
+    int largest = i;           // 假设当前节点是最大值
+    int l = 2 * i + 1;         // 左子节点索引
+    int r = 2 * i + 2;         // 右子节点索引
+
+    if (l < n && arr[largest] < arr[l])  // 如果左子节点比当前节点大（只用 operator<）
+        largest = l;
+
+    if (r < n && arr[largest] < arr[r])  // 如果右子节点比当前节点大
+        largest = r;
+
+    if (largest != i) {  // 如果最大元素不是当前元素，交换并递归堆化
+        std::swap(arr[i], arr[largest]);
+        heapify(arr, n, largest);
+    }
+}
+
+/**
+ * 使用堆化过程对数组进行排序
+ *
+ * @param arr 要排序的数组
+ * @param n 数组大小
+ *
+ */
+template <typename T>
+void heapSort(T *arr, int n) {
+    // 1. 构建最大堆（从最后一个非叶子节点开始）
+    for (int i = n / 2 - 1; i >= 0; i--) heapify(arr, n, i);
+
+    // 2. 一个一个的提取元素，并重新堆化
+    for (int i = n - 1; i > 0; i--) {
+        std::swap(arr[0], arr[i]);  // 将最大元素移到数组末尾
+        heapify(arr, i, 0);         // 对剩余元素重新堆化
+    }
+}
+}  // namespace heap_sort
+}  // namespace sorting
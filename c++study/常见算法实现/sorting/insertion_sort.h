@@ -0,0 +1,115 @@
+/**
+ * @file insertion_sort.h
+ * @brief [插入排序](https://en.wikipedia.org/wiki/Insertion_sort) 与二分插入排序的实现
+ * @details
+ * 插入排序从前往后遍历数组，把每个元素插入到前面已排序部分中的正确位置，是稳定的原地排序，
+ * 对小规模或基本有序的数据很高效，时间复杂度 \f$O(n^2)\f$，已经有序时为 \f$O(n)\f$。
+ *
+ * 二分插入排序用二分查找确定插入位置，每次插入的比较次数降到 \f$\lceil \log_2 n \rceil\f$，
+ * 但移动元素仍是 \f$O(n^2)\f$，适合比较代价比移动高的情况。
+ */
+#pragma once
+
+#include <cstdint>  /// 用于 int64_t
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/** \brief
+ * 插入排序函数
+ *
+ * @tparam T 数组的类型
+ * @param [in,out] arr 要排序的数组
+ * @param n 数组的大小
+ */
+template <typename T>
+void insertionSort(T *arr, int n) {
+    for (int i = 1; i < n; i++) {  // 从数组的第二个元素开始
+        T temp = arr[i];            // 取出当前元素
+        int j = i - 1;
+        // 将当前元素与前面已排序的元素逐一比较并插入到正确的位置
+        while (j >= 0 && temp < arr[j]) {
+            arr[j + 1] = arr[j];  // 移动元素
+            j--;
+        }
+        arr[j + 1] = temp;  // 插入元素到正确的位置
+    }
+}
+
+/** 插入排序函数（针对std::vector）
+ *
+ * @tparam T 数组的类型
+ * @param [in,out] arr 指向要排序数组的指针
+ */
+template <typename T>
+void insertionSort(std::vector<T> *arr) {
+    size_t n = arr->size();  // 获取数组大小
+
+    for (size_t i = 1; i < n; i++) {  // 从第二个元素开始
+        T temp = arr->at(i);           // 获取当前元素
+        int64_t j = int64_t(i) - 1;
+        // 将当前元素与前面已排序的元素逐一比较并插入到正确的位置
+        while (j >= 0 && temp < arr->at(j)) {
+            arr->at(j + 1) = arr->at(j);  // 移动元素
+            j--;
+        }
+        arr->at(j + 1) = temp;  // 插入元素到正确的位置
+    }
+}
+
+/**
+ * \brief 二分查找函数，用于查找元素的合适位置。
+ * \tparam T 泛型数据类型。
+ * \param arr 要搜索的实际向量。
+ * \param val 需要找到合适位置的值。
+ * \param low 搜索范围的下界。
+ * \param high 搜索范围的上界。
+ * \returns 返回值 val 在 arr 中的合适位置索引。
+ */
+template <class T>
+int64_t binary_search(std::vector<T> &arr, T val, int64_t low, int64_t high) {
+    if (high <= low) {
+        // 如果 val 大于 arr[low]，则返回 low + 1，否则返回 low
+        return (arr[low] < val) ? (low + 1) : low;
+    }
+    int64_t mid = low + (high - low) / 2;  // 计算中间位置
+    if (val < arr[mid]) {
+        // 如果中间值大于 val，继续在左侧递归查找
+        return binary_search(arr, val, low, mid - 1);
+    } else if (arr[mid] < val) {
+        // 如果中间值小于 val，继续在右侧递归查找
+        return binary_search(arr, val, mid + 1, high);
+    } else {
+        // 如果值相等，返回 mid + 1
+        return mid + 1;
+    }
+}
+
+/**
+ * \brief 插入排序函数，使用二分查找来找到合适的插入位置。
+ * \tparam T 泛型数据类型。
+ * \param arr 要排序的实际向量。
+ * \returns 无返回值。
+ */
+template <typename T>
+void insertionSort_binsrch(std::vector<T> &arr) {
+    int64_t n = arr.size();  // 获取向量的大小
+
+    // 从第二个元素开始遍历
+    for (int64_t i = 1; i < n; i++) {
+        T key = arr[i];  // 当前要插入的元素
+        int64_t j = i - 1;
+        // 使用二分查找找到当前元素的插入位置
+        int64_t loc = sorting::binary_search(arr, key, 0, j);
+        // 移动元素以腾出位置
+        while (j >= loc) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;  // 插入元素到正确的位置
+    }
+}
+}  // namespace sorting
@@ -0,0 +1,229 @@
+/**
+ * @file introsort.h
+ * @brief [内省排序（Introsort）](https://en.wikipedia.org/wiki/Introsort) 的实现，
+ * 分区采用 [BlockQuicksort](https://arxiv.org/abs/1604.06697) 的无分支分块方式
+ * @details
+ * `quick_sort.h`、`random_pivot_quick_sort.h` 和 `iterative_quick_sort.h` 中的分区函数对每个元素都要做一次
+ * 带分支的比较，随机数据上分支预测失败的代价远远超过比较本身。本文件把它们统一成一个入口：
+ *
+ * 1. **无分支分块分区**：每次从左右两端各取一块（64 个元素），先只做比较，
+ *    把"放错边"的元素下标写进偏移数组（`num += !(x < pivot)`，没有条件跳转），
+ *    然后再成对交换左右两边放错的元素。
+ * 2. **基准选择**：小区间用三数取中，大区间用 ninther（三个三数取中的中位数）。
+ * 3. **重复元素**：如果前一个区间留下的元素（位于当前区间左侧）不小于基准，
+ *    说明当前区间所有元素都不小于基准，于是把等于基准的元素全部分到左边并直接跳过，
+ *    避免大量重复元素导致的退化。
+ * 4. **堆排序兜底**：递归深度超过 2*log2(n) 时改用 `heap_sort.h` 的堆排序，
+ *    保证最坏情况 \f$O(n \log n)\f$。
+ * 5. **小区间**：区间不超过 24 个元素时，算术类型用 `sorting_network.h` 的排序网络/SIMD 内核，
+ *    其它类型用插入排序。
+ *
+ * 时间复杂度：最好/平均/最坏情况均为 \f$O(n \log n)\f$，额外空间 \f$O(\log n)\f$。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min
+#include <cstddef>      /// 用于 size_t, ptrdiff_t
+#include <cstdint>      /// 用于 uint8_t
+#include <type_traits>  /// 用于 std::is_arithmetic
+#include <utility>      /// 用于 std::swap, std::move
+#include <vector>       /// 用于 std::vector
+
+#include "./heap_sort.h"
+#include "./sorting_network.h"
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace introsort
+ * @brief 内省排序的实现函数
+ */
+namespace introsort {
+constexpr int kBlockSize = 64;         ///< 分块分区中每块的元素个数
+constexpr int kInsertionCutoff = 24;   ///< 小于此规模用插入排序
+constexpr int kNintherThreshold = 128;  ///< 大于此规模用 ninther 选择基准
+
+/**
+ * @brief 对 [first, last) 进行插入排序
+ */
+template <typename T>
+void insertion_sort(T *first, T *last) {
+    for (T *i = first + 1; i < last; i++) {
+        T key = std::move(*i);
+        T *j = i;
+        while (j > first && key < *(j - 1)) {
+            *j = std::move(*(j - 1));
+            j--;
+        }
+        *j = std::move(key);
+    }
+}
+
+/**
+ * @brief 把 a、b、c 三个位置排成 *a <= *b <= *c
+ */
+template <typename T>
+void sort3(T *a, T *b, T *c) {
+    if (*b < *a) std::swap(*a, *b);
+    if (*c < *b) std::swap(*b, *c);
+    if (*b < *a) std::swap(*a, *b);
+}
+
+/**
+ * @brief 选择基准并把它放到 *first
+ * @details 小区间使用三数取中；大区间使用 ninther，即分别在首、中、尾附近取三数中位数，
+ * 再取这三个中位数的中位数，能够抵抗"管风琴"等构造输入。
+ */
+template <typename T>
+void choose_pivot(T *first, T *last) {
+    std::ptrdiff_t n = last - first;
+    T *mid = first + n / 2;
+    if (n > kNintherThreshold) {
+        sort3(first, mid, last - 1);
+        sort3(first + 1, mid - 1, last - 2);
+        sort3(first + 2, mid + 1, last - 3);
+        sort3(mid - 1, mid, mid + 1);
+        std::swap(*first, *mid);
+    } else {
+        sort3(mid, first, last - 1);  // 中位数直接落在 *first
+    }
+}
+
+/**
+ * @brief 无分支分块分区
+ * @details
+ * 以 *first 为基准，对 [first + 1, last) 分区。`equal_left` 为 false 时，
+ * 小于基准的元素放左边；为 true 时，不大于基准的元素放左边（用于跳过重复元素）。
+ *
+ * 在主循环中，`l` 左边的元素都已属于左半部分，`r` 右边的元素都已属于右半部分。
+ * 两个偏移数组分别记录左块中应去右边、右块中应去左边的元素，
+ * 记录过程只有加法没有分支，之后两两交换。剩下不超过两块的元素用普通的 Hoare 扫描收尾。
+ * @returns 基准最终所在的位置
+ */
+template <bool equal_left, typename T>
+T *block_partition(T *first, T *last) {
+    const T &pivot = *first;
+    auto goes_left = [&pivot](const T &x) {
+        return equal_left ? !(pivot < x) : x < pivot;
+    };
+
+    T *l = first + 1;
+    T *r = last;
+    uint8_t offsets_l[kBlockSize];
+    uint8_t offsets_r[kBlockSize];
+    int num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (r - l > 2 * kBlockSize) {
+        if (num_l == 0) {
+            start_l = 0;
+            for (int i = 0; i < kBlockSize; i++) {
+                offsets_l[num_l] = uint8_t(i);
+                num_l += !goes_left(l[i]);
+            }
+        }
+        if (num_r == 0) {
+            start_r = 0;
+            for (int i = 0; i < kBlockSize; i++) {
+                offsets_r[num_r] = uint8_t(i + 1);
+                num_r += goes_left(*(r - i - 1));
+            }
+        }
+
+        int num = std::min(num_l, num_r);
+        for (int k = 0; k < num; k++) {
+            std::swap(l[offsets_l[start_l + k]], *(r - offsets_r[start_r + k]));
+        }
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+        if (num_l == 0) l += kBlockSize;
+        if (num_r == 0) r -= kBlockSize;
+    }
+
+    // [l, r) 之外的元素都已就位，剩余部分直接扫描
+    while (true) {
+        while (l < r && goes_left(*l)) l++;
+        while (l < r && !goes_left(*(r - 1))) r--;
+        if (l >= r) break;
+        std::swap(*l, *(r - 1));
+        l++;
+        r--;
+    }
+
+    std::swap(*first, *(l - 1));
+    return l - 1;
+}
+
+/**
+ * @brief 内省排序主循环
+ * @param first 区间起点
+ * @param last 区间终点（不包含）
+ * @param depth 剩余的递归深度，耗尽时改用堆排序
+ * @param leftmost 区间是否位于整个数组的最左端（即左侧没有元素可用来检测重复）
+ */
+template <typename T>
+void introsort_loop(T *first, T *last, int depth, bool leftmost) {
+    while (last - first > kInsertionCutoff) {
+        if (depth == 0) {
+            heap_sort::heapSort(first, int(last - first));
+            return;
+        }
+        depth--;
+
+        choose_pivot(first, last);
+
+        // 左侧元素不小于基准：区间内所有元素都不小于基准，等于基准的部分无需再排序
+        if (!leftmost && !(*(first - 1) < *first)) {
+            first = block_partition<true>(first, last) + 1;
+            continue;
+        }
+
+        T *mid = block_partition<false>(first, last);
+
+        // 递归处理较小的一半，较大的一半留在循环中，保证栈深度为 O(log n)
+        if (mid - first < last - mid) {
+            introsort_loop(first, mid, depth, leftmost);
+            first = mid + 1;
+            leftmost = false;
+        } else {
+            introsort_loop(mid + 1, last, depth, false);
+            last = mid;
+        }
+    }
+    if constexpr (std::is_arithmetic<T>::value) {
+        sorting_network::sort_small(first, size_t(last - first));
+    } else {
+        insertion_sort(first, last);
+    }
+}
+
+/**
+ * @brief 内省排序入口
+ * @tparam T 元素类型，需要支持 `operator<`
+ * @param arr 要排序的数组
+ * @param n 数组大小
+ */
+template <typename T>
+void introsort(T *arr, size_t n) {
+    if (n < 2) {
+        return;
+    }
+    int depth = 0;
+    for (size_t k = n; k > 1; k >>= 1) depth += 2;
+    introsort_loop(arr, arr + n, depth, true);
+}
+
+/**
+ * @brief 内省排序入口（std::vector 版本）
+ * @param arr 要排序的数组
+ */
+template <typename T>
+void introsort(std::vector<T> *arr) {
+    introsort(arr->data(), arr->size());
+}
+}  // namespace introsort
+}  // namespace sorting
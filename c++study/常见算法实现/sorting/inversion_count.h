@@ -0,0 +1,259 @@
+/**
+ * @file inversion_count.h
+ * @brief 64 位、不分配内存、可并行的[逆序对](https://en.wikipedia.org/wiki/Inversion_(discrete_mathematics))计数，
+ * 以及基于树状数组的有界键版本和 [Kendall tau 距离](https://en.wikipedia.org/wiki/Kendall_tau_distance)批量接口
+ * @details
+ * `inversion_merge_sort.h` 的 `countInversion()` 返回 `uint32_t`（n 超过约 92682 时就可能溢出），
+ * 并且每层递归都在调用栈上展开、只用一个线程。这里的实现：
+ *
+ * 1. `count_inversions()`：自底向上的归并计数。先把数组切成 32 个元素的小段做插入排序，
+ *    移动次数就是段内逆序对数；之后段长逐轮翻倍，在输入数组和调用者提供的缓冲区之间来回合并。
+ *    每一轮按输出位置切成 kMergeGrain 大小的块，块边界用 merge path（见 `parallel_merge_sort.h`）求出，
+ *    块内每输出一个右半部分的元素 b[j]，就累加左半部分中尚未输出的元素个数 na - i，
+ *    因此各块的计数互不依赖，可以并行。除了线程本身，排序过程中不分配任何内存。
+ * 2. `count_inversions_bounded()`：键是 [0, max_key] 内的整数时，用 `range_queries::fenwick_tree`
+ *    从左到右统计"此前出现过的更大元素个数"，\f$O(n \log K)\f$，不修改输入。
+ * 3. `kendall_tau`：对同一组对象的两个排名，Kendall tau 距离等于把一个排名按另一个排名重新编号后的逆序对数。
+ *    参考排名的逆映射只算一次，`distance_batch()` 把很多排名与同一个参考排名比较，并复用缓冲区。
+ *
+ * 与 `countInversion()` 一致：只统计 i < j 且 a[j] < a[i] 的对，相等元素不算逆序。
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::min, std::copy
+#include <atomic>      /// 用于 std::atomic
+#include <cstddef>     /// 用于 size_t
+#include <cstdint>     /// 用于 uint32_t, uint64_t
+#include <functional>  /// 用于 std::less
+#include <utility>     /// 用于 std::swap
+#include <vector>      /// 用于 std::vector
+
+#include "../范围查询/fenwick_tree.h"
+#include "./parallel_merge_sort.h"
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace inversion
+ * @brief 逆序对计数
+ */
+namespace inversion {
+constexpr size_t kInsertionRun = 32;      ///< 初始小段的长度
+constexpr size_t kMergeGrain = 1 << 14;  ///< 每个任务负责的输出元素个数
+
+/**
+ * @brief 插入排序并返回移动次数（即段内逆序对数）
+ */
+template <typename T, typename Compare>
+uint64_t insertion_count(T *arr, size_t n, Compare comp) {
+    uint64_t count = 0;
+    for (size_t i = 1; i < n; i++) {
+        T key = arr[i];
+        size_t j = i;
+        while (j > 0 && comp(key, arr[j - 1])) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        count += i - j;
+        arr[j] = key;
+    }
+    return count;
+}
+
+/**
+ * @brief 合并 a[i0, i1) 与 b[j0, j1) 到 out，并统计其中 b 的元素跨过的 a 的元素个数
+ * @param na a 的总长度：b[j] 输出时，a[i, na) 都排在它之后
+ * @returns 本段合并贡献的逆序对数
+ */
+template <typename T, typename Compare>
+uint64_t merge_count(const T *a, size_t i0, size_t i1, size_t na, const T *b, size_t j0,
+                     size_t j1, T *out, Compare comp) {
+    uint64_t count = 0;
+    size_t i = i0, j = j0;
+    while (i < i1 && j < j1) {
+        if (comp(b[j], a[i])) {
+            count += na - i;
+            *out++ = b[j++];
+        } else {
+            *out++ = a[i++];
+        }
+    }
+    // merge path 保证 b[j, j1) 都严格小于 a[i1, na)
+    count += uint64_t(j1 - j) * (na - i);
+    out = std::copy(a + i, a + i1, out);
+    std::copy(b + j, b + j1, out);
+    return count;
+}
+
+/**
+ * @brief 统计逆序对，同时把数组排序
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数
+ * @param arr 输入数组，返回时已排序
+ * @param n 元素个数
+ * @param buffer 调用者提供的缓冲区，至少 n 个元素；可以在多次调用之间复用
+ * @param num_threads 线程数
+ * @param comp 比较函数
+ * @returns 逆序对数
+ */
+template <typename T, typename Compare = std::less<T>>
+uint64_t count_inversions(T *arr, size_t n, T *buffer, size_t num_threads,
+                          Compare comp = Compare()) {
+    using parallel_merge_sort::merge_path;
+    using parallel_merge_sort::parallel_for;
+    if (n < 2) {
+        return 0;
+    }
+    std::atomic<uint64_t> total{0};
+    const size_t num_tasks = (n + kMergeGrain - 1) / kMergeGrain;
+
+    // 第一步：小段插入排序（kMergeGrain 是 kInsertionRun 的倍数，小段不会跨任务）
+    parallel_for(num_tasks, num_threads, [&](size_t t) {
+        uint64_t count = 0;
+        size_t end = std::min(n, (t + 1) * kMergeGrain);
+        for (size_t lo = t * kMergeGrain; lo < end; lo += kInsertionRun) {
+            count += insertion_count(arr + lo, std::min(kInsertionRun, end - lo), comp);
+        }
+        total += count;
+    });
+
+    // 第二步：段长逐轮翻倍。任务 t 负责输出 [t * G, (t + 1) * G)，
+    // 2 * width >= G 时它落在一对内部，否则覆盖若干完整的对
+    T *src = arr;
+    T *dst = buffer;
+    for (size_t width = kInsertionRun; width < n; width *= 2) {
+        parallel_for(num_tasks, num_threads, [&](size_t t) {
+            uint64_t count = 0;
+            size_t begin = t * kMergeGrain;
+            size_t end = std::min(n, begin + kMergeGrain);
+            for (size_t lo = begin / (2 * width) * (2 * width); lo < end; lo += 2 * width) {
+                size_t mid = std::min(lo + width, n);
+                size_t hi = std::min(lo + 2 * width, n);
+                const T *a = src + lo;
+                const T *b = src + mid;
+                size_t na = mid - lo, nb = hi - mid;
+                size_t o0 = std::max(begin, lo) - lo, o1 = std::min(end, hi) - lo;
+                size_t i0 = merge_path(a, na, b, nb, o0, comp);
+                size_t i1 = merge_path(a, na, b, nb, o1, comp);
+                count += merge_count(a, i0, i1, na, b, o0 - i0, o1 - i1, dst + lo + o0, comp);
+            }
+            total += count;
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != arr) {
+        std::copy(src, src + n, arr);
+    }
+    return total;
+}
+
+/**
+ * @brief 统计逆序对（std::vector 版本，只分配一次缓冲区），同时把数组排序
+ */
+template <typename T, typename Compare = std::less<T>>
+uint64_t count_inversions(std::vector<T> *arr, size_t num_threads, Compare comp = Compare()) {
+    std::vector<T> buffer(arr->size());
+    return count_inversions(arr->data(), arr->size(), buffer.data(), num_threads, comp);
+}
+
+/**
+ * @brief 用树状数组统计键在 [0, max_key] 内的整数数组的逆序对，不修改输入
+ * @details 从左到右扫描，`tree.sum(k)` 是此前出现过的不大于 k 的元素个数，
+ * 因此 i - tree.sum(arr[i]) 就是此前比 arr[i] 大的元素个数。时间 \f$O(n \log K)\f$，空间 \f$O(K)\f$。
+ * @param arr 输入数组
+ * @param n 元素个数，不超过 INT32_MAX（树状数组的计数是 int）
+ * @param max_key 键的上界（含）
+ * @returns 逆序对数
+ */
+template <typename T>
+uint64_t count_inversions_bounded(const T *arr, size_t n, size_t max_key) {
+    range_queries::fenwick_tree tree(max_key + 1);
+    uint64_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        int key = int(arr[i]);
+        count += i - size_t(tree.sum(key));
+        tree.update(key, 1);
+    }
+    return count;
+}
+
+/**
+ * @brief Kendall tau 距离：一个参考排名与其它排名之间不一致的对象对数
+ * @details 排名是 0..n-1 的排列，ranking[i] 是排在第 i 位的对象。
+ */
+class kendall_tau {
+ public:
+    /**
+     * @param reference 参考排名
+     */
+    explicit kendall_tau(const std::vector<uint32_t> &reference)
+        : position_(reference.size()) {
+        for (size_t i = 0; i < reference.size(); i++) {
+            position_[reference[i]] = uint32_t(i);
+        }
+    }
+
+    /** @brief 排名的长度 */
+    size_t size() const { return position_.size(); }
+
+    /**
+     * @brief 计算一个排名与参考排名的距离
+     * @param ranking 长度为 size() 的排名
+     * @param seq 长度为 size() 的缓冲区，用于存放重新编号后的序列
+     * @param buffer 长度为 size() 的归并缓冲区
+     * @param num_threads 线程数
+     */
+    uint64_t distance(const uint32_t *ranking, uint32_t *seq, uint32_t *buffer,
+                      size_t num_threads) const {
+        for (size_t i = 0; i < position_.size(); i++) {
+            seq[i] = position_[ranking[i]];
+        }
+        return count_inversions(seq, position_.size(), buffer, num_threads);
+    }
+
+    /**
+     * @brief 计算一个排名与参考排名的距离（自行分配缓冲区）
+     */
+    uint64_t distance(const std::vector<uint32_t> &ranking, size_t num_threads) const {
+        std::vector<uint32_t> seq(size()), buffer(size());
+        return distance(ranking.data(), seq.data(), buffer.data(), num_threads);
+    }
+
+    /**
+     * @brief 批量计算多个排名与参考排名的距离
+     * @details 排名个数不少于线程数时，各线程分别处理不同的排名，每个线程只分配一次缓冲区；
+     * 否则逐个处理，每个排名内部并行。
+     * @param rankings 要比较的排名
+     * @param num_threads 线程数
+     * @returns 每个排名与参考排名的距离
+     */
+    std::vector<uint64_t> distance_batch(const std::vector<std::vector<uint32_t>> &rankings,
+                                         size_t num_threads) const {
+        std::vector<uint64_t> result(rankings.size());
+        num_threads = std::max<size_t>(1, num_threads);
+        if (rankings.size() >= num_threads) {
+            std::atomic<size_t> next{0};
+            parallel_merge_sort::parallel_for(num_threads, num_threads, [&](size_t) {
+                std::vector<uint32_t> seq(size()), buffer(size());
+                for (size_t r = next++; r < rankings.size(); r = next++) {
+                    result[r] = distance(rankings[r].data(), seq.data(), buffer.data(), 1);
+                }
+            });
+        } else {
+            std::vector<uint32_t> seq(size()), buffer(size());
+            for (size_t r = 0; r < rankings.size(); r++) {
+                result[r] = distance(rankings[r].data(), seq.data(), buffer.data(), num_threads);
+            }
+        }
+        return result;
+    }
+
+ private:
+    std::vector<uint32_t> position_;  ///< position_[对象] = 该对象在参考排名中的位置
+};
+}  // namespace inversion
+}  // namespace sorting
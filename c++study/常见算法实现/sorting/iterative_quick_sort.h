@@ -0,0 +1,80 @@
+/**
+ * @file iterative_quick_sort.h
+ * @brief 不使用递归的快速排序。该方法使用栈代替递归。
+ * @details
+ * 用显式的栈保存待分区的子区间 [start, end]，分区方式与 `quick_sort.h` 相同（Lomuto，以最后一个元素为基准）。
+ * 递归和非递归的实现都具有 \f$O(n \log n)\f$ 的最好情况和 \f$O(n^2)\f$ 的最坏情况（例如已经有序的输入）。
+ */
+#pragma once
+
+#include <stack>    /// 用于 std::stack
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief 分区函数：使用最后一个元素作为基准，排序数组。
+ * @param arr 需要排序的数组
+ * @param start 起始索引
+ * @param end 结束索引
+ * @return int 返回基准元素的新位置
+ */
+template <typename T>
+int partition(std::vector<T> &arr, int start, int end) {
+    T pivot = arr[end];  // 选择最后一个元素作为基准
+    int index = start - 1;
+
+    for (int j = start; j < end; j++) {
+        if (!(pivot < arr[j])) {  // 如果当前元素小于或等于基准，则交换
+            std::swap(arr[++index], arr[j]);
+        }
+    }
+
+    std::swap(arr[index + 1], arr[end]);  // 将基准元素放到正确位置
+    return index + 1;                     // 返回基准元素的新位置
+}
+
+/**
+ * @brief 主排序函数
+ * @details 非递归的快速排序使用栈代替递归来保存和恢复调用之间的环境。
+ * 它不需要起始和结束参数，因为它不是递归的。
+ * @param arr 需要排序的数组
+ * @return void
+ */
+template <typename T>
+void iterativeQuickSort(std::vector<T> &arr) {
+    if (arr.size() < 2) {  // 空数组的 end 会是 -1
+        return;
+    }
+    std::stack<int> stack;  // 用栈来模拟递归调用
+    int start = 0;
+    int end = int(arr.size()) - 1;
+    stack.push(start);
+    stack.push(end);
+
+    while (!stack.empty()) {
+        end = stack.top();  // 获取栈顶的结束索引
+        stack.pop();
+        start = stack.top();  // 获取栈顶的起始索引
+        stack.pop();
+
+        int pivotIndex = partition(arr, start, end);  // 对当前部分进行分区
+
+        // 如果基准元素左侧有元素，则继续分区
+        if (pivotIndex - 1 > start) {
+            stack.push(start);
+            stack.push(pivotIndex - 1);  // 将分区后的左右子区间压入栈中
+        }
+
+        // 如果基准元素右侧有元素，则继续分区
+        if (pivotIndex + 1 < end) {
+            stack.push(pivotIndex + 1);
+            stack.push(end);
+        }
+    }
+}
+}  // namespace sorting
@@ -0,0 +1,108 @@
+/**
+ * @file library_sort.h
+ * @brief [图书馆排序（Library Sort）](https://en.wikipedia.org/wiki/Library_sort) 的实现
+ * @details 在已排序的元素之间留出空位的插入排序，二分查找插入位置，遇到冲突时重新整理。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::lower_bound
+#include <iterator>   /// 用于 std::distance
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace library_sort
+ * @brief 图书馆排序的实现函数
+ */
+namespace library_sort {
+/**
+ * @brief 图书馆排序（Library Sort）算法
+ * 
+ * 图书馆排序是一种基于插入排序的变种算法，通常用于对需要动态排序的数据进行排序，算法通过将元素插入到合适的位置来保持元素的有序性。
+ * 它通过两个数组（或“图书馆”）来分别存储已排序和未排序的元素，并在每次插入时维护元素的正确顺序。
+ *
+ * @param index 输入的待排序数组
+ * @param n 数组的大小
+ */
+template <typename T>
+void librarySort(T *index, int n) {
+    if (n < 2) {
+        return;
+    }
+    int lib_size, index_pos;
+    T *gaps,        // 用来存储未排序元素的数组
+      *library[2];  // 用两个数组（图书馆）来存储排序的元素
+
+    bool target_lib, *numbered;
+
+    // 动态分配两个数组（图书馆）和其他辅助数组
+    for (int i = 0; i < 2; i++) library[i] = new T[n];
+
+    gaps = new T[n + 1];       // 存储未排序元素的位置
+    numbered = new bool[n + 1]();  // 标记哪些位置已经被占用，初始都没有被占用
+
+    lib_size = 1;                // 当前已排序图书馆的大小
+    index_pos = 1;               // 当前待插入的元素索引
+    target_lib = 0;              // 当前目标图书馆（0 或 1）
+    library[target_lib][0] = index[0];  // 将第一个元素放入目标图书馆
+
+    while (index_pos < n) {  // 当待排序的元素没有全部插入时，继续
+        // 二分查找：找到当前待插入元素的插入位置
+        int insert = std::distance(
+            library[target_lib],
+            std::lower_bound(library[target_lib],
+                             library[target_lib] + lib_size, index[index_pos]));
+
+        // 如果插入位置已被占用，说明插入会发生冲突
+        if (numbered[insert] == true) {
+            int prov_size = 0, next_target_lib = !target_lib;
+
+            // 更新图书馆内容并清空gaps
+            for (int i = 0; i <= n; i++) {
+                if (numbered[i] == true) {
+                    library[next_target_lib][prov_size] = gaps[i];  // 将占用位置的元素移到下一个图书馆
+                    prov_size++;
+                    numbered[i] = false;  // 清除已占用标记
+                }
+
+                if (i <= lib_size) {
+                    library[next_target_lib][prov_size] = library[target_lib][i];  // 将已排序元素放入下一个图书馆
+                    prov_size++;
+                }
+            }
+
+            target_lib = next_target_lib;  // 切换目标图书馆
+            lib_size = prov_size - 1;      // 更新当前图书馆的大小
+        } else {
+            numbered[insert] = true;  // 标记当前位置已被占用
+            gaps[insert] = index[index_pos];  // 将当前元素插入到gaps
+            index_pos++;  // 处理下一个元素
+        }
+    }
+
+    // 输出最终排序后的数组
+    int index_pos_for_output = 0;
+    for (int i = 0; index_pos_for_output < n; i++) {
+        if (numbered[i] == true) {
+            index[index_pos_for_output] = gaps[i];  // 将gaps中的元素放入最终数组
+            index_pos_for_output++;
+        }
+
+        if (i < lib_size) {
+            index[index_pos_for_output] = library[target_lib][i];  // 将图书馆中的元素放入最终数组
+            index_pos_for_output++;
+        }
+    }
+
+    // 释放动态分配的内存
+    delete[] numbered;
+    delete[] gaps;
+    for (int i = 0; i < 2; ++i) {
+        delete[] library[i];
+    }
+}
+}  // namespace library_sort
+}  // namespace sorting
@@ -0,0 +1,157 @@
+/**
+ * @file lsd_radix_sort.h
+ * @brief 按 8/11 位分段的 [LSD 基数排序](https://en.wikipedia.org/wiki/Radix_sort#Least_significant_digit)，
+ * 支持 32/64 位整数、浮点数以及 (key, payload) 键值对
+ * @details
+ * 与 `decimal_radix_sort.h` 中按十进制逐位排序、每一轮都分配新数组的做法相比：
+ *
+ * 1. 每一位默认取 11 个二进制位（32 位键 3 轮，64 位键 6 轮，也可以通过模板参数改成 8 位），
+ *    移位和掩码代替除法和取模；
+ * 2. 只读一遍输入就算出所有轮次的直方图；
+ * 3. 如果某一轮所有元素的该位都相同（例如 ID 的高位全为 0），直接跳过这一轮；
+ * 4. 全程只使用一个与输入等长的缓冲区，在输入和缓冲区之间来回分发。
+ *
+ * 有符号整数翻转符号位，浮点数按 IEEE 754 位模式翻转（负数全部取反，正数翻转符号位），
+ * 转换后的无符号整数顺序与原来的数值顺序一致。排序是稳定的。
+ *
+ * 时间复杂度 \f$O(p \cdot (n + 2^b))\f$，其中 p 为轮数，b 为每轮的位数；额外空间 \f$O(n)\f$。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::copy
+#include <cstdint>      /// 用于 uint32_t, uint64_t
+#include <cstring>      /// 用于 std::memcpy
+#include <type_traits>  /// 用于 std::is_floating_point 等
+#include <utility>      /// 用于 std::pair
+#include <vector>       /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace lsd_radix_sort
+ * @brief LSD 基数排序的实现函数
+ */
+namespace lsd_radix_sort {
+/**
+ * @brief 把数值映射为保持顺序的无符号整数
+ * @tparam T 整数或浮点数类型
+ * @param x 要映射的值
+ * @returns 与 x 同宽的无符号整数，其大小顺序与 x 的数值顺序一致
+ */
+template <typename T>
+auto radix_key(const T &x) {
+    static_assert(std::is_arithmetic<T>::value, "键必须是整数或浮点数");
+    if constexpr (std::is_floating_point<T>::value) {
+        using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        static_assert(sizeof(T) == sizeof(U), "只支持 float 和 double");
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U u = 0;
+        std::memcpy(&u, &x, sizeof(u));
+        return (u & sign) ? U(~u) : U(u | sign);
+    } else if constexpr (std::is_signed<T>::value) {
+        using U = std::make_unsigned_t<T>;
+        return U(U(x) ^ (U(1) << (sizeof(U) * 8 - 1)));
+    } else {
+        return x;
+    }
+}
+
+constexpr unsigned kDefaultDigitBits = 11;  ///< 默认每轮的位数，2048 个桶的直方图正好放进 L1/L2
+
+/**
+ * @brief LSD 基数排序的核心过程
+ * @tparam Bits 每轮的位数（8 或 11 比较合适）
+ * @tparam T 元素类型
+ * @tparam KeyFn 从元素中提取无符号键的函数
+ * @param arr 要排序的数组，排序结果也写回这里
+ * @param buffer 与 arr 等长的缓冲区
+ * @param n 元素个数
+ * @param key 提取键的函数
+ */
+template <unsigned Bits = kDefaultDigitBits, typename T, typename KeyFn>
+void sort_by_key(T *arr, T *buffer, size_t n, KeyFn key) {
+    if (n < 2) {
+        return;
+    }
+    using U = decltype(key(arr[0]));
+    static_assert(std::is_unsigned<U>::value, "键必须是无符号整数");
+    constexpr unsigned kBits = Bits;
+    constexpr unsigned kKeyBits = sizeof(U) * 8;
+    constexpr unsigned kPasses = (kKeyBits + kBits - 1) / kBits;
+    constexpr size_t kRadix = size_t(1) << kBits;
+    constexpr U kMask = U(kRadix - 1);
+
+    // 一遍读完所有轮次的直方图
+    std::vector<size_t> hist(kPasses * kRadix, 0);
+    for (size_t i = 0; i < n; i++) {
+        U k = key(arr[i]);
+        for (unsigned p = 0; p < kPasses; p++) {
+            hist[p * kRadix + ((k >> (p * kBits)) & kMask)]++;
+        }
+    }
+
+    T *src = arr;
+    T *dst = buffer;
+    const U first = key(arr[0]);
+    for (unsigned p = 0; p < kPasses; p++) {
+        const unsigned shift = p * kBits;
+        size_t *h = &hist[p * kRadix];
+
+        // 所有元素该位都相同，分发不会改变顺序
+        if (h[(first >> shift) & kMask] == n) {
+            continue;
+        }
+
+        size_t sum = 0;
+        for (size_t d = 0; d < kRadix; d++) {
+            size_t c = h[d];
+            h[d] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            dst[h[(key(src[i]) >> shift) & kMask]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != arr) {
+        std::move(src, src + n, arr);
+    }
+}
+
+/**
+ * @brief 对整数或浮点数数组进行基数排序（使用调用者提供的缓冲区）
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ * @param buffer 至少能容纳 n 个元素的缓冲区
+ */
+template <typename T>
+void radix_sort(T *arr, size_t n, T *buffer) {
+    sort_by_key(arr, buffer, n, [](const T &x) { return radix_key(x); });
+}
+
+/**
+ * @brief 对整数或浮点数数组进行基数排序
+ * @param arr 要排序的数组
+ */
+template <typename T>
+void radix_sort(std::vector<T> *arr) {
+    std::vector<T> buffer(arr->size());
+    radix_sort(arr->data(), arr->size(), buffer.data());
+}
+
+/**
+ * @brief 按 key 对 (key, payload) 键值对进行稳定的基数排序
+ * @param arr 要排序的键值对数组
+ */
+template <typename K, typename V>
+void radix_sort(std::vector<std::pair<K, V>> *arr) {
+    std::vector<std::pair<K, V>> buffer(arr->size());
+    sort_by_key(arr->data(), buffer.data(), arr->size(),
+                [](const std::pair<K, V> &x) { return radix_key(x.first); });
+}
+}  // namespace lsd_radix_sort
+}  // namespace sorting
@@ -0,0 +1,151 @@
+/**
+ * @file merge_insertion_sort.h
+ * @brief 插入排序和归并排序的混合排序
+ * @details
+ * 归并排序递归到窗口长度不超过阈值时改用插入排序：小窗口上插入排序的常数更小，
+ * 也省掉了最底下几层递归和合并。时间复杂度仍为 \f$O(n \log n)\f$，额外空间 \f$O(n)\f$。
+ *
+ * 所有窗口都是左闭右开的 [min, max)。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::copy
+#include <array>      /// 用于 std::array
+#include <cstddef>    /// 用于 size_t
+#include <vector>     /// 用于 std::vector
+
+/**
+ * \namespace sorting
+ * \brief 排序算法的命名空间
+ */
+namespace sorting {
+/**
+ * \namespace merge_insertion
+ * \brief 结合了插入排序和归并排序的排序算法
+ */
+namespace merge_insertion {
+
+/**
+ * @brief 插入排序算法
+ * @see insertion_sort.h
+ *
+ * 当数据窗口较小（小于阈值）时，使用插入排序进行排序。
+ *
+ * @tparam T 数组的数据类型
+ * @param ptr 指向数组的指针
+ * @param start 排序窗口的起始索引
+ * @param end 排序窗口的结束索引（不包含）
+ */
+template <typename T>
+void InsertionSort(T *ptr, size_t start, size_t end) {
+    size_t i = 0, j = 0;
+
+    // 遍历窗口中的每个元素
+    for (i = start; i < end; i++) {
+        T temp = ptr[i];  // 临时存储当前元素
+        j = i;
+        // 插入排序的核心：将当前元素插入到已排序部分的正确位置
+        while (j > start && temp < ptr[j - 1]) {
+            ptr[j] = ptr[j - 1];  // 移动元素
+            j--;  // 向前移动
+        }
+        ptr[j] = temp;  // 将当前元素插入到正确的位置
+    }
+}
+
+/**
+ * @brief 对 std::array 的窗口 [start, end) 做插入排序
+ */
+template <typename T, size_t N>
+void InsertionSort(std::array<T, N> *A, size_t start, size_t end) {
+    InsertionSort(A->data(), start, end);
+}
+
+/**
+ * @brief 执行数组合并操作
+ *
+ * 通过合并操作将已排序的 [min, mid) 与 [mid, max) 合并为一个有序的窗口。
+ *
+ * @tparam T 数组的数据类型
+ * @param ptr 指向数组的指针
+ * @param min 排序窗口的最小索引
+ * @param max 排序窗口的结束索引（不包含）
+ * @param mid 排序窗口的中间索引
+ * @param tempArray 临时数组，与原数组一样长，下标 [min, max) 用于存储合并后的结果
+ */
+template <typename T>
+void merge(T *ptr, size_t min, size_t max, size_t mid, T *tempArray) {
+    size_t firstIndex = min;
+    size_t secondIndex = mid;
+
+    // 合并左右两部分数据
+    for (size_t index = min; index < max; index++) {
+        // 如果左侧部分元素存在且不大于右侧部分的元素
+        if (firstIndex < mid &&
+            (secondIndex >= max || !(ptr[secondIndex] < ptr[firstIndex]))) {
+            tempArray[index] = ptr[firstIndex];
+            firstIndex++;
+        } else {
+            tempArray[index] = ptr[secondIndex];
+            secondIndex++;
+        }
+    }
+
+    // 将合并后的结果复制回原数组
+    std::copy(tempArray + min, tempArray + max, ptr + min);
+}
+
+/**
+ * @brief 结合了插入排序和归并排序的最终算法
+ *
+ * 如果数据窗口的大小小于指定的阈值，则使用插入排序，否则使用归并排序递归地对数组进行排序。
+ *
+ * @tparam T 数组的数据类型
+ * @param ptr 指向数组的指针
+ * @param min 排序窗口的最小索引
+ * @param max 排序窗口的结束索引（不包含）
+ * @param threshold 窗口大小的阈值
+ * @param tempArray 与原数组一样长的临时数组
+ */
+template <typename T>
+void mergeSort(T *ptr, size_t min, size_t max, size_t threshold,
+               T *tempArray) {
+    // 如果当前窗口大小小于等于阈值（或者只剩一个元素），则使用插入排序
+    if ((max - min) <= threshold || (max - min) < 2) {
+        InsertionSort(ptr, min, max);
+    } else {
+        // 否则，递归地将数组分成两半并进行归并排序
+        size_t mid = min + (max - min) / 2;
+
+        // 对左半部分进行归并排序
+        mergeSort(ptr, min, mid, threshold, tempArray);
+        // 对右半部分进行归并排序
+        mergeSort(ptr, mid, max, threshold, tempArray);
+
+        // 合并已排序的两部分
+        merge(ptr, min, max, mid, tempArray);
+    }
+}
+
+/**
+ * @brief 对 std::array 的窗口 [min, max) 做混合排序
+ */
+template <typename T, size_t N>
+void mergeSort(std::array<T, N> *array, size_t min, size_t max,
+               size_t threshold) {
+    std::array<T, N> tempArray{};  // 临时数组用于存储合并后的结果
+    mergeSort(array->data(), min, max, threshold, tempArray.data());
+}
+
+/**
+ * @brief 对整个 std::vector 做混合排序
+ * @param threshold 改用插入排序的窗口大小
+ */
+template <typename T>
+void merge_insertion_sort(std::vector<T> *arr, size_t threshold = 16) {
+    std::vector<T> tempArray(arr->size());
+    mergeSort(arr->data(), 0, arr->size(), threshold, tempArray.data());
+}
+
+}  // namespace merge_insertion
+}  // namespace sorting
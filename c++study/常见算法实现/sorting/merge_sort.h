@@ -0,0 +1,93 @@
+/**
+ * @file merge_sort.h
+ * @brief [归并排序算法 (Merge Sort)](https://en.wikipedia.org/wiki/Merge_sort) 的递归实现
+ * @details
+ * 归并排序是一种稳定的分治排序：把数组分为两半，分别递归排序，再用 merge() 合并。
+ * 时间复杂度 \f$O(n \log n)\f$，合并时需要 \f$O(n)\f$ 的额外空间。
+ */
+#pragma once
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace merge_sort
+ * @brief 归并排序的实现函数
+ */
+namespace merge_sort {
+/**
+ * @brief 合并两个已排序的子数组
+ *
+ * merge(arr, l, m, r) 是归并排序中的关键过程，假设 arr[l..m] 和 arr[m+1..r] 已排序，
+ * 它将这两个已排序的子数组合并成一个。
+ *
+ * @param arr - 待排序的数组，包含两个子数组 arr[l...m] 和 arr[m+1...r]
+ * @param l - 第一个子数组的左边界或起始索引
+ * @param m - 第一个子数组的右边界或结束索引
+ *
+ * (第二个子数组从 m+1 开始，到 r 为止)
+ *
+ * @param r - 第二个子数组的右边界或结束索引
+ */
+template <typename T>
+void merge(T *arr, int l, int m, int r) {
+    int i, j, k;
+    int n1 = m - l + 1;  // 第一个子数组的大小
+    int n2 = r - m;      // 第二个子数组的大小
+
+    T *L = new T[n1], *R = new T[n2];  // 创建临时数组 L 和 R
+
+    // 将 arr[l..m] 复制到 L 数组
+    for (i = 0; i < n1; i++) L[i] = arr[l + i];
+    // 将 arr[m+1..r] 复制到 R 数组
+    for (j = 0; j < n2; j++) R[j] = arr[m + 1 + j];
+
+    i = 0;
+    j = 0;
+    k = l;
+    // 合并 L 和 R 数组
+    while (i < n1 || j < n2) {
+        if (j >= n2 || (i < n1 && !(R[j] < L[i]))) {
+            arr[k] = L[i];  // 如果 L[i] 小于等于 R[j]，则将 L[i] 放入 arr[k]
+            i++;
+        } else {
+            arr[k] = R[j];  // 否则将 R[j] 放入 arr[k]
+            j++;
+        }
+        k++;  // 移动到下一个位置
+    }
+
+    // 释放临时数组
+    delete[] L;
+    delete[] R;
+}
+
+/**
+ * @brief 归并排序算法
+ *
+ * 归并排序是一种分治算法，它将输入数组分为两半，对两半分别递归排序，
+ * 然后通过 merge() 函数将两个已排序的部分合并。
+ *
+ * @param arr - 待排序的数组
+ * @param l - 数组的左边界或起始索引
+ * @param r - 数组的右边界或结束索引
+ */
+template <typename T>
+void mergeSort(T *arr, int l, int r) {
+    if (l < r) {
+        // 计算中间索引
+        int m = l + (r - l) / 2;
+
+        // 递归排序左半部分
+        mergeSort(arr, l, m);
+        // 递归排序右半部分
+        mergeSort(arr, m + 1, r);
+
+        // 合并已排序的两部分
+        merge(arr, l, m, r);
+    }
+}
+}  // namespace merge_sort
+}  // namespace sorting
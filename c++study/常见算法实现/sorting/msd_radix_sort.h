@@ -0,0 +1,222 @@
+/**
+ * @file msd_radix_sort.h
+ * @brief 原地 MSD 基数排序（[American flag sort](https://en.wikipedia.org/wiki/American_flag_sort)），
+ * 顶层桶可以分给多个线程并行处理
+ * @details
+ * `decimal_radix_sort.h` 和 `counting_sort.h` 需要一个与输入等长的输出数组。American flag sort
+ * 从最高字节开始，每一层：
+ *
+ * 1. 统计当前字节的 256 个桶各有多少元素，得到每个桶的起止位置；
+ * 2. 沿着置换环把元素直接交换到它所属的桶里（原地，不需要输出数组）；
+ * 3. 对每个桶递归处理下一个字节，桶足够小时改用插入排序。
+ *
+ * 所有元素当前字节都相同时直接进入下一个字节。顶层分发完成后，256 个桶之间互不重叠，
+ * 按从大到小的顺序交给各个线程继续排序。
+ *
+ * 额外空间只有每层 256 个计数器（递归深度不超过键的字节数），与 n 无关。
+ * 时间复杂度 \f$O(n \cdot w)\f$，w 为键的字节数。排序不稳定。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::sort
+#include <atomic>     /// 用于 std::atomic
+#include <cstddef>    /// 用于 size_t
+#include <thread>     /// 用于 std::thread
+#include <utility>    /// 用于 std::swap
+#include <vector>     /// 用于 std::vector
+
+#include "./lsd_radix_sort.h"  /// 用于 radix_key
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace msd_radix_sort
+ * @brief 原地 MSD 基数排序的实现函数
+ */
+namespace msd_radix_sort {
+constexpr size_t kInsertionCutoff = 64;  ///< 小于此规模的桶用插入排序
+
+/**
+ * @brief 按键对 [arr, arr + n) 进行插入排序
+ */
+template <typename T, typename KeyFn>
+void insertion_sort(T *arr, size_t n, KeyFn key) {
+    for (size_t i = 1; i < n; i++) {
+        T v = std::move(arr[i]);
+        auto k = key(v);
+        size_t j = i;
+        while (j > 0 && k < key(arr[j - 1])) {
+            arr[j] = std::move(arr[j - 1]);
+            j--;
+        }
+        arr[j] = std::move(v);
+    }
+}
+
+/**
+ * @brief 按第 shift 位开始的字节把元素原地分发到 256 个桶中
+ * @param arr 要分发的数组
+ * @param n 元素个数
+ * @param shift 当前字节最低位的位置
+ * @param key 提取无符号键的函数
+ * @param [out] ends 每个桶的结束位置（桶 b 为 [ends[b-1], ends[b])）
+ * @returns 如果所有元素都落在同一个桶里（无需分发）返回 false
+ */
+template <typename T, typename KeyFn>
+bool distribute(T *arr, size_t n, unsigned shift, KeyFn key, size_t ends[256]) {
+    size_t count[256] = {0};
+    for (size_t i = 0; i < n; i++) {
+        count[(key(arr[i]) >> shift) & 0xFF]++;
+    }
+    if (count[(key(arr[0]) >> shift) & 0xFF] == n) {
+        return false;
+    }
+
+    size_t heads[256];
+    size_t sum = 0;
+    for (int b = 0; b < 256; b++) {
+        heads[b] = sum;
+        sum += count[b];
+        ends[b] = sum;
+    }
+
+    // 沿置换环交换：每次把手上的元素放进它的桶，再拿起被替换出来的元素
+    for (int b = 0; b < 256; b++) {
+        while (heads[b] < ends[b]) {
+            T v = std::move(arr[heads[b]]);
+            unsigned d = (key(v) >> shift) & 0xFF;
+            while (d != unsigned(b)) {
+                std::swap(v, arr[heads[d]++]);
+                d = (key(v) >> shift) & 0xFF;
+            }
+            arr[heads[b]++] = std::move(v);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief American flag sort 的递归过程
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ * @param shift 当前字节最低位的位置
+ * @param key 提取无符号键的函数
+ */
+template <typename T, typename KeyFn>
+void american_flag(T *arr, size_t n, int shift, KeyFn key) {
+    while (true) {
+        if (n < kInsertionCutoff) {
+            insertion_sort(arr, n, key);
+            return;
+        }
+        size_t ends[256];
+        if (distribute(arr, n, unsigned(shift), key, ends)) {
+            if (shift == 0) {
+                return;
+            }
+            size_t begin = 0;
+            for (int b = 0; b < 256; b++) {
+                if (ends[b] - begin > 1) {
+                    american_flag(arr + begin, ends[b] - begin, shift - 8, key);
+                }
+                begin = ends[b];
+            }
+            return;
+        }
+        // 当前字节全部相同，直接看下一个字节
+        if (shift == 0) {
+            return;
+        }
+        shift -= 8;
+    }
+}
+
+/**
+ * @brief 原地 MSD 基数排序，顶层的桶由多个线程并行处理
+ * @tparam T 元素类型
+ * @tparam KeyFn 提取无符号键的函数
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ * @param key 提取无符号键的函数
+ * @param num_threads 线程数
+ */
+template <typename T, typename KeyFn>
+void sort_by_key(T *arr, size_t n, KeyFn key, size_t num_threads) {
+    if (n < 2) {
+        return;
+    }
+    int shift = int(sizeof(key(arr[0])) * 8) - 8;
+    if (num_threads <= 1 || n < (size_t(1) << 16)) {
+        american_flag(arr, n, shift, key);
+        return;
+    }
+
+    // 顶层分发（跳过所有元素都相同的高位字节）
+    size_t ends[256];
+    while (!distribute(arr, n, unsigned(shift), key, ends)) {
+        if (shift == 0) {
+            return;
+        }
+        shift -= 8;
+    }
+    if (shift == 0) {
+        return;
+    }
+
+    // 按桶的大小从大到小分配，减少最后一个大桶拖慢整体的情况
+    struct bucket {
+        size_t begin, size;
+    };
+    std::vector<bucket> buckets;
+    size_t begin = 0;
+    for (int b = 0; b < 256; b++) {
+        if (ends[b] - begin > 1) {
+            buckets.push_back({begin, ends[b] - begin});
+        }
+        begin = ends[b];
+    }
+    std::sort(buckets.begin(), buckets.end(),
+              [](const bucket &a, const bucket &b) { return a.size > b.size; });
+
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < buckets.size(); i = next++) {
+            american_flag(arr + buckets[i].begin, buckets[i].size, shift - 8, key);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+/**
+ * @brief 对整数或浮点数数组进行原地 MSD 基数排序
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ * @param num_threads 线程数，默认为 1
+ */
+template <typename T>
+void american_flag_sort(T *arr, size_t n, size_t num_threads = 1) {
+    sort_by_key(arr, n, [](const T &x) { return lsd_radix_sort::radix_key(x); },
+                num_threads);
+}
+
+/**
+ * @brief 对整数或浮点数数组进行原地 MSD 基数排序（std::vector 版本）
+ * @param arr 要排序的数组
+ * @param num_threads 线程数，默认为 1
+ */
+template <typename T>
+void american_flag_sort(std::vector<T> *arr, size_t num_threads = 1) {
+    american_flag_sort(arr->data(), arr->size(), num_threads);
+}
+}  // namespace msd_radix_sort
+}  // namespace sorting
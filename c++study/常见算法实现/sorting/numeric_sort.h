@@ -0,0 +1,61 @@
+/**
+ * @file numeric_sort.h
+ * @brief 按数值顺序（而不是字母顺序）比较数字字符串的比较器
+ * @details
+ * 使用通用算法对字符串集合进行排序时，结果是按字母数字顺序排序的。
+ * 如果字符串是数字字符串，它会导致不自然的排序结果。
+ *
+ * 例如，一个字符串数组：1,10,100,2,20,200,3,30,300
+ * 使用常规排序会得到 1,10,100,2,20,200,3,30,300，
+ * 即使我们知道正确的排序顺序应该是 1,2,3,10,20,30,100,200,300。
+ *
+ * NumericSort 先去掉前导零，较短的数字较小，长度相同时按字典序比较。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::sort
+#include <cstddef>    /// 用于 size_t
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace numeric_sort
+ * @brief 数字字符串的数值顺序
+ */
+namespace numeric_sort {
+/**
+ * @brief 比较器：a 表示的数值小于 b 时返回 true（都是不带符号的十进制数字串）
+ */
+inline bool NumericSort(std::string a, std::string b) {
+    // 去掉前导零
+    while (a[0] == '0') {
+        a.erase(a.begin());
+    }
+    while (b[0] == '0') {
+        b.erase(b.begin());
+    }
+
+    size_t n = a.length();  // 获取字符串 a 的长度
+    size_t m = b.length();  // 获取字符串 b 的长度
+
+    // 如果两个字符串长度相等，则按字典顺序排序
+    if (n == m)
+        return a < b;
+
+    // 否则按字符串的长度排序，长度短的排在前面
+    return n < m;
+}
+
+/**
+ * @brief 按数值顺序对数字字符串排序
+ */
+inline void numeric_sort(std::vector<std::string> *v) {
+    std::sort(v->begin(), v->end(), NumericSort);
+}
+}  // namespace numeric_sort
+}  // namespace sorting
@@ -0,0 +1,55 @@
+/**
+ * @file odd_even_sort.h
+ * @brief [奇偶排序（Odd-Even Sort）](https://en.wikipedia.org/wiki/Odd%E2%80%93even_sort) 的实现
+ * @details
+ * 交替地比较并交换 (奇数下标, 下一个) 与 (偶数下标, 下一个) 的相邻元素对，直到一整轮没有交换。
+ * 同一轮内的比较互不相关，可以并行；串行时间复杂度 \f$O(n^2)\f$。
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace odd_even_sort
+ * @brief 奇偶排序的实现函数
+ */
+namespace odd_even_sort {
+/**
+ * @brief 奇偶排序算法的实现
+ * @param arr 要排序的数组
+ * @param size 元素个数
+ */
+template <typename T>
+void oddEven(std::vector<T> &arr, size_t size) {
+    bool sorted = false;
+
+    // 当数组未排序完成时，继续循环
+    while (!sorted) {
+        sorted = true;
+
+        // 进行奇数索引位置的元素比较和交换
+        for (size_t i = 1; i + 1 < size; i += 2) {
+            if (arr[i + 1] < arr[i]) {         // 如果当前元素大于下一个元素
+                std::swap(arr[i], arr[i + 1]);  // 交换元素
+                sorted = false;                 // 设置为未排序，继续进行下一轮
+            }
+        }
+
+        // 进行偶数索引位置的元素比较和交换
+        for (size_t i = 0; i + 1 < size; i += 2) {
+            if (arr[i + 1] < arr[i]) {         // 如果当前元素大于下一个元素
+                std::swap(arr[i], arr[i + 1]);  // 交换元素
+                sorted = false;                 // 设置为未排序，继续进行下一轮
+            }
+        }
+    }
+}
+}  // namespace odd_even_sort
+}  // namespace sorting
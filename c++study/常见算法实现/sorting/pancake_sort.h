@@ -0,0 +1,72 @@
+/**
+ * @file pancake_sort.h
+ * @brief [薄煎饼排序（Pancake Sort）](https://en.wikipedia.org/wiki/Pancake_sorting) 算法实现
+ * @details
+ * 唯一允许的操作是“翻转”：把前 k 个元素整体反转。每一轮找出未排序部分的最大元素，
+ * 先翻转到最前面，再翻转到未排序部分的末尾，至多 2(n-1) 次翻转。
+ * 比较与移动的次数都是 \f$O(n^2)\f$。
+ */
+#pragma once
+
+#include <vector>  /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace pancake_sort
+ * @brief 薄煎饼排序算法的相关函数
+ */
+namespace pancake_sort {
+/**
+ * @brief 反转数组中 [start, end] 的元素
+ * @param arr 数组
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ * @returns void
+ */
+template <typename T>
+void reverse(std::vector<T> &arr, int start, int end) {
+    T temp;  // 临时变量
+    while (start <= end) {
+        temp = arr[start];
+        arr[start] = arr[end];
+        arr[end] = temp;
+        start++;
+        end--;
+    }
+}
+
+/**
+ * @brief 对数组的前 size 个元素就地排序
+ * @param arr 数组元素
+ * @param size 数组的大小
+ * @returns 0
+ */
+template <typename T>
+int pancakeSort(std::vector<T> &arr, int size) {
+    // 从最大元素开始，逐步减少排序的范围
+    for (int i = size; i > 1; --i) {
+        int max_index = 0, j = 0;  // 初始化一些变量
+        T max_value = arr[0];  // 从第一个元素开始找，元素可能都小于 0
+
+        // 找到最大元素的索引
+        for (j = 1; j < i; j++) {
+            if (!(arr[j] < max_value)) {
+                max_value = arr[j];
+                max_index = j;
+            }
+        }
+
+        // 如果最大元素不是当前范围的最后一个元素，则进行两次反转
+        if (max_index != i - 1) {
+            reverse(arr, 0, max_index);  // 反转前半部分
+            reverse(arr, 0, i - 1);      // 反转整个当前范围
+        }
+    }
+    return 0;
+}
+}  // namespace pancake_sort
+}  // namespace sorting
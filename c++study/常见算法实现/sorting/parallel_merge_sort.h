@@ -0,0 +1,301 @@
+/**
+ * @file parallel_merge_sort.h
+ * @brief 并行、稳定的自底向上归并排序，以及基于败者树的 k 路归并
+ * @details
+ * `merge_sort.h` 每次合并都要分配临时数组，`non_recursive_merge_sort.h` 也只用一个线程。
+ * 这里的实现：
+ *
+ * 1. 整个排序只分配一次与输入等长的缓冲区，每一轮在输入数组和缓冲区之间来回合并；
+ * 2. 先把数组切成 32 个元素的小段做插入排序（整数按默认顺序排序时改用
+ *    `sorting_network.h` 的排序网络/SIMD 内核，等值不可区分，不影响稳定性；
+ *    浮点数的 -0.0 与 +0.0 比较相等却可以区分，仍用插入排序），然后段长逐轮翻倍；
+ * 3. 每一轮的每一对合并再按输出位置切成若干块，块的边界用
+ *    [merge path](https://doi.org/10.1145/2133803.2133805)（co-rank）二分求出，
+ *    各块互不依赖，可以交给不同线程，即使最后一轮只剩一对也能充分并行；
+ * 4. `multiway_merge()` 用败者树把 k 个已排序的序列（例如各线程分别排好的块）合并成一个，
+ *    每输出一个元素只需 \f$\log_2 k\f$ 次比较。
+ *
+ * 所有合并在相等时都优先取左侧/编号小的序列，因此排序是稳定的。
+ * 排序过程中元素只被移动，不被拷贝，只能移动的类型（例如 `std::unique_ptr`）也可以排序。
+ * 时间复杂度 \f$O(n \log n / p + \log^2 n)\f$，p 为线程数；额外空间 \f$O(n)\f$。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::max, std::move（区间）
+#include <atomic>       /// 用于 std::atomic
+#include <cstddef>      /// 用于 size_t
+#include <functional>   /// 用于 std::less
+#include <thread>       /// 用于 std::thread
+#include <type_traits>  /// 用于 std::is_integral
+#include <utility>      /// 用于 std::pair, std::move
+#include <vector>       /// 用于 std::vector
+
+#include "./sorting_network.h"
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace parallel_merge_sort
+ * @brief 并行归并排序与 k 路归并
+ */
+namespace parallel_merge_sort {
+constexpr size_t kInsertionRun = 32;      ///< 初始小段的长度
+constexpr size_t kMergeGrain = 1 << 14;  ///< 每个合并任务至少输出的元素个数
+
+/**
+ * @brief co-rank：求合并 a、b 后前 diag 个输出中有多少个来自 a
+ * @details 相等元素优先取 a，因此返回满足 a[i-1] <= b[diag-i] 且 b[diag-i-1] < a[i] 的 i。
+ * @returns 来自 a 的元素个数
+ */
+template <typename T, typename Compare>
+size_t merge_path(const T *a, size_t na, const T *b, size_t nb, size_t diag,
+                  Compare comp) {
+    size_t lo = diag > nb ? diag - nb : 0;
+    size_t hi = std::min(diag, na);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (!comp(b[diag - mid - 1], a[mid])) {  // a[mid] 排在 b[diag-mid-1] 之前
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief 顺序合并两个已排序的序列到 out（相等时取 a）
+ * @details 元素被移动到 out，a、b 中留下的是移动后的对象
+ */
+template <typename T, typename Compare>
+void merge(T *a, size_t na, T *b, size_t nb, T *out, Compare comp) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        if (comp(b[j], a[i])) {
+            *out++ = std::move(b[j++]);
+        } else {
+            *out++ = std::move(a[i++]);
+        }
+    }
+    out = std::move(a + i, a + na, out);
+    std::move(b + j, b + nb, out);
+}
+
+/**
+ * @brief 稳定的插入排序
+ */
+template <typename T, typename Compare>
+void insertion_sort(T *arr, size_t n, Compare comp) {
+    for (size_t i = 1; i < n; i++) {
+        T key = std::move(arr[i]);
+        size_t j = i;
+        while (j > 0 && comp(key, arr[j - 1])) {
+            arr[j] = std::move(arr[j - 1]);
+            j--;
+        }
+        arr[j] = std::move(key);
+    }
+}
+
+/**
+ * @brief 用 num_threads 个线程执行 task(0..num_tasks-1)，调用线程也参与
+ */
+template <typename Task>
+void parallel_for(size_t num_tasks, size_t num_threads, Task task) {
+    num_threads = std::max<size_t>(1, std::min(num_threads, num_tasks));
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < num_tasks; i = next++) {
+            task(i);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+/**
+ * @brief 并行、稳定的自底向上归并排序
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ * @param num_threads 线程数
+ * @param comp 比较函数
+ */
+template <typename T, typename Compare = std::less<T>>
+void parallel_merge_sort(T *arr, size_t n, size_t num_threads,
+                         Compare comp = Compare()) {
+    if (n < 2) {
+        return;
+    }
+
+    // 第一步：对长度为 kInsertionRun 的小段做插入排序
+    size_t num_runs = (n + kInsertionRun - 1) / kInsertionRun;
+    size_t chunk = std::max<size_t>(1, kMergeGrain / kInsertionRun);
+    parallel_for((num_runs + chunk - 1) / chunk, num_threads, [&](size_t t) {
+        for (size_t r = t * chunk; r < std::min(num_runs, (t + 1) * chunk); r++) {
+            size_t lo = r * kInsertionRun;
+            size_t len = std::min(kInsertionRun, n - lo);
+            if constexpr (std::is_integral<T>::value &&
+                          std::is_same<Compare, std::less<T>>::value) {
+                sorting_network::sort_small(arr + lo, len);
+            } else {
+                insertion_sort(arr + lo, len, comp);
+            }
+        }
+    });
+    if (n <= kInsertionRun) {
+        return;
+    }
+
+    // 第二步：段长逐轮翻倍，在 arr 和唯一的缓冲区之间来回合并
+    std::vector<T> buffer(n);
+    T *src = arr;
+    T *dst = buffer.data();
+    struct task {
+        size_t lo, mid, hi;      // 合并 src[lo, mid) 与 src[mid, hi)
+        size_t out_begin, out_end;  // 负责的输出区间（相对 lo 的偏移）
+        size_t i0, i1;              // 输出区间两端的 co-rank：取 a[i0, i1) 和 b[out_begin - i0, out_end - i1)
+    };
+    std::vector<task> tasks;
+    for (size_t width = kInsertionRun; width < n; width *= 2) {
+        tasks.clear();
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = std::min(lo + width, n);
+            size_t hi = std::min(lo + 2 * width, n);
+            for (size_t o = 0; o < hi - lo; o += kMergeGrain) {
+                tasks.push_back({lo, mid, hi, o, std::min(o + kMergeGrain, hi - lo), 0, 0});
+            }
+        }
+        // 先求出所有块的边界，再合并：合并会把元素移出 src，其它块的二分查找不能与之同时进行
+        parallel_for(tasks.size(), num_threads, [&](size_t t) {
+            task &k = tasks[t];
+            const T *a = src + k.lo;
+            const T *b = src + k.mid;
+            size_t na = k.mid - k.lo, nb = k.hi - k.mid;
+            k.i0 = merge_path(a, na, b, nb, k.out_begin, comp);
+            k.i1 = merge_path(a, na, b, nb, k.out_end, comp);
+        });
+        parallel_for(tasks.size(), num_threads, [&](size_t t) {
+            const task &k = tasks[t];
+            size_t j0 = k.out_begin - k.i0, j1 = k.out_end - k.i1;
+            merge(src + k.lo + k.i0, k.i1 - k.i0, src + k.mid + j0, j1 - j0,
+                  dst + k.lo + k.out_begin, comp);
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != arr) {
+        std::move(src, src + n, arr);
+    }
+}
+
+/**
+ * @brief 并行归并排序（std::vector 版本）
+ */
+template <typename T, typename Compare = std::less<T>>
+void parallel_merge_sort(std::vector<T> *arr, size_t num_threads,
+                         Compare comp = Compare()) {
+    parallel_merge_sort(arr->data(), arr->size(), num_threads, comp);
+}
+
+/**
+ * @brief 败者树（tournament tree of losers）
+ * @details
+ * 叶子是 k 个输入源的编号，每个内部节点保存在该节点比赛中"输掉"的源，
+ * `winner()` 是全局胜者。胜者输出后调用 `replay()`，只需沿着一条叶子到根的路径重新比赛，
+ * 每次比较一个节点，共 \f$\lceil \log_2 k \rceil\f$ 次。
+ * @tparam Beats `beats(a, b)` 为 true 表示源 a 的当前元素应排在源 b 之前；
+ * 已经耗尽的源必须输给任何未耗尽的源
+ */
+template <typename Beats>
+class loser_tree {
+ public:
+    loser_tree(size_t k, Beats beats) : k_(k), tree_(std::max<size_t>(k, 1)), beats_(beats) {
+        if (k_ > 0) {
+            tree_[0] = build(1);
+        }
+    }
+
+    /** @brief 当前胜者的编号 */
+    size_t winner() const { return tree_[0]; }
+
+    /** @brief 源 s 的当前元素变化后（通常是胜者输出了一个元素）重新比赛 */
+    void replay(size_t s) {
+        size_t w = s;
+        for (size_t node = (s + k_) / 2; node > 0; node /= 2) {
+            if (beats_(tree_[node], w)) {
+                std::swap(tree_[node], w);
+            }
+        }
+        tree_[0] = w;
+    }
+
+ private:
+    size_t k_;
+    std::vector<size_t> tree_;
+    Beats beats_;
+
+    size_t build(size_t node) {
+        if (node >= k_) {
+            return node - k_;  // 叶子 node 对应源 node - k
+        }
+        size_t l = build(2 * node), r = build(2 * node + 1);
+        if (beats_(r, l)) {
+            tree_[node] = l;
+            return r;
+        }
+        tree_[node] = r;
+        return l;
+    }
+};
+
+/**
+ * @brief 创建败者树的辅助函数（推导 Beats 类型）
+ */
+template <typename Beats>
+loser_tree<Beats> make_loser_tree(size_t k, Beats beats) {
+    return loser_tree<Beats>(k, beats);
+}
+
+/**
+ * @brief k 路归并：把 k 个已排序的序列合并到 out
+ * @details 相等元素按序列编号从小到大输出，因此对"把数组切块、各块分别稳定排序"的结果做合并，
+ * 整体仍然稳定。
+ * @param runs 每个序列的 [begin, end)
+ * @param out 输出位置，需能容纳所有元素
+ * @param comp 比较函数
+ * @returns 输出的末尾
+ */
+template <typename T, typename Compare = std::less<T>>
+T *multiway_merge(std::vector<std::pair<const T *, const T *>> runs, T *out,
+                  Compare comp = Compare()) {
+    auto beats = [&runs, &comp](size_t a, size_t b) {
+        if (runs[a].first == runs[a].second) return false;
+        if (runs[b].first == runs[b].second) return true;
+        if (comp(*runs[b].first, *runs[a].first)) return false;
+        if (comp(*runs[a].first, *runs[b].first)) return true;
+        return a < b;
+    };
+    auto tree = make_loser_tree(runs.size(), beats);
+    while (!runs.empty()) {
+        size_t w = tree.winner();
+        if (runs[w].first == runs[w].second) {
+            break;  // 胜者已耗尽，说明所有序列都已耗尽
+        }
+        *out++ = *runs[w].first++;
+        tree.replay(w);
+    }
+    return out;
+}
+}  // namespace parallel_merge_sort
+}  // namespace sorting
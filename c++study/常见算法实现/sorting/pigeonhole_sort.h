@@ -0,0 +1,63 @@
+/**
+ * @file pigeonhole_sort.h
+ * @brief [鸽巢排序算法](https://en.wikipedia.org/wiki/Pigeonhole_sort)的实现
+ * @details
+ * 为 [min, max] 中的每个可能的值准备一个“鸽巢”，把元素逐个放进对应的鸽巢，再按顺序取出。
+ * 适用于元素数量和可能的键值数量大致相同的情况，时间与空间复杂度都是 O(n + Range)，
+ * 其中 Range = max - min + 1。对整数来说，鸽巢里只需要记录放进了几个元素。
+ */
+#pragma once
+
+#include <algorithm>  /// 用于 std::minmax_element
+#include <array>      /// 用于 std::array
+#include <cstddef>    /// 用于 size_t
+#include <cstdint>    /// 用于 uint64_t
+#include <vector>     /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief 对整数数组 arr[0..n) 做鸽巢排序
+ * @details Range 个计数需要放得进内存；差值按 uint64_t 计算，有符号类型也不会溢出。
+ * @param arr 要排序的数组
+ * @param n 元素个数
+ */
+template <typename T>
+void pigeonhole_sort(T *arr, size_t n) {
+    if (n < 2) {
+        return;
+    }
+    // 找到数组中的最小值和最大值，Range 表示需要的鸽巢数量
+    auto mm = std::minmax_element(arr, arr + n);
+    const uint64_t min = uint64_t(*mm.first);
+    const uint64_t range = uint64_t(*mm.second) - min + 1;
+    std::vector<size_t> hole(range);
+
+    // 将所有数组元素放入鸽巢中
+    for (size_t i = 0; i < n; i++) {
+        hole[uint64_t(arr[i]) - min]++;
+    }
+
+    // 按顺序从鸽巢中取出元素并存储回原数组
+    size_t count = 0;
+    for (uint64_t i = 0; i < range; i++) {
+        for (size_t c = hole[i]; c > 0; c--) {
+            arr[count++] = T(min + i);
+        }
+    }
+}
+
+/**
+ * 使用鸽巢排序算法对大小为 N 的数组进行排序
+ * @param arr 未排序的数组
+ * @returns 排序后的数组
+ */
+template <std::size_t N>
+std::array<int, N> pigeonSort(std::array<int, N> arr) {
+    pigeonhole_sort(arr.data(), N);
+    return arr;  // 返回排序后的数组
+}
+}  // namespace sorting
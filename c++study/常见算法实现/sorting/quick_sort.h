@@ -0,0 +1,554 @@
+/**
+ * @file quick_sort.h
+ * @brief 快速排序实现（参考 [Quick sort](https://en.wikipedia.org/wiki/Quicksort)）
+ * @details
+ *      快速排序是一种 [分治算法](https://en.wikipedia.org/wiki/Category:Divide-and-conquer_algorithms)，
+ *      它选择一个元素作为基准，并围绕该基准对给定数组进行分区。快速排序有不同的版本，选择基准的方式也不同：
+ *
+ *      1. 总是选择第一个元素作为基准
+ *      2. 总是选择最后一个元素作为基准（下面实现的方式）
+ *      3. 随机选择一个元素作为基准
+ *      4. 选择中位数作为基准
+ *
+ *      快速排序的关键过程是分区（partition）。分区的目标是，给定一个数组和一个元素 x（作为基准），
+ *      将 x 放到其在排序数组中的正确位置，并将所有小于 x 的元素放在 x 的左边，所有大于 x 的元素放在右边。
+ *      所有这些操作应当在线性时间内完成。
+ *
+ * @author [David Leal](https://github.com/Panquesito7)
+ * @author [popoapp](https://github.com/popoapp)
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::max, std::lower_bound
+#include <atomic>       /// 用于 std::atomic
+#include <cstdint>      /// 用于 uint64_t
+#include <deque>        /// 用于 std::deque
+#include <iostream>     /// 用于输入输出操作
+#include <memory>       /// 用于 std::unique_ptr, std::allocator, std::uninitialized_move
+#include <mutex>        /// 用于 std::mutex
+#include <thread>       /// 用于 std::thread
+#include <type_traits>  /// 用于 std::is_arithmetic
+#include <utility>      /// 用于 std::swap, std::make_pair, std::move
+#include <vector>       /// 用于 std::vector
+
+#include "./heap_sort.h"
+#include "./introsort.h"
+#include "./sorting_network.h"
+
+/**
+ * @brief 排序算法
+ * @namespace sorting
+ */
+namespace sorting {
+/**
+ * @namespace quick_sort
+ * @brief 快速排序的实现函数
+ */
+namespace quick_sort {
+/**
+ * @brief 使用最后一个元素作为基准对数组进行排序
+ * @details
+ * 该函数选择数组的最后一个元素作为基准，将基准元素放置在正确的位置，并将所有小于基准的元素
+ * 放在基准的左边，所有大于基准的元素放在基准的右边。
+ * @tparam T 数组类型
+ * @param arr 用户提供的数组
+ * @param low 数组的起始索引
+ * @param high 数组的结束索引
+ * @returns 返回较小元素的索引
+ */
+template <typename T>
+int partition(std::vector<T> *arr, const int &low, const int &high) {
+    T pivot = (*arr)[high];  // 选择最后一个元素作为基准
+    int i = (low - 1);       // 较小元素的索引
+
+    for (int j = low; j < high; j++) {
+        // 如果当前元素小于或等于基准
+        if ((*arr)[j] <= pivot) {
+            i++;  // 增加较小元素的索引
+            std::swap((*arr)[i], (*arr)[j]);
+        }
+    }
+
+    std::swap((*arr)[i + 1], (*arr)[high]);
+    return (i + 1);
+}
+
+/**
+ * @brief 实现快速排序的主函数（递归版本）
+ * @details
+ * 该函数通过递归调用对数组进行排序。它会将数组分成两部分：左部分小于基准，右部分大于基准，
+ * 并对这两部分递归调用快速排序。
+ * @tparam T 数组类型
+ * @param arr 需要排序的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ */
+template <typename T>
+void quick_sort(std::vector<T> *arr, const int &low, const int &high) {
+    if (low < high) {
+        int p = partition(arr, low, high);  // 获取基准元素的位置
+
+        // 对基准元素左边的子数组进行递归排序
+        quick_sort(arr, low, p - 1);
+
+        // 对基准元素右边的子数组进行递归排序
+        quick_sort(arr, p + 1, high);
+    }
+}
+
+/**
+ * @brief 实现快速排序的主函数（返回排序后的数组）
+ * @details
+ * 该函数实现快速排序并返回排序后的数组。它与递归版本类似，但返回排序后的数组，而不是直接
+ * 修改输入数组。
+ * @tparam T 数组类型
+ * @param arr 需要排序的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @returns 排序后的数组
+ */
+template <typename T>
+std::vector<T> quick_sort(std::vector<T> arr, const int &low, const int &high) {
+    if (low < high) {
+        int p = partition(&arr, low, high);  // 获取基准元素的位置
+
+        // 对基准元素左边的子数组进行递归排序
+        quick_sort(&arr, low, p - 1);
+
+        // 对基准元素右边的子数组进行递归排序
+        quick_sort(&arr, p + 1, high);
+    }
+    return arr;  // 返回排序后的数组
+}
+
+/**
+ * @brief 三路分区
+ * @details
+ * 以 `arr[high]` 为基准，把数组分成小于、等于、大于基准的三个部分。
+ * 重复元素很多时，Lomuto 分区会把所有相等元素都放到同一侧而退化成 O(n^2)，
+ * 三路分区则直接把等于基准的整段排除在后续递归之外。
+ * @tparam T 数组类型
+ * @param arr 需要分区的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param [out] i 小于基准部分的结束索引
+ * @param [out] j 大于基准部分的起始索引
+ */
+template <typename T>
+void partition3(std::vector<T> *arr, int low, int high, int *i, int *j) {
+    // 处理只有两个元素的情况
+    if (high - low <= 1) {
+        if ((*arr)[high] < (*arr)[low]) {
+            std::swap((*arr)[high], (*arr)[low]);
+        }
+        *i = low;
+        *j = high;
+        return;
+    }
+
+    int mid = low;
+    T pivot = (*arr)[high];  // 选择最右边的元素作为基准
+    while (mid <= high) {
+        if ((*arr)[mid] < pivot) {  // 当前元素小于基准
+            std::swap((*arr)[low++], (*arr)[mid++]);
+        } else if (pivot < (*arr)[mid]) {  // 当前元素大于基准
+            std::swap((*arr)[mid], (*arr)[high--]);
+        } else {  // 当前元素等于基准
+            mid++;
+        }
+    }
+
+    *i = low - 1;
+    *j = mid;
+}
+
+/**
+ * @brief 基于三路分区的快速排序（荷兰国旗算法），就地修改原数组
+ * @details 以最后一个元素为基准，有序输入上仍会退化为 O(n^2)，递归深度为 n。
+ * @tparam T 数组类型
+ * @param arr 需要排序的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ */
+template <typename T>
+void quick_sort_3way(std::vector<T> *arr, int low, int high) {
+    if (low >= high) {  // 1 个或 0 个元素
+        return;
+    }
+
+    int i = 0, j = 0;
+    partition3(arr, low, high, &i, &j);
+
+    // 对两个子数组递归排序
+    quick_sort_3way(arr, low, i);
+    quick_sort_3way(arr, j, high);
+}
+
+/**
+ * @brief 基于三路分区的快速排序，对数组的副本排序并返回
+ * @tparam T 数组类型
+ * @param arr 需要排序的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @returns 排序后的数组副本
+ */
+template <typename T>
+std::vector<T> quick_sort_3way(std::vector<T> arr, int low, int high) {
+    quick_sort_3way(&arr, low, high);
+    return arr;
+}
+
+/**
+ * @brief 基于工作窃取任务池的并行快速排序
+ * @details
+ * 每个线程拥有一个自己的双端队列，队列中的任务就是一个待排序的子区间 [low, high]：
+ *
+ * 1. 线程从自己队列的队尾取任务（后进先出，刚划分出来的子区间还在缓存中）；
+ * 2. 自己的队列为空时，从其它线程队列的队头窃取任务（先入队的子区间规模更大，
+ *    一次窃取就能换来较多的工作）；
+ * 3. 每次分区后，较小的一半作为新任务放入队列（太小则就地递归），
+ *    较大的一半留在当前循环中继续处理，保证递归深度为 O(log n)。
+ *
+ * 基准选好后放到 `high` 位置，沿用 `partition()` 以最后一个元素为基准的约定。
+ * 小区间用三数取中，大区间用 Tukey 的 ninther：把区间等分成九段，每段随机取一个元素，
+ * 相邻三个一组求中位数，再取三个中位数的中位数。只看首、中、尾三个元素时，
+ * "管风琴"输入（先升后降）的样本是 0、n/2、0，基准总是最小值，每一轮只能剥掉几个元素；
+ * 样本位置如果是固定的等间距，周期整除间距的"锯齿"输入又会让所有样本取到同一个值，所以段内位置是随机的
+ * （由区间端点决定的伪随机数，同样的输入得到同样的结果）。
+ * 当参与比较的三个（中位）数中出现相等元素时，认为输入中重复元素较多，改用 `partition3()`。
+ *
+ * 与 `introsort.h` 相同，每个子区间带着剩余的递归深度（初始为 2*log2(n)），
+ * 耗尽时改用堆排序，保证最坏情况 \f$O(n \log n)\f$。
+ *
+ * 每次分区都只在一个线程上进行，如果从整个数组开始递归，第一轮 O(n) 的分区、
+ * 第二轮 O(n/2) 的分区……都是串行的，关键路径长度至少约为 2n，加速比被限制在 log2(n)/2 左右。
+ * 所以多线程且区间超过 `kDistributeCutoff` 时，先做一轮并行的样本排序式分桶（`distribute()`）：
+ *
+ * 1. 随机抽取样本并排序，等间隔选出若干分隔元素（去重）；
+ * 2. 每个线程处理连续的一段：移到缓冲区，用二分查找确定每个元素所属的桶并计数；
+ * 3. 由各线程各桶的计数求前缀和，得到每个线程在每个桶中的写入位置；
+ * 4. 每个线程把自己那一段的元素移回原数组中对应的位置。
+ *
+ * 每个分隔元素有一个只装等于它的元素的桶，这些桶已经有序；其余桶作为任务轮流放入各线程的队列，
+ * 再由工作窃取处理。分桶的每一步都是 O(n/p) 的并行工作，需要 n 个元素的缓冲区和 n 个字节的桶编号。
+ * @tparam T 数组类型
+ */
+template <typename T>
+class parallel_sorter {
+ public:
+    /**
+     * @brief 构造函数
+     * @param arr 需要排序的数组
+     * @param num_threads 参与排序的线程数（包括调用线程）
+     */
+    parallel_sorter(std::vector<T> *arr, size_t num_threads) : arr_(arr) {
+        for (size_t i = 0; i < std::max<size_t>(num_threads, 1); i++) {
+            queues_.emplace_back(new task_queue());
+        }
+    }
+
+    /**
+     * @brief 对 [low, high] 区间进行排序，调用线程同样作为 0 号工作线程参与排序
+     * @param low 起始索引
+     * @param high 结束索引
+     */
+    void run(int low, int high) {
+        if (low >= high) {
+            return;
+        }
+        int depth = 0;
+        for (int k = high - low + 1; k > 1; k >>= 1) depth += 2;
+        if (queues_.size() > 1 && high - low + 1 >= kDistributeCutoff) {
+            distribute(low, high, depth);
+        } else {
+            push(0, {low, high, depth});
+        }
+
+        std::vector<std::thread> threads;
+        for (size_t id = 1; id < queues_.size(); id++) {
+            threads.emplace_back(&parallel_sorter::worker, this, id);
+        }
+        worker(0);
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+
+ private:
+    struct range {
+        int low;
+        int high;
+        int depth;  ///< 剩余的递归深度
+    };
+    struct task_queue {
+        std::mutex mtx;
+        std::deque<range> tasks;
+    };
+
+    static constexpr int kInsertionCutoff = 16;  ///< 小于此规模用插入排序
+    static constexpr int kSpawnCutoff = 1 << 13;  ///< 小于此规模不再拆分为任务
+    static constexpr int kNintherThreshold = 128;  ///< 大于此规模用 ninther 选择基准
+    static constexpr int kDistributeCutoff = 1 << 16;  ///< 多线程时，不小于此规模先并行分桶
+    static constexpr size_t kBucketsPerThread = 4;    ///< 每个线程分到的桶数（供工作窃取平衡负载）
+    static constexpr size_t kOversampling = 16;       ///< 每个分隔元素对应的样本数
+
+    std::vector<T> *arr_;
+    std::vector<std::unique_ptr<task_queue>> queues_;
+    std::atomic<size_t> pending_{0};  ///< 已入队但尚未完成的任务数
+
+    void push(size_t id, range r) {
+        pending_.fetch_add(1);
+        std::lock_guard<std::mutex> lock(queues_[id]->mtx);
+        queues_[id]->tasks.push_back(r);
+    }
+
+    bool pop(size_t id, range *r) {
+        std::lock_guard<std::mutex> lock(queues_[id]->mtx);
+        if (queues_[id]->tasks.empty()) {
+            return false;
+        }
+        *r = queues_[id]->tasks.back();
+        queues_[id]->tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t id, range *r) {
+        for (size_t k = 1; k < queues_.size(); k++) {
+            task_queue &victim = *queues_[(id + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mtx);
+            if (!victim.tasks.empty()) {
+                *r = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker(size_t id) {
+        range r{};
+        // 子任务总是在父任务完成之前入队，所以 pending_ 为 0 时所有工作都已完成
+        while (pending_.load() != 0) {
+            if (pop(id, &r) || steal(id, &r)) {
+                sort_range(id, r.low, r.high, r.depth);
+                pending_.fetch_sub(1);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief 在 0..t-1 号线程上各运行一次 f(id)，调用线程作为 0 号线程
+     */
+    template <typename F>
+    static void parallel_for(size_t t, const F &f) {
+        std::vector<std::thread> threads;
+        for (size_t id = 1; id < t; id++) {
+            threads.emplace_back(f, id);
+        }
+        f(0);
+        for (auto &th : threads) {
+            th.join();
+        }
+    }
+
+    /**
+     * @brief 把 [low, high] 并行地分到若干个桶中，桶之间有序，再把需要排序的桶放入任务队列
+     */
+    void distribute(int low, int high, int depth) {
+        T *a = arr_->data() + low;
+        const size_t n = size_t(high - low + 1), t = queues_.size();
+
+        // 1. 分隔元素：样本排序后等间隔选取，去重后至多 127 个，桶编号放得进一个字节
+        const size_t k = std::min<size_t>(kBucketsPerThread * t, 127);
+        std::vector<T> sample;
+        uint64_t state = n;
+        for (size_t i = 0; i < (k + 1) * kOversampling; i++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            sample.push_back(a[(state >> 32) % n]);
+        }
+        introsort::introsort(&sample);
+        std::vector<T> splitters;
+        for (size_t j = 1; j <= k; j++) {
+            const T &s = sample[j * kOversampling];
+            if (splitters.empty() || splitters.back() < s) {
+                splitters.push_back(s);
+            }
+        }
+        // 桶 2j 装 (splitters[j-1], splitters[j]) 之间的元素，桶 2j+1 装等于 splitters[j] 的元素，
+        // 最后一个桶装大于所有分隔元素的元素
+        const size_t buckets = 2 * splitters.size() + 1;
+        auto classify = [&splitters](const T &x) {
+            size_t j = size_t(std::lower_bound(splitters.begin(), splitters.end(), x) - splitters.begin());
+            return uint8_t(2 * j + (j < splitters.size() && !(x < splitters[j])));
+        };
+
+        // 2. 各线程把自己的一段移到缓冲区并计数
+        std::allocator<T> alloc;
+        T *buffer = alloc.allocate(n);
+        std::vector<uint8_t> bucket_of(n);
+        std::vector<size_t> offsets(t * buckets, 0);
+        auto chunk = [n, t](size_t id) { return std::make_pair(n * id / t, n * (id + 1) / t); };
+        parallel_for(t, [&](size_t id) {
+            auto [begin, end] = chunk(id);
+            std::uninitialized_move(a + begin, a + end, buffer + begin);
+            size_t *count = &offsets[id * buckets];
+            for (size_t i = begin; i < end; i++) {
+                bucket_of[i] = classify(buffer[i]);
+                count[bucket_of[i]]++;
+            }
+        });
+
+        // 3. 前缀和：按 桶、线程 的顺序排列，offsets[id * buckets + b] 变为写入位置
+        std::vector<size_t> bucket_begin(buckets + 1, 0);
+        size_t sum = 0;
+        for (size_t b = 0; b < buckets; b++) {
+            bucket_begin[b] = sum;
+            for (size_t id = 0; id < t; id++) {
+                size_t c = offsets[id * buckets + b];
+                offsets[id * buckets + b] = sum;
+                sum += c;
+            }
+        }
+        bucket_begin[buckets] = sum;
+
+        // 4. 各线程把自己那一段移回原数组
+        parallel_for(t, [&](size_t id) {
+            auto [begin, end] = chunk(id);
+            size_t *next = &offsets[id * buckets];
+            for (size_t i = begin; i < end; i++) {
+                a[next[bucket_of[i]]++] = std::move(buffer[i]);
+                std::destroy_at(buffer + i);
+            }
+        });
+        alloc.deallocate(buffer, n);
+
+        // 5. 等于分隔元素的桶（奇数编号）已经有序
+        size_t target = 0;
+        for (size_t b = 0; b < buckets; b += 2) {
+            if (bucket_begin[b + 1] - bucket_begin[b] > 1) {
+                push(target++ % t, {low + int(bucket_begin[b]), low + int(bucket_begin[b + 1]) - 1, depth});
+            }
+        }
+    }
+
+    void insertion_sort(int low, int high) {
+        std::vector<T> &a = *arr_;
+        if constexpr (std::is_arithmetic<T>::value) {
+            // 算术类型的小区间交给排序网络/SIMD 内核
+            sorting_network::sort_small(a.data() + low, size_t(high - low + 1));
+            return;
+        }
+        for (int i = low + 1; i <= high; i++) {
+            T key = std::move(a[i]);
+            int j = i - 1;
+            while (j >= low && key < a[j]) {
+                a[j + 1] = std::move(a[j]);
+                j--;
+            }
+            a[j + 1] = std::move(key);
+        }
+    }
+
+    void spawn_or_recurse(size_t id, int low, int high, int depth) {
+        if (queues_.size() > 1 && high - low >= kSpawnCutoff) {
+            push(id, {low, high, depth});
+        } else {
+            sort_range(id, low, high, depth);
+        }
+    }
+
+    /**
+     * @brief 选择基准并放到 a[mid]
+     * @returns 参与比较的三个（中位）数中是否有相等元素
+     */
+    bool choose_pivot(int low, int high, int mid) {
+        T *a = arr_->data();
+        int n = high - low + 1;
+        if (n <= kNintherThreshold) {
+            introsort::sort3(&a[low], &a[mid], &a[high]);
+            return !(a[low] < a[mid]) || !(a[mid] < a[high]);
+        }
+        // 九段中各取一个随机位置（线性同余生成器，取高 32 位）
+        uint64_t state = uint64_t(low) * 0x9e3779b97f4a7c15ULL ^ uint64_t(high);
+        T *p[9];
+        for (int k = 0; k < 9; k++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            int begin = low + int(int64_t(n) * k / 9), end = low + int(int64_t(n) * (k + 1) / 9);
+            p[k] = &a[begin + int((state >> 32) % uint64_t(end - begin))];
+        }
+        introsort::sort3(p[0], p[1], p[2]);
+        introsort::sort3(p[3], p[4], p[5]);
+        introsort::sort3(p[6], p[7], p[8]);
+        introsort::sort3(p[1], p[4], p[7]);
+        bool duplicates = !(*p[1] < *p[4]) || !(*p[4] < *p[7]);
+        std::swap(*p[4], a[mid]);
+        return duplicates;
+    }
+
+    void sort_range(size_t id, int low, int high, int depth) {
+        std::vector<T> &a = *arr_;
+        while (high - low >= kInsertionCutoff) {
+            if (depth == 0) {
+                heap_sort::heapSort(a.data() + low, high - low + 1);
+                return;
+            }
+            depth--;
+
+            int mid = low + (high - low) / 2;
+            bool duplicates = choose_pivot(low, high, mid);
+            std::swap(a[mid], a[high]);
+
+            int left_high = 0, right_low = 0;
+            if (duplicates) {
+                partition3(arr_, low, high, &left_high, &right_low);
+            } else {
+                int p = partition(arr_, low, high);
+                left_high = p - 1;
+                right_low = p + 1;
+            }
+
+            if (left_high - low < high - right_low) {
+                spawn_or_recurse(id, low, left_high, depth);
+                low = right_low;
+            } else {
+                spawn_or_recurse(id, right_low, high, depth);
+                high = left_high;
+            }
+        }
+        insertion_sort(low, high);
+    }
+};
+
+/**
+ * @brief 快速排序的并行版本
+ * @details
+ * 与递归版本的接口相同，只是多了一个线程数参数。子区间通过工作窃取任务池
+ * 分配给各个线程，重复元素较多时自动改用三路分区，递归过深时改用堆排序。
+ * @tparam T 数组类型
+ * @param arr 需要排序的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param num_threads 参与排序的线程数，通常取 `std::thread::hardware_concurrency()`
+ */
+template <typename T>
+void quick_sort(std::vector<T> *arr, const int &low, const int &high,
+                size_t num_threads) {
+    parallel_sorter<T>(arr, num_threads).run(low, high);
+}
+
+/**
+ * @brief 打印数组内容的辅助函数
+ * @param arr 需要打印的数组
+ * @param size 数组的大小
+ * @returns void
+ */
+template <typename T>
+void show(const std::vector<T> &arr, const int &size) {
+    for (int i = 0; i < size; i++) std::cout << arr[i] << " ";
+    std::cout << "\n";
+}
+
+}  // namespace quick_sort
+}  // namespace sorting
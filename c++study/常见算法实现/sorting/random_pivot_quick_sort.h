@@ -0,0 +1,115 @@
+/**
+ * @file random_pivot_quick_sort.h
+ * @brief [随机枢轴快速排序](https://www.sanfoundry.com/cpp-program-implement-quick-sort-using-randomisation) 的实现
+ * @details
+ * 与传统的快速排序只有枢轴的选择不同：用随机下标处的元素作为枢轴，换到区间末尾后做 Lomuto 分区。
+ * 对任何固定的输入，期望时间复杂度都是 \f$O(n \log n)\f$，有序或逆序的输入不再是最坏情况；
+ * 但 Lomuto 分区把等于枢轴的元素都放在左边，大量重复元素时仍会退化为 \f$O(n^2)\f$。
+ *
+ * 随机数由一个固定种子的 `std::mt19937_64` 产生，同样的调用序列得到同样的结果。
+ * 排序在原数组上进行；`std::array` 版本的接口按值传入、返回排好序的副本。
+ */
+#pragma once
+
+#include <array>    /// 用于 std::array
+#include <cstddef>  /// 用于 size_t
+#include <cstdint>  /// 用于 int64_t
+#include <random>   /// 用于 std::mt19937_64
+#include <tuple>    /// 用于从函数返回多个值
+#include <utility>  /// 用于 std::swap
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief [随机枢轴快速排序](https://www.sanfoundry.com/cpp-program-implement-quick-sort-using-randomisation) 实现的函数
+ * @namespace random_pivot_quick_sort
+ */
+namespace random_pivot_quick_sort {
+/**
+ * @brief 获取数组中指定范围内的随机索引
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ * @returns int64_t 返回起始索引到结束索引之间的随机整数
+ */
+inline int64_t getRandomIndex(int64_t start, int64_t end) {
+    static std::mt19937_64 rng(5489);  // 只初始化一次随机数生成器
+    return start + int64_t(rng() % uint64_t(end - start + 1));
+}
+
+/**
+ * @brief 快速排序的分区函数，以 arr[end] 为枢轴
+ * @param arr 要分区的数组
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ * @returns 枢轴元素最终的索引
+ */
+template <typename T>
+int64_t partition(T *arr, int64_t start, int64_t end) {
+    T pivot = arr[end];  // 选择最后一个元素作为枢轴
+    int64_t pInd = start;
+
+    // 遍历数组，按大小对元素进行分区
+    for (int64_t i = start; i < end; i++) {
+        if (!(pivot < arr[i])) {
+            std::swap(arr[i], arr[pInd]);  // 交换当前元素和分区索引位置的元素
+            pInd++;
+        }
+    }
+    std::swap(arr[pInd], arr[end]);  // 将枢轴元素放到正确的位置
+    return pInd;
+}
+
+/**
+ * @brief 快速排序的分区函数
+ * @tparam size 数组的大小
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ * @returns std::tuple<int64_t , std::array<int64_t , size>> 返回枢轴元素的索引和分区后的数组
+ */
+template <size_t size>
+std::tuple<int64_t, std::array<int64_t, size>> partition(
+    std::array<int64_t, size> arr, int64_t start, int64_t end) {
+    int64_t pInd = partition(arr.data(), start, end);
+    return std::make_tuple(pInd, arr);  // 返回分区索引和分区后的数组
+}
+
+/**
+ * @brief 随机枢轴快速排序函数，对 arr[start..end] 原地排序
+ * @param arr 要排序的数组
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ */
+template <typename T>
+void quickSortRP(T *arr, int64_t start, int64_t end) {
+    if (start < end) {
+        int64_t randomIndex = getRandomIndex(start, end);
+
+        // 将枢轴与数组的最后一个元素交换
+        std::swap(arr[end], arr[randomIndex]);
+
+        int64_t pivotIndex = partition(arr, start, end);
+
+        // 递归调用对左右子数组进行排序
+        quickSortRP(arr, start, pivotIndex - 1);
+        quickSortRP(arr, pivotIndex + 1, end);
+    }
+}
+
+/**
+ * @brief 随机枢轴快速排序函数
+ * @tparam size 数组的大小
+ * @param start 数组的起始索引
+ * @param end 数组的结束索引
+ * @returns std::array<int64_t , size> 返回排序后的数组
+ */
+template <size_t size>
+std::array<int64_t, size> quickSortRP(std::array<int64_t, size> arr,
+                                      int64_t start, int64_t end) {
+    quickSortRP(arr.data(), start, end);
+    return arr;
+}
+}  // namespace random_pivot_quick_sort
+}  // namespace sorting
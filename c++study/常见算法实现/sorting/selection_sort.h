@@ -0,0 +1,157 @@
+/**
+ * @file selection_sort.h
+ * @brief [选择排序](https://en.wikipedia.org/wiki/Selection_sort) 的几种实现
+ * @details
+ * 选择排序把数组分为已排序的前缀和未排序的剩余部分，每次从未排序部分选出最小元素，
+ * 与未排序部分最左边的元素交换。比较次数总是 \f$O(n^2)\f$，但交换只有 \f$O(n)\f$ 次。
+ *
+ * - selectionSort：迭代版本，返回排好序的副本；
+ * - selection_sort_recursive：用递归查找最小值、递归缩小未排序部分，递归深度为 \f$O(n)\f$；
+ * - CocktailSelectionSort：鸡尾酒选择排序，每一轮同时选出最小和最大元素，放到两端。
+ */
+#pragma once
+
+#include <cstdint>  /// 用于 uint64_t, int64_t
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief 选择排序的主函数实现
+ * @param arr 需要排序的向量
+ * @param len 向量的长度
+ * @returns 返回排序后的向量
+ */
+template <typename T>
+std::vector<T> selectionSort(const std::vector<T> &arr, uint64_t len) {
+    std::vector<T> array(arr.begin(), arr.end());  // 声明一个新的向量用于存储结果
+    for (uint64_t it = 0; it < len; ++it) {
+        uint64_t min = it;  // 初始化最小值为当前索引
+        for (uint64_t it2 = it + 1; it2 < len; ++it2) {
+            if (array[it2] < array[min]) {  // 找到比当前最小值更小的元素
+                min = it2;                  // 更新最小值的索引
+            }
+        }
+
+        if (min != it) {  // 如果最小值的索引不等于当前索引，交换元素
+            T tmp = array[min];
+            array[min] = array[it];
+            array[it] = tmp;
+        }
+    }
+
+    return array;  // 返回排序后的向量
+}
+
+/**
+ * @namespace selection_sort_recursive
+ * @brief 使用递归实现的 [选择排序](https://en.wikipedia.org/wiki/Selection_sort)
+ */
+namespace selection_sort_recursive {
+/**
+ * @brief 主要函数用于查找最小元素的索引
+ * @tparam T 数组的类型
+ * @param in_arr 要查找最小元素的数组（不能为空）
+ * @param current_position 当前处理的位置（索引）
+ * @returns 最小元素的索引
+ */
+template <typename T>
+uint64_t findMinIndex(const std::vector<T> &in_arr,
+                      uint64_t current_position = 0) {
+    // 如果当前位置是数组的倒数第二个元素，返回当前位置
+    if (current_position + 1 == in_arr.size()) {
+        return current_position;
+    }
+    // 递归调用，找到当前数组中最小元素的索引
+    uint64_t answer = findMinIndex(in_arr, current_position + 1);
+    // 如果当前位置的元素更小，更新最小元素的索引
+    if (in_arr[current_position] < in_arr[answer]) {
+        answer = current_position;
+    }
+    return answer;
+}
+
+/**
+ * @brief 主要函数实现选择排序
+ * @tparam T 数组的类型
+ * @param in_arr 要排序的数组，
+ * @param current_position 当前处理的位置（索引）
+ * @returns void
+ */
+template <typename T>
+void selectionSortRecursive(std::vector<T> &in_arr,
+                            uint64_t current_position = 0) {
+    // 当当前位置等于数组的大小时，排序完成，递归结束
+    if (current_position == in_arr.size()) {
+        return;
+    }
+    // 找到从当前位置开始的最小元素的索引
+    uint64_t min_element_idx =
+        selection_sort_recursive::findMinIndex(in_arr, current_position);
+    // 如果最小元素的索引不等于当前索引，交换位置
+    if (min_element_idx != current_position) {
+        std::swap(in_arr[min_element_idx], in_arr[current_position]);
+    }
+    // 对剩余未排序部分递归进行选择排序
+    selectionSortRecursive(in_arr, current_position + 1);
+}
+}  // namespace selection_sort_recursive
+
+/**
+ * @brief 把 [low, high] 中最小的元素交换到 low、最大的元素交换到 high
+ * @details 最大元素原来在 low 时，第一次交换后它已经被换到了最小元素原来的位置。
+ */
+template <typename T>
+void CocktailSelectionStep(std::vector<T> *vec, int64_t low, int64_t high) {
+    // 查找最小值和最大值的索引
+    int64_t minimumindex = low;
+    int64_t maximumindex = low;
+    for (int64_t i = low + 1; i <= high; i++) {
+        if ((*vec)[i] < (*vec)[minimumindex]) {
+            minimumindex = i;
+        }
+        if ((*vec)[maximumindex] < (*vec)[i]) {
+            maximumindex = i;
+        }
+    }
+
+    std::swap((*vec)[low], (*vec)[minimumindex]);
+    if (maximumindex == low) {
+        maximumindex = minimumindex;
+    }
+    std::swap((*vec)[high], (*vec)[maximumindex]);
+}
+
+/**
+ * @brief 迭代版本的鸡尾酒选择排序，对闭区间 [low, high] 排序
+ */
+template <typename T>
+void CocktailSelectionSort(std::vector<T> *vec, int64_t low, int64_t high) {
+    // 每一轮把最小和最大元素放到两端，然后继续处理剩余的部分
+    while (low < high) {
+        CocktailSelectionStep(vec, low, high);
+        low++;
+        high--;
+    }
+}
+
+/**
+ * @brief 递归版本的鸡尾酒选择排序，对闭区间 [low, high] 排序
+ */
+template <typename T>
+void CocktailSelectionSort_v2(std::vector<T> *vec, int64_t low, int64_t high) {
+    // 递归终止条件
+    if (low >= high) {
+        return;
+    }
+
+    CocktailSelectionStep(vec, low, high);
+
+    // 递归处理剩余部分
+    CocktailSelectionSort_v2(vec, low + 1, high - 1);
+}
+}  // namespace sorting
@@ -0,0 +1,83 @@
+/**
+ * @file shell_sort.h
+ * @brief [Shell 排序](https://en.wikipedia.org/wiki/Shell_sort) 的实现
+ * @details
+ * 按一个递减的间隔序列做多轮“间隔插入排序”，最后一轮间隔为 1 即普通插入排序。
+ * 前几轮让元素大跨度地移动到接近最终位置，最后一轮只需要少量移动。
+ *
+ * - shell_sort_halving 使用 Shell 最初的序列 n/2, n/4, ..., 1，最坏 \f$O(n^2)\f$；
+ * - shell_sort 使用 Ciura 的经验序列 701, 301, ..., 1，对中等规模的数据通常更快，
+ *   但序列不随 n 增长，数据很大时会退化。
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <vector>   /// 用于 std::vector
+
+/**
+ * \namespace sorting
+ * \brief 排序算法
+ */
+namespace sorting {
+/**
+ * 使用间隔序列 n/2, n/4, ..., 1 的Shell排序
+ * \param[in,out] arr 要排序的数组
+ * \param[in] LEN 数组的长度
+ **/
+template <typename T>
+void shell_sort_halving(T *arr, size_t LEN) {
+    for (size_t i = LEN / 2; i > 0; i = i / 2) {  // 逐步缩小步长
+        for (size_t j = i; j < LEN; j++) {  // 从步长位置开始遍历数组
+            for (size_t k = j; k >= i; k = k - i) {  // 在当前步长范围内进行插入排序
+                if (!(arr[k] < arr[k - i])) {  // 如果前一个元素不大于当前元素，跳出循环（相等时不再交换）
+                    break;
+                } else {
+                    // 交换前一个元素和当前元素
+                    T temp = arr[k];
+                    arr[k] = arr[k - i];
+                    arr[k - i] = temp;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * 优化版的Shell排序算法，利用Mar方法减少排序时间
+ **/
+template <typename T>
+void shell_sort(T *arr, size_t LEN) {
+    const unsigned int gaps[] = {701, 301, 132, 57, 23, 10, 4, 1};  // 间隔序列
+    const unsigned int gap_len = 8;  // 间隔序列的长度
+    size_t i, j, g;
+
+    // 遍历间隔序列
+    for (g = 0; g < gap_len; g++) {
+        unsigned int gap = gaps[g];
+        // 按间隔大小遍历数组
+        for (i = gap; i < LEN; i++) {
+            T tmp = arr[i];  // 临时保存当前元素
+
+            // 使用插入排序的方式，将元素插入到正确位置
+            for (j = i; j >= gap && tmp < arr[j - gap]; j -= gap) {
+                arr[j] = arr[j - gap];
+            }
+
+            arr[j] = tmp;  // 将元素插入正确的位置
+        }
+    }
+}
+
+/** 函数重载 - 针对已知长度的数组类型 */
+template <typename T, size_t N>
+void shell_sort(T (&arr)[N]) {
+    shell_sort(arr, N);
+}
+
+/** 函数重载 - 当输入数组是std::vector时，直接将数据和长度传递给上面的函数 */
+template <typename T>
+void shell_sort(std::vector<T> *arr) {
+    shell_sort(arr->data(), arr->size());
+}
+
+}  // namespace sorting
@@ -1,15 +1,19 @@
 /**
  * \file
- * \brief [Shell sort](https://en.wikipedia.org/wiki/Shell_sort) 算法实现
+ * \brief [Shell sort](https://en.wikipedia.org/wiki/Shell_sort) 算法的测试，实现见 `shell_sort.h`
  * \author [Krishna Vedala](https://github.com/kvedala)
  */
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <utility>  // for std::swap
 #include <vector>
 
+#include "./shell_sort.h"
+
 /** 
  * 打印数组
  * \param[in] arr 需要打印的数组
@@ -35,51 +39,6 @@ void show_data(T (&arr)[N]) {
     show_data(arr, N);
 }
 
-/** 
- * \namespace sorting
- * \brief 排序算法
- */
-namespace sorting {
-/**
- * 优化版的Shell排序算法，利用Mar方法减少排序时间
- **/
-template <typename T>
-void shell_sort(T *arr, size_t LEN) {
-    const unsigned int gaps[] = {701, 301, 132, 57, 23, 10, 4, 1};  // 间隔序列
-    const unsigned int gap_len = 8;  // 间隔序列的长度
-    size_t i, j, g;
-
-    // 遍历间隔序列
-    for (g = 0; g < gap_len; g++) {
-        unsigned int gap = gaps[g];
-        // 按间隔大小遍历数组
-        for (i = gap; i < LEN; i++) {
-            T tmp = arr[i];  // 临时保存当前元素
-
-            // 使用插入排序的方式，将元素插入到正确位置
-            for (j = i; j >= gap && (arr[j - gap] - tmp) > 0; j -= gap) {
-                arr[j] = arr[j - gap];
-            }
-
-            arr[j] = tmp;  // 将元素插入正确的位置
-        }
-    }
-}
-
-/** 函数重载 - 针对已知长度的数组类型 */
-template <typename T, size_t N>
-void shell_sort(T (&arr)[N]) {
-    shell_sort(arr, N);
-}
-
-/** 函数重载 - 当输入数组是std::vector时，直接将数据和长度传递给上面的函数 */
-template <typename T>
-void shell_sort(std::vector<T> *arr) {
-    shell_sort(arr->data(), arr->size());
-}
-
-}  // namespace sorting
-
 using sorting::shell_sort;
 
 /**
@@ -197,6 +156,15 @@ int main(int argc, char *argv[]) {
     test_f(10000);
     std::cout << "Test 3 - 10000个浮点数 - 通过。\n";
 
+    // 无符号数，以及相减会溢出的整数，都要直接比较大小而不是看差的符号
+    unsigned int u[] = {3, 1, 2, 0, 5, 4};
+    shell_sort(u);
+    assert(std::is_sorted(std::begin(u), std::end(u)));
+    int extremes[] = {INT_MAX, INT_MIN, 0, -1, 1, INT_MIN + 1};
+    shell_sort(extremes);
+    assert(std::is_sorted(std::begin(extremes), std::end(extremes)));
+    std::cout << "Test 4 - 无符号数与极值 - 通过。\n";
+
     int i, NUM_DATA;
 
     if (argc == 2)
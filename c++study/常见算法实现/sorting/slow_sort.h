@@ -0,0 +1,44 @@
+/**
+ * @file slow_sort.h
+ * @brief SlowSort 排序算法
+ * @details
+ * SlowSort是一种幽默性质的排序算法，实际上并不实用。
+ * 它基于“乘以并投降”（multiply and surrender）的原则，这是“分而治之”方法的一种戏谑，
+ * 由Andrei Broder和Jorge Stolfi在1986年的论文《Pessimal Algorithms and Simplexity Analysis》中提出。
+ * 先递归排序两半，把最大值放到末尾，再递归排序除最大值以外的部分，
+ * 运行时间不是 n 的多项式，只能用于很小的输入。
+ */
+#pragma once
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @brief SlowSort 算法的实现，对 a[i..j] 排序
+ */
+template <typename T>
+void SlowSort(T a[], int i, int j) {
+    if (i >= j)  // 如果i大于或等于j，则无需继续排序
+        return;
+    int m = i + (j - i) / 2;  // 计算中点m，避免溢出的方式
+    T temp;
+
+    // 对左半部分排序
+    SlowSort(a, i, m);
+
+    // 对右半部分排序
+    SlowSort(a, m + 1, j);
+
+    // 如果右部分的元素小于中点元素，则交换两者
+    if (a[j] < a[m]) {
+        temp = a[j];  // 交换a[j]和a[m]
+        a[j] = a[m];
+        a[m] = temp;
+    }
+
+    // 对剩余部分进行排序
+    SlowSort(a, i, j - 1);
+}
+}  // namespace sorting
@@ -0,0 +1,374 @@
+/**
+ * @file sort_benchmark.h
+ * @brief 排序算法的统一基准测试框架：标准数据分布、比较/移动计数、峰值内存与 CSV 输出
+ * @details
+ * `sorting/` 下每个排序都有自己的 `test()`/`main`，签名各不相同，也没有统一的计时。这里提供：
+ *
+ * 1. **数据分布**：随机、已排序、逆序、少量不同值、管风琴、Zipf（s = 1）、只有 0/1/2 三种值，
+ *    `generate()` 按种子生成，同一种子得到同样的输入，不同版本之间的结果可以直接对比；
+ *    `value_bound()` 给出每种分布的最大值，值域受限的算法（计数排序、珠排序等）据此跳过放不下的分布；
+ * 2. **计数**：`counted<T>` 包装元素类型，每次 `operator<`/`operator==` 记一次比较，每次拷贝/移动构造或赋值记一次移动。
+ *    计数在单独的一轮中进行，不影响计时；计数轮里元素不是算术类型，
+ *    因此排序网络/SIMD 内核等只对算术类型启用的路径会换成插入排序，计数反映的是通用路径；
+ * 3. **峰值内存**：框架只提供 `record_allocation()`/`record_free()`，由驱动程序替换全局的
+ *    `operator new`/`operator delete` 后调用（见 `排序基准测试.cpp`），统计的是排序过程中额外申请的堆内存；
+ * 4. **输出**：每个（算法，分布，规模）一行 CSV，`compare()` 读入之前保存的 CSV，
+ *    找出 ns/元素 变慢超过给定比例的组合，用于发现性能回退。
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::sort, std::upper_bound
+#include <atomic>      /// 用于 std::atomic
+#include <chrono>      /// 用于计时
+#include <cstddef>     /// 用于 size_t
+#include <cstdint>     /// 用于 uint64_t, int64_t
+#include <functional>  /// 用于 std::function
+#include <istream>     /// 用于 std::istream
+#include <limits>      /// 用于 std::numeric_limits
+#include <map>         /// 用于 std::map
+#include <ostream>     /// 用于 std::ostream
+#include <random>      /// 用于 std::mt19937_64
+#include <sstream>     /// 用于 std::istringstream
+#include <stdexcept>   /// 用于 std::runtime_error
+#include <string>      /// 用于 std::string
+#include <tuple>       /// 用于 std::tuple
+#include <vector>      /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace benchmark
+ * @brief 排序基准测试框架
+ */
+namespace benchmark {
+/**
+ * @brief 输入数据的分布
+ */
+enum class distribution { random, sorted, reversed, few_unique, organ_pipe, zipf, ternary };
+
+/// 所有分布，按输出顺序排列
+constexpr distribution kAllDistributions[] = {
+    distribution::random,     distribution::sorted,     distribution::reversed,
+    distribution::few_unique, distribution::organ_pipe, distribution::zipf,
+    distribution::ternary};
+
+constexpr uint64_t kFewUniqueValues = 16;  ///< few_unique 分布的不同值个数
+constexpr size_t kZipfUniverse = 1 << 20;  ///< zipf 分布的最大取值个数
+constexpr size_t kMinSampleElements = 1 << 20;  ///< 小规模时重复排序，直到累计排序这么多元素
+constexpr double kMaxSampleNanoseconds = 5e7;   ///< 重复排序累计超过这么长时间后不再重复（O(n^2) 算法）
+
+/**
+ * @brief 分布的名字（CSV 中使用）
+ */
+inline const char *name(distribution d) {
+    switch (d) {
+        case distribution::random:
+            return "random";
+        case distribution::sorted:
+            return "sorted";
+        case distribution::reversed:
+            return "reversed";
+        case distribution::few_unique:
+            return "few_unique";
+        case distribution::organ_pipe:
+            return "organ_pipe";
+        case distribution::zipf:
+            return "zipf";
+        case distribution::ternary:
+            return "ternary";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief n 个元素的输入中可能出现的最大值（与种子无关）
+ */
+inline uint64_t value_bound(distribution d, size_t n) {
+    switch (d) {
+        case distribution::random:
+            break;
+        case distribution::sorted:
+            return n == 0 ? 0 : n - 1;
+        case distribution::reversed:
+            return n;
+        case distribution::few_unique:
+            return kFewUniqueValues - 1;
+        case distribution::organ_pipe:
+            return n == 0 ? 0 : (n - 1) / 2;
+        case distribution::zipf:
+            return std::max<size_t>(1, std::min(n, kZipfUniverse)) - 1;
+        case distribution::ternary:
+            return 2;
+    }
+    return std::numeric_limits<uint64_t>::max();
+}
+
+/**
+ * @brief 生成 n 个元素的输入
+ * @param d 分布
+ * @param n 元素个数
+ * @param seed 随机数种子
+ */
+inline std::vector<uint64_t> generate(distribution d, size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> out(n);
+    switch (d) {
+        case distribution::random:
+            for (auto &v : out) v = rng();
+            break;
+        case distribution::sorted:
+            for (size_t i = 0; i < n; i++) out[i] = i;
+            break;
+        case distribution::reversed:
+            for (size_t i = 0; i < n; i++) out[i] = n - i;
+            break;
+        case distribution::few_unique:
+            for (auto &v : out) v = rng() % kFewUniqueValues;
+            break;
+        case distribution::organ_pipe:
+            for (size_t i = 0; i < n; i++) out[i] = std::min(i, n - 1 - i);
+            break;
+        case distribution::zipf: {
+            // 取值 k 的概率正比于 1 / (k + 1)，按累积分布二分查找
+            size_t universe = std::max<size_t>(1, std::min(n, kZipfUniverse));
+            std::vector<double> cdf(universe);
+            double sum = 0;
+            for (size_t k = 0; k < universe; k++) {
+                sum += 1.0 / double(k + 1);
+                cdf[k] = sum;
+            }
+            std::uniform_real_distribution<double> uniform(0, sum);
+            for (auto &v : out) {
+                size_t k = std::upper_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+                v = std::min(k, universe - 1);
+            }
+            break;
+        }
+        case distribution::ternary:
+            for (auto &v : out) v = rng() % 3;
+            break;
+    }
+    return out;
+}
+
+inline std::atomic<uint64_t> comparisons{0};  ///< counted<T> 的比较次数
+inline std::atomic<uint64_t> moves{0};        ///< counted<T> 的移动次数
+
+/**
+ * @brief 统计比较与移动次数的元素包装
+ * @details 计数器是全局的原子变量，并行排序也能正确计数；默认构造不计入移动。
+ */
+template <typename T>
+class counted {
+ public:
+    counted() = default;
+    explicit counted(T value) : value_(value) {}
+    counted(const counted &other) : value_(other.value_) {
+        moves.fetch_add(1, std::memory_order_relaxed);
+    }
+    counted(counted &&other) noexcept : value_(other.value_) {
+        moves.fetch_add(1, std::memory_order_relaxed);
+    }
+    counted &operator=(const counted &other) {
+        value_ = other.value_;
+        moves.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+    counted &operator=(counted &&other) noexcept {
+        value_ = other.value_;
+        moves.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+
+    /** @brief 取出值（不计数），用于基数排序的键函数 */
+    const T &value() const { return value_; }
+
+    friend bool operator<(const counted &a, const counted &b) {
+        comparisons.fetch_add(1, std::memory_order_relaxed);
+        return a.value_ < b.value_;
+    }
+    friend bool operator>(const counted &a, const counted &b) { return b < a; }
+    friend bool operator<=(const counted &a, const counted &b) { return !(b < a); }
+    friend bool operator>=(const counted &a, const counted &b) { return !(a < b); }
+    friend bool operator==(const counted &a, const counted &b) {
+        comparisons.fetch_add(1, std::memory_order_relaxed);
+        return a.value_ == b.value_;
+    }
+    friend bool operator!=(const counted &a, const counted &b) { return !(a == b); }
+
+ private:
+    T value_{};
+};
+
+inline std::atomic<int64_t> heap_current{0};  ///< 当前已申请的堆内存（字节）
+inline std::atomic<int64_t> heap_peak{0};     ///< heap_current 的峰值
+
+/**
+ * @brief 记录一次堆内存申请（由驱动程序替换的 operator new 调用）
+ */
+inline void record_allocation(size_t bytes) {
+    int64_t now =
+        heap_current.fetch_add(int64_t(bytes), std::memory_order_relaxed) + int64_t(bytes);
+    int64_t peak = heap_peak.load(std::memory_order_relaxed);
+    while (now > peak && !heap_peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief 记录一次堆内存释放（由驱动程序替换的 operator delete 调用）
+ */
+inline void record_free(size_t bytes) {
+    heap_current.fetch_sub(int64_t(bytes), std::memory_order_relaxed);
+}
+
+/**
+ * @brief 一个参与基准测试的排序算法
+ */
+struct sort_entry {
+    std::string name;  ///< 算法名（CSV 中使用）
+    size_t max_size;   ///< 超过此规模不测试（例如最坏情况退化为 O(n^2) 的算法）
+    std::function<void(std::vector<uint64_t> *)> sort;  ///< 计时用
+    std::function<void(std::vector<counted<uint64_t>> *)> sort_counted;  ///< 计数用，可以为空
+    uint64_t max_value = std::numeric_limits<uint64_t>::max();  ///< 输入的最大值超过它时不测试（见 value_bound）
+};
+
+/**
+ * @brief 一次测量的结果，计数为 -1 表示没有测量
+ */
+struct result {
+    std::string algorithm;
+    std::string distribution;
+    size_t n = 0;
+    double ns_per_element = 0;
+    int64_t comparisons = -1;
+    int64_t moves = -1;
+    int64_t peak_bytes = -1;
+};
+
+/**
+ * @brief 测量一个（算法，分布，规模）组合
+ * @details 规模较小时重复排序同一份输入的拷贝，累计至少 kMinSampleElements 个元素，只计排序本身的时间；
+ * 累计时间超过 kMaxSampleNanoseconds 后提前停止，慢的算法在小规模上不会重复成千上万次。
+ * 排序结果与 std::sort 的结果不同时抛出 std::runtime_error。
+ * @param entry 算法
+ * @param d 分布
+ * @param n 规模
+ * @param count_max 规模不超过它时额外做一轮计数
+ */
+inline result measure(const sort_entry &entry, distribution d, size_t n, size_t count_max) {
+    const std::vector<uint64_t> input = generate(d, n, 12345 + n);
+    std::vector<uint64_t> expected = input;  // 只检查有序不够：丢失或重复元素的结果也可能有序
+    std::sort(expected.begin(), expected.end());
+    result r;
+    r.algorithm = entry.name;
+    r.distribution = name(d);
+    r.n = n;
+
+    size_t reps = std::max<size_t>(1, kMinSampleElements / std::max<size_t>(n, 1));
+    double total_ns = 0;
+    int64_t peak = 0;
+    size_t done = 0;
+    for (; done < reps && total_ns < kMaxSampleNanoseconds; done++) {
+        std::vector<uint64_t> a = input;
+        int64_t base = heap_current.load();
+        heap_peak.store(base);
+        auto t0 = std::chrono::steady_clock::now();
+        entry.sort(&a);
+        auto t1 = std::chrono::steady_clock::now();
+        total_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        peak = std::max(peak, heap_peak.load() - base);
+        if (done == 0 && a != expected) {
+            throw std::runtime_error(entry.name + " 在 " + r.distribution + " 分布上排序结果错误");
+        }
+    }
+    r.ns_per_element = total_ns / double(done) / double(std::max<size_t>(n, 1));
+    r.peak_bytes = peak;
+
+    if (entry.sort_counted && n <= count_max) {
+        std::vector<counted<uint64_t>> c(input.begin(), input.end());
+        comparisons = 0;
+        moves = 0;
+        entry.sort_counted(&c);
+        r.comparisons = int64_t(comparisons.load());
+        r.moves = int64_t(moves.load());
+    }
+    return r;
+}
+
+/**
+ * @brief 输出 CSV 表头
+ */
+inline void write_csv_header(std::ostream &out) {
+    out << "algorithm,distribution,n,ns_per_element,comparisons,moves,peak_bytes\n";
+}
+
+/**
+ * @brief 输出一行 CSV，没有测量的字段留空
+ */
+inline void write_csv_row(std::ostream &out, const result &r) {
+    auto optional = [](int64_t v) { return v < 0 ? std::string() : std::to_string(v); };
+    out << r.algorithm << ',' << r.distribution << ',' << r.n << ',' << r.ns_per_element << ','
+        << optional(r.comparisons) << ',' << optional(r.moves) << ',' << optional(r.peak_bytes)
+        << '\n';
+}
+
+/**
+ * @brief 读入 write_csv_header/write_csv_row 写出的 CSV
+ */
+inline std::vector<result> read_csv(std::istream &in) {
+    std::vector<result> rows;
+    std::string line;
+    std::getline(in, line);  // 表头
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        std::vector<std::string> fields;
+        std::istringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ',')) fields.push_back(field);
+        fields.resize(7);
+        auto optional = [](const std::string &s) { return s.empty() ? -1 : std::stoll(s); };
+        result r;
+        r.algorithm = fields[0];
+        r.distribution = fields[1];
+        r.n = std::stoull(fields[2]);
+        r.ns_per_element = std::stod(fields[3]);
+        r.comparisons = optional(fields[4]);
+        r.moves = optional(fields[5]);
+        r.peak_bytes = optional(fields[6]);
+        rows.push_back(r);
+    }
+    return rows;
+}
+
+/**
+ * @brief 与基线对比，输出变慢超过 tolerance（例如 0.1 表示 10%）的组合
+ * @details 比较次数或移动次数增加也视为回退：它们与机器无关，任何增加都说明算法行为变了。
+ * @returns 回退的组合个数
+ */
+inline size_t compare(const std::vector<result> &baseline, const std::vector<result> &current,
+                      double tolerance, std::ostream &out) {
+    std::map<std::tuple<std::string, std::string, size_t>, result> base;
+    for (const auto &r : baseline) base[{r.algorithm, r.distribution, r.n}] = r;
+    size_t regressions = 0;
+    for (const auto &r : current) {
+        auto it = base.find({r.algorithm, r.distribution, r.n});
+        if (it == base.end()) continue;
+        const result &b = it->second;
+        bool slower = r.ns_per_element > b.ns_per_element * (1 + tolerance);
+        bool more_work = (b.comparisons >= 0 && r.comparisons > b.comparisons) ||
+                         (b.moves >= 0 && r.moves > b.moves);
+        if (slower || more_work) {
+            regressions++;
+            out << "回退: " << r.algorithm << ' ' << r.distribution << " n=" << r.n
+                << "  ns/元素 " << b.ns_per_element << " -> " << r.ns_per_element
+                << "  比较 " << b.comparisons << " -> " << r.comparisons << "  移动 " << b.moves
+                << " -> " << r.moves << '\n';
+        }
+    }
+    return regressions;
+}
+}  // namespace benchmark
+}  // namespace sorting
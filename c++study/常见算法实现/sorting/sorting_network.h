@@ -0,0 +1,465 @@
+/**
+ * @file sorting_network.h
+ * @brief 编译期生成的 [排序网络](https://en.wikipedia.org/wiki/Sorting_network)（N <= 64），
+ * 以及 AVX2/SSE4 向量化的 [Bitonic 排序](https://en.wikipedia.org/wiki/Bitonic_sorter) 内核
+ * @details
+ * `bitonic_sort.h` 是递归的标量教科书版本。这里提供两种小数组排序内核，
+ * 用作快速排序、归并排序在小区间上的基例：
+ *
+ * 1. **排序网络**：用 Batcher 奇偶归并网络在编译期为每个 N 生成比较器序列，
+ *    超出 N 的比较器（相当于末尾补 +∞）直接丢弃，因此任意 N 都适用。
+ *    比较交换写成 `s = b < a; lo = s ? b : a; hi = s ? a : b`，编译成条件传送，没有分支；
+ *    N 不超过 `kMaxUnrolledSize` 时比较器序列通过折叠表达式完全展开，更长的网络循环遍历编译期生成的
+ *    比较器数组（完全展开 64 个网络会让每个元素类型的编译时间长达十几秒）。
+ *    `network_sort_n()` 通过函数表按运行时长度分发。
+ * 2. **SIMD Bitonic**：对 int32/float/int64，把数组补齐到 2 的幂后整块放进向量寄存器，
+ *    跨度不小于向量宽度的比较交换是寄存器之间的 min/max，跨度更小的先在寄存器内置换
+ *    （shuffle/permute）再 min/max，最后按掩码混合（blend）。
+ *    编译时定义了 `__AVX2__` 用 256 位内核，定义了 `__SSE4_2__` 用 128 位内核，
+ *    否则 `sort_small()` 退回标量排序网络；很短的数组也用标量排序网络。
+ *
+ * 两种内核都不稳定：只对等值不可区分的算术类型使用 `sort_small()`。
+ * 浮点数中的 NaN 不参与排序：SIMD 内核把它们移到末尾，标量网络的比较交换遇到 NaN 时不交换，都不会丢失元素。
+ */
+#pragma once
+
+#include <array>        /// 用于 std::array
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 int32_t, int64_t, uint8_t
+#include <cstring>      /// 用于 std::memcpy
+#include <limits>       /// 用于 std::numeric_limits
+#include <type_traits>  /// 用于 std::is_same, std::is_floating_point
+#include <utility>      /// 用于 std::index_sequence, std::swap
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>  /// 用于 SIMD 指令
+#endif
+
+/// 要求编译器完全展开紧随其后的循环（SIMD 内核的循环次数都是编译期常量）
+#if defined(__clang__)
+#define SORTING_NETWORK_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define SORTING_NETWORK_UNROLL _Pragma("GCC unroll 64")
+#else
+#define SORTING_NETWORK_UNROLL
+#endif
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace sorting_network
+ * @brief 排序网络与 SIMD Bitonic 排序内核
+ */
+namespace sorting_network {
+constexpr size_t kMaxNetworkSize = 64;   ///< 支持的最大长度
+constexpr size_t kMaxUnrolledSize = 16;  ///< 不超过这个长度的网络完全展开
+
+/**
+ * @brief 比较器：比较交换 x[a] 与 x[b]（a < b）
+ */
+struct comparator {
+    uint8_t a;
+    uint8_t b;
+};
+
+/**
+ * @brief 遍历长度为 n 的 Batcher 奇偶归并网络的所有比较器
+ * @param n 网络长度
+ * @param emit 对每个比较器调用 emit(a, b)
+ */
+template <typename Emit>
+constexpr void batcher_network(size_t n, Emit &&emit) {
+    for (size_t p = 1; p < n; p *= 2) {
+        for (size_t k = p; k >= 1; k /= 2) {
+            for (size_t j = k % p; j + k < n; j += 2 * k) {
+                for (size_t i = 0; i < k && i + j + k < n; i++) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        emit(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 长度为 n 的网络中比较器的个数
+ */
+constexpr size_t comparator_count(size_t n) {
+    size_t count = 0;
+    batcher_network(n, [&count](size_t, size_t) { count++; });
+    return count;
+}
+
+/**
+ * @brief 长度为 N 的排序网络（编译期常量）
+ */
+template <size_t N>
+struct network {
+    static constexpr size_t size = comparator_count(N);
+
+    static constexpr std::array<comparator, size> build() {
+        std::array<comparator, size> out{};
+        size_t pos = 0;
+        batcher_network(N, [&out, &pos](size_t a, size_t b) {
+            out[pos++] = comparator{uint8_t(a), uint8_t(b)};
+        });
+        return out;
+    }
+
+    static constexpr std::array<comparator, size> comparators = build();
+};
+
+/**
+ * @brief 无分支的比较交换，结束后 a <= b
+ */
+template <typename T>
+inline void compare_exchange(T &a, T &b) {
+    bool s = b < a;
+    T lo = s ? b : a;
+    T hi = s ? a : b;
+    a = lo;
+    b = hi;
+}
+
+template <size_t N, typename T, size_t... I>
+inline void apply_network([[maybe_unused]] T *x, std::index_sequence<I...>) {
+    (compare_exchange(x[network<N>::comparators[I].a], x[network<N>::comparators[I].b]),
+     ...);
+}
+
+/**
+ * @brief 用长度为 N 的排序网络对 x[0, N) 排序，N 较小时比较器序列完全展开
+ */
+template <size_t N, typename T>
+void network_sort(T *x) {
+    if constexpr (N <= kMaxUnrolledSize) {
+        apply_network<N>(x, std::make_index_sequence<network<N>::size>());
+    } else {
+        for (const comparator &c : network<N>::comparators) {
+            compare_exchange(x[c.a], x[c.b]);
+        }
+    }
+}
+
+template <typename T, size_t... N>
+constexpr std::array<void (*)(T *), sizeof...(N)> make_network_table(
+    std::index_sequence<N...>) {
+    return {{&network_sort<N, T>...}};
+}
+
+/**
+ * @brief 按运行时长度选择排序网络
+ * @param x 要排序的数组
+ * @param n 元素个数，不超过 kMaxNetworkSize
+ */
+template <typename T>
+void network_sort_n(T *x, size_t n) {
+    static constexpr auto table =
+        make_network_table<T>(std::make_index_sequence<kMaxNetworkSize + 1>());
+    table[n](x);
+}
+
+/**
+ * @brief SIMD 类型特征，未特化的类型不支持向量化
+ */
+template <typename T>
+struct simd_traits {
+    static constexpr bool supported = false;
+};
+
+#if defined(__AVX2__)
+template <>
+struct simd_traits<int32_t> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 8;
+    static constexpr size_t min_size = 16;  ///< n 超过它才用 SIMD 内核
+    using reg = __m256i;
+    using mask_lane = int32_t;
+    static reg load(const int32_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+    static void store(int32_t *p, reg v) { _mm256_storeu_si256((__m256i *)p, v); }
+    static reg load_mask(const mask_lane *p) { return load(p); }
+    static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm256_blendv_epi8(lo, hi, m); }
+    static reg partner(reg v, size_t j) {
+        if (j == 1) return _mm256_shuffle_epi32(v, 0xB1);
+        if (j == 2) return _mm256_shuffle_epi32(v, 0x4E);
+        return _mm256_permute2x128_si256(v, v, 0x01);
+    }
+};
+
+template <>
+struct simd_traits<float> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 8;
+    static constexpr size_t min_size = 16;  ///< n 超过它才用 SIMD 内核
+    using reg = __m256;
+    using mask_lane = int32_t;
+    static reg load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, reg v) { _mm256_storeu_ps(p, v); }
+    static reg load_mask(const mask_lane *p) {
+        return _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i *)p));
+    }
+    static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm256_blendv_ps(lo, hi, m); }
+    static reg partner(reg v, size_t j) {
+        if (j == 1) return _mm256_permute_ps(v, 0xB1);
+        if (j == 2) return _mm256_permute_ps(v, 0x4E);
+        return _mm256_permute2f128_ps(v, v, 0x01);
+    }
+};
+
+template <>
+struct simd_traits<int64_t> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t min_size = 32;  ///< 没有 64 位 min/max 指令，只在较大时使用
+    using reg = __m256i;
+    using mask_lane = int64_t;
+    static reg load(const int64_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+    static void store(int64_t *p, reg v) { _mm256_storeu_si256((__m256i *)p, v); }
+    static reg load_mask(const mask_lane *p) { return _mm256_loadu_si256((const __m256i *)p); }
+    static reg min(reg a, reg b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static reg max(reg a, reg b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm256_blendv_epi8(lo, hi, m); }
+    static reg partner(reg v, size_t j) {
+        if (j == 1) return _mm256_shuffle_epi32(v, 0x4E);
+        return _mm256_permute2x128_si256(v, v, 0x01);
+    }
+};
+#elif defined(__SSE4_2__)
+template <>
+struct simd_traits<int32_t> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t min_size = 32;  ///< n 超过它才用 SIMD 内核
+    using reg = __m128i;
+    using mask_lane = int32_t;
+    static reg load(const int32_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+    static void store(int32_t *p, reg v) { _mm_storeu_si128((__m128i *)p, v); }
+    static reg load_mask(const mask_lane *p) { return load(p); }
+    static reg min(reg a, reg b) { return _mm_min_epi32(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_epi32(a, b); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm_blendv_epi8(lo, hi, m); }
+    static reg partner(reg v, size_t j) {
+        return j == 1 ? _mm_shuffle_epi32(v, 0xB1) : _mm_shuffle_epi32(v, 0x4E);
+    }
+};
+
+template <>
+struct simd_traits<float> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 4;
+    static constexpr size_t min_size = 32;  ///< n 超过它才用 SIMD 内核
+    using reg = __m128;
+    using mask_lane = int32_t;
+    static reg load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, reg v) { _mm_storeu_ps(p, v); }
+    static reg load_mask(const mask_lane *p) {
+        return _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)p));
+    }
+    static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm_blendv_ps(lo, hi, m); }
+    static reg partner(reg v, size_t j) {
+        return j == 1 ? _mm_shuffle_ps(v, v, 0xB1) : _mm_shuffle_ps(v, v, 0x4E);
+    }
+};
+
+template <>
+struct simd_traits<int64_t> {
+    static constexpr bool supported = true;
+    static constexpr size_t lanes = 2;
+    static constexpr size_t min_size = 64;  ///< SSE 下标量排序网络总是更快，等于不使用
+    using reg = __m128i;
+    using mask_lane = int64_t;
+    static reg load(const int64_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+    static void store(int64_t *p, reg v) { _mm_storeu_si128((__m128i *)p, v); }
+    static reg load_mask(const mask_lane *p) { return _mm_loadu_si128((const __m128i *)p); }
+    static reg min(reg a, reg b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+    static reg max(reg a, reg b) { return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b)); }
+    static reg blend(reg lo, reg hi, reg m) { return _mm_blendv_epi8(lo, hi, m); }
+    static reg partner(reg v, size_t) { return _mm_shuffle_epi32(v, 0x4E); }
+};
+#endif
+
+/**
+ * @brief 当前编译目标下 T 是否有 SIMD Bitonic 内核
+ */
+template <typename T>
+constexpr bool has_simd_kernel() {
+    return simd_traits<T>::supported;
+}
+
+/**
+ * @brief 寄存器内比较交换的混合掩码表
+ * @details table[log2(k)][log2(j)][desc][lane] 为真（全 1）表示该通道取 max。掩码在编译期算好，
+ * 运行时直接从只读数据加载，避免先逐个标量写入栈再整体读取造成的存储转发停顿。
+ */
+template <typename T>
+struct bitonic_masks {
+    static constexpr size_t L = simd_traits<T>::lanes;
+    using mask_lane = typename simd_traits<T>::mask_lane;
+    using table_t = std::array<std::array<std::array<std::array<mask_lane, L>, 2>, 3>, 7>;
+
+    static constexpr table_t build() {
+        table_t t{};
+        for (size_t lk = 0; lk < 7; lk++) {
+            for (size_t lj = 0; lj < 3; lj++) {
+                for (size_t lane = 0; lane < L; lane++) {
+                    size_t k = size_t(1) << lk, j = size_t(1) << lj;
+                    bool take_max = ((lane & j) != 0) != ((lane & k) != 0);
+                    t[lk][lj][0][lane] = take_max ? mask_lane(-1) : 0;
+                    t[lk][lj][1][lane] = take_max ? 0 : mask_lane(-1);
+                }
+            }
+        }
+        return t;
+    }
+    static constexpr table_t table = build();
+};
+
+constexpr size_t log2_exact(size_t v) { return v <= 1 ? 0 : 1 + log2_exact(v >> 1); }
+
+/**
+ * @brief SIMD Bitonic 排序：对 x[0, n) 排序，n <= P <= kMaxNetworkSize
+ * @details 整块载入寄存器后按 Bitonic 网络逐级比较交换，不足 P 的部分用最大值补齐
+ * （只有最后一个不满的寄存器经过栈上缓冲区）。寄存器内比较交换时，每个通道取 min 还是 max 由
+ * ((lane & j) != 0) 与排序方向 ((index & k) != 0) 的异或决定，掩码见 bitonic_masks。
+ * 补齐后的长度 P 是模板参数，循环全部在编译期展开。
+ */
+template <size_t P, typename T>
+void bitonic_sort_simd_fixed(T *x, size_t n) {
+    using V = simd_traits<T>;
+    static_assert(V::supported, "当前编译目标下该类型没有 SIMD 内核");
+    constexpr size_t L = V::lanes;
+    constexpr size_t regs = P / L;
+    using reg = typename V::reg;
+    const auto &masks = bitonic_masks<T>::table;
+
+    const size_t full = n / L;
+    const T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                       : std::numeric_limits<T>::max();
+    alignas(64) T tail[L];
+    for (size_t i = 0; i < L; i++) tail[i] = pad;
+    std::memcpy(tail, x + full * L, (n - full * L) * sizeof(T));
+    const reg partial = V::load(tail);  // 跨过 n 的那个寄存器
+    for (size_t i = 0; i < L; i++) tail[i] = pad;
+    const reg pad_reg = V::load(tail);  // 完全落在 n 之外的寄存器
+
+    reg r[regs];
+    SORTING_NETWORK_UNROLL
+    for (size_t a = 0; a < regs; a++) {
+        r[a] = a < full ? V::load(x + a * L) : a == full ? partial : pad_reg;
+    }
+
+    SORTING_NETWORK_UNROLL
+    for (size_t k = 2; k <= P; k <<= 1) {
+        SORTING_NETWORK_UNROLL
+        for (size_t j = k >> 1; j > 0; j >>= 1) {
+            if (j >= L) {
+                // 寄存器之间：r[a] 与 r[a ^ (j / L)] 比较交换，方向在整个寄存器内相同
+                SORTING_NETWORK_UNROLL
+                for (size_t a = 0; a < regs; a++) {
+                    size_t b = a ^ (j / L);
+                    if (b < a) continue;
+                    reg lo = V::min(r[a], r[b]), hi = V::max(r[a], r[b]);
+                    bool desc = ((a * L) & k) != 0;
+                    r[a] = desc ? hi : lo;
+                    r[b] = desc ? lo : hi;
+                }
+            } else {
+                // 寄存器内：与相距 j 的通道交换后取 min/max，再按掩码混合
+                const auto &m = masks[log2_exact(k < L ? k : 64)][log2_exact(j)];
+                reg m_asc = V::load_mask(m[0].data()), m_desc = V::load_mask(m[1].data());
+                SORTING_NETWORK_UNROLL
+                for (size_t a = 0; a < regs; a++) {
+                    reg other = V::partner(r[a], j);
+                    reg lo = V::min(r[a], other), hi = V::max(r[a], other);
+                    bool d = k >= L && ((a * L) & k) != 0;
+                    r[a] = V::blend(lo, hi, d ? m_desc : m_asc);
+                }
+            }
+        }
+    }
+
+    SORTING_NETWORK_UNROLL
+    for (size_t a = 0; a < regs; a++) {
+        if (a < full) {
+            V::store(x + a * L, r[a]);
+        } else if (a == full) {
+            V::store(tail, r[a]);
+            std::memcpy(x + a * L, tail, (n - full * L) * sizeof(T));
+        }
+    }
+}
+
+/**
+ * @brief 按补齐后的长度选择完全展开的内核
+ */
+template <typename T, size_t P = simd_traits<T>::lanes>
+void bitonic_sort_simd_dispatch(T *x, size_t n) {
+    if constexpr (P < kMaxNetworkSize) {
+        if (n > P) {
+            bitonic_sort_simd_dispatch<T, 2 * P>(x, n);
+            return;
+        }
+    }
+    bitonic_sort_simd_fixed<P>(x, n);
+}
+
+/**
+ * @brief 把 x[0, n) 中的 NaN 移到末尾（顺序不保证）
+ * @returns 不是 NaN 的元素个数
+ */
+template <typename T>
+size_t partition_nan(T *x, size_t n) {
+    size_t end = n;
+    for (size_t i = 0; i < end;) {
+        if (x[i] != x[i]) {
+            std::swap(x[i], x[--end]);
+        } else {
+            i++;
+        }
+    }
+    return end;
+}
+
+/**
+ * @brief SIMD Bitonic 排序
+ * @details min/max 指令遇到 NaN 时只返回其中一个操作数，另一个会丢失，
+ * 结果不再是输入的排列。因此浮点数先把 NaN 移到末尾，只对其余元素排序，
+ * 与标量排序网络一样，NaN 不参与排序但不会丢失。
+ */
+template <typename T>
+void bitonic_sort_simd(T *x, size_t n) {
+    if constexpr (std::is_floating_point<T>::value) {
+        n = partition_nan(x, n);
+    }
+    bitonic_sort_simd_dispatch(x, n);
+}
+
+/**
+ * @brief 小数组排序的统一入口：有 SIMD 内核且 n 足够大时用 SIMD Bitonic，否则用标量排序网络
+ * @details 分界点 `simd_traits<T>::min_size` 按 `排序网络.cpp` 的基准测试选取：
+ * 很短的数组补齐和混合的开销比标量网络的条件传送还大。
+ * @param x 要排序的数组
+ * @param n 元素个数，不超过 kMaxNetworkSize
+ */
+template <typename T>
+void sort_small(T *x, size_t n) {
+    if constexpr (has_simd_kernel<T>()) {
+        if (n > simd_traits<T>::min_size) {
+            bitonic_sort_simd(x, n);
+            return;
+        }
+    }
+    network_sort_n(x, n);
+}
+}  // namespace sorting_network
+}  // namespace sorting
@@ -0,0 +1,67 @@
+/**
+ * @file stooge_sort.h
+ * @brief [Stooge sort实现](https://en.wikipedia.org/wiki/Stooge_sort)的C++实现
+ * @details
+ * Stooge排序是一种递归排序算法。
+ * 它将数组分成3个部分，并按以下步骤执行：
+ *	- 排序数组的前两部分
+ *	- 排序数组的后两部分
+ *  - 再次排序数组的前两部分
+ * 它的时间复杂度是 O(n^(log3/log1.5))，大约是 O(n^2.7)，
+ * 使得它在平均情况下并不是最有效的排序算法。空间复杂度是O(1)。
+ */
+#pragma once
+
+#include <cstddef>  /// 用于 size_t
+#include <utility>  /// 用于 std::swap
+#include <vector>   /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace stooge_sort
+ * @brief Stooge 排序的实现函数
+ */
+namespace stooge_sort {
+/**
+ * @brief stoogeSort() 函数用于排序数组。
+ * @param L - 待排序的值的vector，按升序排序
+ * @param i - 数组的第一个索引（0）
+ * @param j - 数组的最后一个索引（L.size() - 1）
+ * @returns void
+ */
+template <typename T>
+void stoogeSort(std::vector<T>* L, size_t i, size_t j) {
+    if (i >= j) { // 如果i大于等于j，说明已经排序完成，直接返回
+        return;
+    }
+    // 如果L[i] > L[j]，则交换它们
+    if ((*L)[j] < (*L)[i]) {
+        std::swap((*L)[i], (*L)[j]);
+    }
+    // 如果当前范围超过1个元素，则继续分解并排序
+    if (j - i > 1) {
+        size_t third = (j - i + 1) / 3; // 计算每部分的大小，取数组长度的三分之一
+        // 对前两部分进行排序
+        stoogeSort(L, i, j - third);
+        // 对后两部分进行排序
+        stoogeSort(L, i + third, j);
+        // 再次对前两部分进行排序
+        stoogeSort(L, i, j - third);
+    }
+}
+
+/**
+ * @brief 对整个数组排序（空数组直接返回）
+ */
+template <typename T>
+void stooge_sort(std::vector<T>* L) {
+    if (!L->empty()) {
+        stoogeSort(L, 0, L->size() - 1);
+    }
+}
+}  // namespace stooge_sort
+}  // namespace sorting
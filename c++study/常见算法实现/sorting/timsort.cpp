@@ -1,86 +1,17 @@
-// C++ 程序实现 TimSort 排序算法
+// C++ 程序实现 TimSort 排序算法（算法本身见 timsort.h）
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
 
-const int RUN = 32; // 定义每个子数组的大小
-
-// 此函数对数组从左索引到右索引的部分进行插入排序，排序区间大小最多为 RUN
-void insertionSort(int arr[], int left, int right) {
-    for (int i = left + 1; i <= right; i++) {
-        const int temp = arr[i];
-        int j = i - 1;
-        // 在已排序部分插入当前元素
-        while (j >= left && arr[j] > temp) {
-            arr[j + 1] = arr[j];
-            j--;
-        }
-        arr[j + 1] = temp;
-    }
-}
-
-// merge 函数用于合并已排序的子数组
-void merge(int arr[], int l, int m, int r) {
-    // 将原始数组分为两个子数组，左子数组和右子数组
-    const int len1 = m - l + 1, len2 = r - m;
-    int *left = new int[len1], *right = new int[len2];
-    for (int i = 0; i < len1; i++) left[i] = arr[l + i];
-    for (int i = 0; i < len2; i++) right[i] = arr[m + 1 + i];
-
-    int i = 0;
-    int j = 0;
-    int k = l;
-
-    // 合并两个子数组到原数组
-    while (i < len1 && j < len2) {
-        if (left[i] <= right[j]) {
-            arr[k] = left[i];
-            i++;
-        } else {
-            arr[k] = right[j];
-            j++;
-        }
-        k++;
-    }
-
-    // 如果左边子数组还有剩余元素，继续复制
-    while (i < len1) {
-        arr[k] = left[i];
-        k++;
-        i++;
-    }
-
-    // 如果右边子数组还有剩余元素，继续复制
-    while (j < len2) {
-        arr[k] = right[j];
-        k++;
-        j++;
-    }
-    delete[] left;
-    delete[] right;
-}
+#include "./timsort.h"
 
-// 迭代式 TimSort 函数，对数组 [0...n-1] 进行排序（类似于归并排序）
-void timSort(int arr[], int n) {
-    // 对大小为 RUN 的子数组进行插入排序
-    for (int i = 0; i < n; i += RUN)
-        insertionSort(arr, i, std::min((i + 31), (n - 1)));
-
-    // 从大小为 RUN（或32）的子数组开始合并。每次合并后，合并的子数组大小翻倍：32 -> 64 -> 128 -> 256 ...
-    for (int size = RUN; size < n; size = 2 * size) {
-        // 选择左子数组的起始点。我们将合并 arr[left..left+size-1] 和 arr[left+size, left+2*size-1]
-        // 每次合并后，left 的值增加 2*size
-        for (int left = 0; left < n; left += 2 * size) {
-            // 找到左子数组的结束点，mid+1 是右子数组的起始点
-            const int mid = std::min((left + size - 1), (n - 1));
-            const int right = std::min((left + 2 * size - 1), (n - 1));
-
-            // 合并子数组 arr[left.....mid] 和 arr[mid+1....right]
-            merge(arr, left, mid, right);
-        }
-    }
-}
+using sorting::timsort::timSort;
 
 // 打印数组的辅助函数
 void printArray(int arr[], int n) {
@@ -88,6 +19,26 @@ void printArray(int arr[], int n) {
     std::cout << std::endl;
 }
 
+// 生成各种"部分有序"的输入，用于测试和基准测试
+std::vector<std::vector<int>> partiallySortedInputs(size_t n, std::mt19937 &rng) {
+    std::vector<std::vector<int>> inputs(6, std::vector<int>(n));
+    std::iota(inputs[0].begin(), inputs[0].end(), 0);  // 已排序
+    for (size_t i = 0; i < n; i++) {
+        inputs[1][i] = int(n - i);                       // 逆序
+        inputs[2][i] = int(i);                           // 1% 的位置被随机交换
+        inputs[3][i] = int((i % 1000) + (i / 1000) * 7);  // 多个升序段交错
+        inputs[4][i] = int(i);                           // 尾部追加随机数据
+        inputs[5][i] = int(rng() % 1000000);             // 完全随机
+    }
+    for (size_t k = 0; k < n / 100; k++) {
+        std::swap(inputs[2][rng() % n], inputs[2][rng() % n]);
+    }
+    for (size_t i = n - n / 20; i < n; i++) {
+        inputs[4][i] = int(rng() % n);
+    }
+    return inputs;
+}
+
 /**
  * @brief 自我测试实现
  * @returns void
@@ -103,6 +54,61 @@ void tests() {
 
     timSort(arr, N);  // 调用 TimSort 排序
     assert(std::is_sorted(arr, arr + N));  // 确保排序后的数组是有序的
+
+    // 测试用例：各种规模的部分有序输入，结果与 std::stable_sort 一致
+    std::mt19937 rng(12345);
+    for (size_t n : {0, 1, 2, 63, 64, 65, 1000, 4096, 100000}) {
+        for (auto &in : partiallySortedInputs(n, rng)) {
+            std::vector<int> expected = in;
+            std::stable_sort(expected.begin(), expected.end());
+            timSort(&in);
+            assert(in == expected);
+        }
+    }
+
+    // 测试用例：稳定性（只按 first 比较，second 记录原始顺序）
+    std::vector<std::pair<int, int>> pairs(50000);
+    for (size_t i = 0; i < pairs.size(); i++) {
+        int key = (i % 3 == 0) ? int(i / 100) : int(rng() % 50);  // 有序段与随机段混合
+        pairs[i] = {key, int(i)};
+    }
+    auto by_first = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first < b.first;
+    };
+    std::vector<std::pair<int, int>> expected = pairs;
+    std::stable_sort(expected.begin(), expected.end(), by_first);
+    timSort(&pairs, by_first);
+    assert(pairs == expected);
+
+    // 测试用例：自定义比较函数（降序）
+    std::vector<double> desc = {1.5, -2.0, 3.25, 0.0, 3.25, 7.0};
+    timSort(&desc, std::greater<double>());
+    assert(std::is_sorted(desc.begin(), desc.end(), std::greater<double>()));
+
+    std::cout << "所有测试通过！\n";
+}
+
+// 在部分有序输入上与 std::stable_sort 对比
+void benchmark() {
+    const size_t n = 2000000;
+    std::mt19937 rng(7);
+    const char *names[] = {"已排序", "逆序", "1%随机交换", "交错升序段", "尾部5%随机", "完全随机"};
+    auto inputs = partiallySortedInputs(n, rng);
+
+    std::cout << "\n基准测试（n = " << n << "，单位 ns/元素）\n";
+    for (size_t k = 0; k < inputs.size(); k++) {
+        std::vector<int> a = inputs[k], b = inputs[k];
+        auto t0 = std::chrono::steady_clock::now();
+        timSort(&a);
+        auto t1 = std::chrono::steady_clock::now();
+        std::stable_sort(b.begin(), b.end());
+        auto t2 = std::chrono::steady_clock::now();
+        assert(a == b);
+        std::cout << names[k] << "\ttimSort: "
+                  << std::chrono::duration<double, std::nano>(t1 - t0).count() / n
+                  << "\tstd::stable_sort: "
+                  << std::chrono::duration<double, std::nano>(t2 - t1).count() / n << "\n";
+    }
 }
 
 // 驱动程序测试上述功能
@@ -118,5 +124,7 @@ int main() {
 
     printf("After Sorting Array is\n");
     printArray(arr, n);  // 打印排序后的数组
+
+    benchmark();  // 与 std::stable_sort 对比
     return 0;
 }
@@ -0,0 +1,492 @@
+/**
+ * @file timsort.h
+ * @brief 通用、稳定的 [TimSort](https://en.wikipedia.org/wiki/Timsort) 实现
+ * @details
+ * TimSort 针对现实中"部分有序"的数据设计（例如按时间追加、局部乱序的时间序列）：
+ *
+ * 1. **自然 run**：从左到右找出已经有序的片段（严格递减的片段原地翻转），
+ *    短于 minrun 的片段用二分插入排序补齐到 minrun；
+ * 2. **minrun**：取 n 的最高 6 位，若其余位不全为 0 再加 1，使 n / minrun 接近且不超过 2 的幂，
+ *    合并树尽量平衡；
+ * 3. **run 栈不变式**：对栈顶的 X、Y、Z 保持 \f$|Z| > |Y| + |X|\f$ 和 \f$|Y| > |X|\f$，
+ *    不满足时合并，保证栈深度为 \f$O(\log n)\f$、总合并代价为 \f$O(n \log n)\f$；
+ * 4. **galloping**：某一侧连续胜出 min_gallop 次后，改用指数搜索一次性找出可以成块移动的元素，
+ *    min_gallop 根据搜索是否划算自适应调整；
+ * 5. **单一缓冲区**：合并时只把较短的 run 复制到一个复用的缓冲区，从较短的一侧开始合并。
+ *
+ * 时间复杂度：最好 \f$O(n)\f$（已经有序），最坏 \f$O(n \log n)\f$；额外空间 \f$O(n)\f$。
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::reverse, std::move_backward
+#include <cstddef>     /// 用于 size_t, ptrdiff_t
+#include <functional>  /// 用于 std::less
+#include <utility>     /// 用于 std::move
+#include <vector>      /// 用于 std::vector
+
+/**
+ * @namespace sorting
+ * @brief 排序算法
+ */
+namespace sorting {
+/**
+ * @namespace timsort
+ * @brief TimSort 的实现
+ */
+namespace timsort {
+constexpr ptrdiff_t kMinMerge = 64;   ///< 小于此规模的数组直接用二分插入排序
+constexpr ptrdiff_t kMinGallop = 7;   ///< 进入 galloping 模式的初始阈值
+
+/**
+ * @brief 计算 minrun
+ * @param n 数组大小
+ * @returns 介于 kMinMerge/2 与 kMinMerge 之间的 run 最小长度
+ */
+inline ptrdiff_t minRunLength(ptrdiff_t n) {
+    ptrdiff_t r = 0;  // 只要移出的位中有 1，r 就为 1
+    while (n >= kMinMerge) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/**
+ * @brief TimSort 的排序状态：待排序数组、run 栈和复用的合并缓冲区
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数，语义与 std::less 相同
+ */
+template <typename T, typename Compare>
+class TimSort {
+ public:
+    TimSort(T *arr, Compare comp) : arr_(arr), comp_(comp) {}
+
+    /**
+     * @brief 对 arr[0, n) 排序
+     */
+    void sort(ptrdiff_t n) {
+        if (n < 2) {
+            return;
+        }
+        if (n < kMinMerge) {
+            ptrdiff_t run = countRunAndMakeAscending(0, n);
+            binaryInsertionSort(0, n, run);
+            return;
+        }
+
+        const ptrdiff_t min_run = minRunLength(n);
+        ptrdiff_t lo = 0;
+        while (lo < n) {
+            ptrdiff_t remaining = n - lo;
+            ptrdiff_t run = countRunAndMakeAscending(lo, n);
+            if (run < min_run) {
+                ptrdiff_t forced = std::min(remaining, min_run);
+                binaryInsertionSort(lo, lo + forced, lo + run);
+                run = forced;
+            }
+            runs_.push_back({lo, run});
+            mergeCollapse();
+            lo += run;
+        }
+        mergeForceCollapse();
+    }
+
+ private:
+    struct run {
+        ptrdiff_t base;
+        ptrdiff_t len;
+    };
+
+    T *arr_;
+    Compare comp_;
+    std::vector<run> runs_;
+    std::vector<T> tmp_;  ///< 合并时复用的缓冲区，只增长不收缩
+    ptrdiff_t min_gallop_ = kMinGallop;
+
+    /**
+     * @brief 找出从 lo 开始的 run，如果是严格递减的则翻转
+     * @returns run 的长度
+     */
+    ptrdiff_t countRunAndMakeAscending(ptrdiff_t lo, ptrdiff_t hi) {
+        ptrdiff_t run_hi = lo + 1;
+        if (run_hi == hi) {
+            return 1;
+        }
+        if (comp_(arr_[run_hi++], arr_[lo])) {  // 严格递减（保证翻转后仍然稳定）
+            while (run_hi < hi && comp_(arr_[run_hi], arr_[run_hi - 1])) run_hi++;
+            std::reverse(arr_ + lo, arr_ + run_hi);
+        } else {
+            while (run_hi < hi && !comp_(arr_[run_hi], arr_[run_hi - 1])) run_hi++;
+        }
+        return run_hi - lo;
+    }
+
+    /**
+     * @brief 二分插入排序，arr[lo, start) 已经有序
+     */
+    void binaryInsertionSort(ptrdiff_t lo, ptrdiff_t hi, ptrdiff_t start) {
+        for (; start < hi; start++) {
+            T pivot = std::move(arr_[start]);
+            ptrdiff_t left = lo, right = start;
+            while (left < right) {  // 找到最右侧的插入位置，保持稳定
+                ptrdiff_t mid = left + (right - left) / 2;
+                if (comp_(pivot, arr_[mid])) {
+                    right = mid;
+                } else {
+                    left = mid + 1;
+                }
+            }
+            std::move_backward(arr_ + left, arr_ + start, arr_ + start + 1);
+            arr_[left] = std::move(pivot);
+        }
+    }
+
+    /**
+     * @brief 在有序的 base[0, len) 中查找 key 的最左插入位置，从 hint 开始指数搜索
+     * @returns k，满足 base[k-1] < key <= base[k]
+     */
+    ptrdiff_t gallopLeft(const T &key, const T *base, ptrdiff_t len, ptrdiff_t hint) {
+        ptrdiff_t last_ofs = 0, ofs = 1;
+        if (comp_(base[hint], key)) {  // 向右搜索
+            ptrdiff_t max_ofs = len - hint;
+            while (ofs < max_ofs && comp_(base[hint + ofs], key)) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            ofs = std::min(ofs, max_ofs);
+            last_ofs += hint;
+            ofs += hint;
+        } else {  // 向左搜索
+            ptrdiff_t max_ofs = hint + 1;
+            while (ofs < max_ofs && !comp_(base[hint - ofs], key)) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            ofs = std::min(ofs, max_ofs);
+            ptrdiff_t tmp = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - tmp;
+        }
+        // 此时 base[last_ofs] < key <= base[ofs]，在 (last_ofs, ofs] 中二分
+        last_ofs++;
+        while (last_ofs < ofs) {
+            ptrdiff_t m = last_ofs + (ofs - last_ofs) / 2;
+            if (comp_(base[m], key)) {
+                last_ofs = m + 1;
+            } else {
+                ofs = m;
+            }
+        }
+        return ofs;
+    }
+
+    /**
+     * @brief 在有序的 base[0, len) 中查找 key 的最右插入位置，从 hint 开始指数搜索
+     * @returns k，满足 base[k-1] <= key < base[k]
+     */
+    ptrdiff_t gallopRight(const T &key, const T *base, ptrdiff_t len, ptrdiff_t hint) {
+        ptrdiff_t last_ofs = 0, ofs = 1;
+        if (comp_(key, base[hint])) {  // 向左搜索
+            ptrdiff_t max_ofs = hint + 1;
+            while (ofs < max_ofs && comp_(key, base[hint - ofs])) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            ofs = std::min(ofs, max_ofs);
+            ptrdiff_t tmp = last_ofs;
+            last_ofs = hint - ofs;
+            ofs = hint - tmp;
+        } else {  // 向右搜索
+            ptrdiff_t max_ofs = len - hint;
+            while (ofs < max_ofs && !comp_(key, base[hint + ofs])) {
+                last_ofs = ofs;
+                ofs = (ofs << 1) + 1;
+            }
+            ofs = std::min(ofs, max_ofs);
+            last_ofs += hint;
+            ofs += hint;
+        }
+        // 此时 base[last_ofs] <= key < base[ofs]，在 (last_ofs, ofs] 中二分
+        last_ofs++;
+        while (last_ofs < ofs) {
+            ptrdiff_t m = last_ofs + (ofs - last_ofs) / 2;
+            if (comp_(key, base[m])) {
+                ofs = m;
+            } else {
+                last_ofs = m + 1;
+            }
+        }
+        return ofs;
+    }
+
+    /**
+     * @brief 检查 run 栈不变式，不满足时合并，直到不变式重新成立
+     */
+    void mergeCollapse() {
+        while (runs_.size() > 1) {
+            ptrdiff_t n = ptrdiff_t(runs_.size()) - 2;
+            if ((n > 0 && runs_[n - 1].len <= runs_[n].len + runs_[n + 1].len) ||
+                (n > 1 && runs_[n - 2].len <= runs_[n - 1].len + runs_[n].len)) {
+                if (runs_[n - 1].len < runs_[n + 1].len) {
+                    n--;
+                }
+            } else if (runs_[n].len > runs_[n + 1].len) {
+                break;  // 不变式成立
+            }
+            mergeAt(n);
+        }
+    }
+
+    /**
+     * @brief 把栈上剩余的 run 全部合并
+     */
+    void mergeForceCollapse() {
+        while (runs_.size() > 1) {
+            ptrdiff_t n = ptrdiff_t(runs_.size()) - 2;
+            if (n > 0 && runs_[n - 1].len < runs_[n + 1].len) {
+                n--;
+            }
+            mergeAt(n);
+        }
+    }
+
+    /**
+     * @brief 合并栈上第 i 和 i+1 个 run
+     */
+    void mergeAt(ptrdiff_t i) {
+        ptrdiff_t base1 = runs_[i].base, len1 = runs_[i].len;
+        ptrdiff_t base2 = runs_[i + 1].base, len2 = runs_[i + 1].len;
+
+        runs_[i].len = len1 + len2;
+        runs_.erase(runs_.begin() + i + 1);
+
+        // run1 中不大于 run2 首元素的前缀已经就位
+        ptrdiff_t k = gallopRight(arr_[base2], arr_ + base1, len1, 0);
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0) {
+            return;
+        }
+        // run2 中不小于 run1 末元素的后缀已经就位
+        len2 = gallopLeft(arr_[base1 + len1 - 1], arr_ + base2, len2, len2 - 1);
+        if (len2 == 0) {
+            return;
+        }
+
+        if (len1 <= len2) {
+            mergeLo(base1, len1, base2, len2);
+        } else {
+            mergeHi(base1, len1, base2, len2);
+        }
+    }
+
+    T *ensureCapacity(ptrdiff_t n) {
+        if (ptrdiff_t(tmp_.size()) < n) {
+            tmp_.resize(n);
+        }
+        return tmp_.data();
+    }
+
+    /**
+     * @brief 从左向右合并，run1 较短，被复制到缓冲区
+     * @details 调用前保证 run2 首元素小于 run1 首元素，run1 末元素大于 run2 末元素。
+     */
+    void mergeLo(ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2) {
+        T *tmp = ensureCapacity(len1);
+        std::move(arr_ + base1, arr_ + base1 + len1, tmp);
+
+        ptrdiff_t i = 0;                 // tmp 中的游标
+        ptrdiff_t j = base2;             // run2 中的游标
+        ptrdiff_t k = base1;             // 输出位置
+        const ptrdiff_t end2 = base2 + len2;
+        ptrdiff_t min_gallop = min_gallop_;
+
+        arr_[k++] = std::move(arr_[j++]);
+        bool done = (j == end2);
+        while (!done) {
+            ptrdiff_t count1 = 0, count2 = 0;  // 两侧各自连续胜出的次数
+
+            // 逐个比较，直到某一侧连续胜出 min_gallop 次
+            while (true) {
+                if (comp_(arr_[j], tmp[i])) {
+                    arr_[k++] = std::move(arr_[j++]);
+                    count2++;
+                    count1 = 0;
+                    if (j == end2) {
+                        done = true;
+                        break;
+                    }
+                } else {
+                    arr_[k++] = std::move(tmp[i++]);
+                    count1++;
+                    count2 = 0;
+                    if (i == len1) {
+                        done = true;
+                        break;
+                    }
+                }
+                if (count1 >= min_gallop || count2 >= min_gallop) {
+                    break;
+                }
+            }
+            if (done) {
+                break;
+            }
+
+            // galloping 模式：用指数搜索成块移动，直到两侧都不再连续胜出
+            do {
+                count1 = gallopRight(arr_[j], tmp + i, len1 - i, 0);
+                std::move(tmp + i, tmp + i + count1, arr_ + k);
+                k += count1;
+                i += count1;
+                if (i == len1) {
+                    done = true;
+                    break;
+                }
+                arr_[k++] = std::move(arr_[j++]);
+                if (j == end2) {
+                    done = true;
+                    break;
+                }
+
+                count2 = gallopLeft(tmp[i], arr_ + j, end2 - j, 0);
+                std::move(arr_ + j, arr_ + j + count2, arr_ + k);
+                k += count2;
+                j += count2;
+                if (j == end2) {
+                    done = true;
+                    break;
+                }
+                arr_[k++] = std::move(tmp[i++]);
+                if (i == len1) {
+                    done = true;
+                    break;
+                }
+                if (min_gallop > 1) {
+                    min_gallop--;
+                }
+            } while (count1 >= kMinGallop || count2 >= kMinGallop);
+            if (done) {
+                break;
+            }
+            min_gallop += 2;  // 退出 galloping 模式的惩罚
+        }
+        min_gallop_ = std::max<ptrdiff_t>(min_gallop, 1);
+
+        // run2 剩下的元素已经在原位，只需搬回缓冲区中剩下的元素
+        std::move(tmp + i, tmp + len1, arr_ + k);
+    }
+
+    /**
+     * @brief 从右向左合并，run2 较短，被复制到缓冲区
+     * @details 调用前保证 run2 首元素小于 run1 首元素，run1 末元素大于 run2 末元素。
+     */
+    void mergeHi(ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2) {
+        T *tmp = ensureCapacity(len2);
+        std::move(arr_ + base2, arr_ + base2 + len2, tmp);
+
+        ptrdiff_t i = base1 + len1 - 1;  // run1 中的游标
+        ptrdiff_t j = len2 - 1;          // tmp 中的游标
+        ptrdiff_t k = base2 + len2 - 1;  // 输出位置
+        ptrdiff_t min_gallop = min_gallop_;
+
+        arr_[k--] = std::move(arr_[i--]);
+        bool done = (i < base1);
+        while (!done) {
+            ptrdiff_t count1 = 0, count2 = 0;
+
+            while (true) {
+                if (comp_(tmp[j], arr_[i])) {
+                    arr_[k--] = std::move(arr_[i--]);
+                    count1++;
+                    count2 = 0;
+                    if (i < base1) {
+                        done = true;
+                        break;
+                    }
+                } else {
+                    arr_[k--] = std::move(tmp[j--]);
+                    count2++;
+                    count1 = 0;
+                    if (j < 0) {
+                        done = true;
+                        break;
+                    }
+                }
+                if (count1 >= min_gallop || count2 >= min_gallop) {
+                    break;
+                }
+            }
+            if (done) {
+                break;
+            }
+
+            do {
+                // run1 中大于 tmp[j] 的后缀
+                count1 = (i + 1 - base1) -
+                         gallopRight(tmp[j], arr_ + base1, i + 1 - base1, i - base1);
+                std::move_backward(arr_ + i + 1 - count1, arr_ + i + 1, arr_ + k + 1);
+                k -= count1;
+                i -= count1;
+                if (i < base1) {
+                    done = true;
+                    break;
+                }
+                arr_[k--] = std::move(tmp[j--]);
+                if (j < 0) {
+                    done = true;
+                    break;
+                }
+
+                // tmp 中不小于 arr_[i] 的后缀
+                count2 = (j + 1) - gallopLeft(arr_[i], tmp, j + 1, j);
+                std::move_backward(tmp + j + 1 - count2, tmp + j + 1, arr_ + k + 1);
+                k -= count2;
+                j -= count2;
+                if (j < 0) {
+                    done = true;
+                    break;
+                }
+                arr_[k--] = std::move(arr_[i--]);
+                if (i < base1) {
+                    done = true;
+                    break;
+                }
+                if (min_gallop > 1) {
+                    min_gallop--;
+                }
+            } while (count1 >= kMinGallop || count2 >= kMinGallop);
+            if (done) {
+                break;
+            }
+            min_gallop += 2;
+        }
+        min_gallop_ = std::max<ptrdiff_t>(min_gallop, 1);
+
+        // run1 剩下的元素已经在原位，只需搬回缓冲区中剩下的元素
+        std::move(tmp, tmp + j + 1, arr_ + k - j);
+    }
+};
+
+/**
+ * @brief TimSort 排序入口
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数，默认为 std::less<T>
+ * @param arr 要排序的数组
+ * @param n 数组大小
+ * @param comp 比较函数
+ */
+template <typename T, typename Compare = std::less<T>>
+void timSort(T *arr, size_t n, Compare comp = Compare()) {
+    TimSort<T, Compare>(arr, comp).sort(ptrdiff_t(n));
+}
+
+/**
+ * @brief TimSort 排序入口（std::vector 版本）
+ */
+template <typename T, typename Compare = std::less<T>>
+void timSort(std::vector<T> *arr, Compare comp = Compare()) {
+    timSort(arr->data(), arr->size(), comp);
+}
+}  // namespace timsort
+}  // namespace sorting
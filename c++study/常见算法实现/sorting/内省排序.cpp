@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief 内省排序的测试与基准测试
+ * @details 算法本身见 `introsort.h`。
+ */
+#include <algorithm>  /// 用于 std::is_sorted, std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 int64_t, uint64_t
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <vector>     /// 用于 std::vector
+
+#include "./introsort.h"
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(42);
+
+    // 第1个测试：空数组与单元素数组
+    std::vector<int> empty;
+    sorting::introsort::introsort(&empty);
+    std::vector<int> one = {7};
+    sorting::introsort::introsort(&one);
+    assert(one[0] == 7);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：各种规模与分布，结果与 std::sort 一致
+    for (size_t n : {2, 10, 24, 25, 100, 129, 1000, 4097, 100000}) {
+        std::vector<std::vector<int64_t>> inputs(6, std::vector<int64_t>(n));
+        for (size_t i = 0; i < n; i++) {
+            inputs[0][i] = int64_t(rng());                   // 随机
+            inputs[1][i] = int64_t(i);                       // 已排序
+            inputs[2][i] = int64_t(n - i);                   // 逆序
+            inputs[3][i] = int64_t(rng() % 4);               // 大量重复
+            inputs[4][i] = int64_t(std::min(i, n - i));      // 管风琴
+            inputs[5][i] = 5;                                // 全部相等
+        }
+        for (auto &in : inputs) {
+            std::vector<int64_t> expected = in;
+            std::sort(expected.begin(), expected.end());
+            sorting::introsort::introsort(&in);
+            assert(in == expected);
+        }
+    }
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：浮点数
+    std::vector<double> arr = {29, 36, 1100, 0, 77, 1, 6.7, 8.97, 1.74, 950.10, -329.65};
+    sorting::introsort::introsort(&arr);
+    assert(std::is_sorted(arr.begin(), arr.end()));
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：堆排序兜底（递归深度为 0，直接交给 heap_sort.h）
+    std::vector<int> heap(100);
+    for (size_t i = 0; i < heap.size(); i++) heap[i] = int((i * 37) % 101) - 50;
+    sorting::introsort::introsort_loop(heap.data(), heap.data() + heap.size(), 0, true);
+    assert(std::is_sorted(heap.begin(), heap.end()));
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 与 std::sort 对比的基准测试
+ * @returns void
+ */
+static void benchmark() {
+    const size_t n = 2000000;
+    std::mt19937_64 rng(7);
+    const char *names[] = {"随机", "已排序", "逆序", "少量不同值"};
+    std::vector<std::vector<uint64_t>> inputs(4, std::vector<uint64_t>(n));
+    for (size_t i = 0; i < n; i++) {
+        inputs[0][i] = rng();
+        inputs[1][i] = i;
+        inputs[2][i] = n - i;
+        inputs[3][i] = rng() % 16;
+    }
+
+    std::cout << "\n基准测试（n = " << n << "，单位 ns/元素）\n";
+    for (size_t k = 0; k < inputs.size(); k++) {
+        std::vector<uint64_t> a = inputs[k], b = inputs[k];
+
+        auto t0 = std::chrono::steady_clock::now();
+        sorting::introsort::introsort(&a);
+        auto t1 = std::chrono::steady_clock::now();
+        std::sort(b.begin(), b.end());
+        auto t2 = std::chrono::steady_clock::now();
+        assert(a == b);
+
+        double intro = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+        double stl = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+        std::cout << names[k] << "\tintrosort: " << intro
+                  << "\tstd::sort: " << stl << "\n";
+    }
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();      // 运行自我测试
+    benchmark();  // 与 std::sort 对比
+    return 0;
+}
@@ -27,9 +27,10 @@
 #include <iostream>
 #include <vector>
 
+#include "./bubble_sort.h"
+
 int main() {
     int n;
-    bool swap_check = true;  // 用来标记是否进行交换操作
     std::cout << "请输入要排序的数字个数: ";
     std::cin >> n;  // 用户输入数字的个数
     std::vector<int> numbers;  // 用来存储输入的数字
@@ -42,16 +43,8 @@ int main() {
         numbers.push_back(num);  // 将每个数字添加到数组中
     }
 
-    // 冒泡排序
-    for (int i = 0; (i < n) && (swap_check); i++) {
-        swap_check = false;  // 每次迭代时初始化交换标志
-        for (int j = 0; j < n - 1 - i; j++) {  // 内循环，每次迭代会“冒泡”出一个最大值
-            if (numbers[j] > numbers[j + 1]) {  // 如果当前数字大于下一个数字，则交换
-                swap_check = true;  // 标记发生了交换
-                std::swap(numbers[j], numbers[j + 1]);  // 交换两个数字
-            }
-        }
-    }
+    // 冒泡排序，实现见 bubble_sort.h
+    sorting::bubble_sort(&numbers);
 
     // 输出排序后的数组
     std::cout << "\n排序后的数组 : ";
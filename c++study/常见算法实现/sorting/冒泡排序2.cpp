@@ -1,7 +1,7 @@
 /**
  * @file
  * @author [Aditya Prakash](https://adityaprakash.tech)
- * @brief 这是 [冒泡排序算法](https://www.geeksforgeeks.org/recursive-bubble-sort/) 的递归实现。
+ * @brief 这是 [冒泡排序算法](https://www.geeksforgeeks.org/recursive-bubble-sort/) 的递归实现的测试，实现见 `bubble_sort.h`。
  *
  * @details
  * 冒泡排序算法的工作原理。
@@ -47,38 +47,7 @@
 #include <array>     /// 用于 std::array 容器
 #include <algorithm> /// 用于 std::is_sorted 函数
 
-/**
- * @namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-
-/**
- * @brief 递归冒泡排序算法的实现。函数接受一个数组，并通过递归进行排序。
- *        该函数还接受第二个参数 `n`，它表示数组的大小。
- * 
- * @tparam T 数组中元素的数据类型
- * @param nums 指向元素数组的指针。
- * @param n 数组的大小
- */
-template <typename T>
-void recursive_bubble_sort(std::vector<T> *nums, uint64_t n) {
-    if (n == 1) {  //!< 基本情况，当数组的大小为1时直接返回
-        return;
-    }
-
-    // 遍历整个数组
-    for (uint64_t i = 0; i < n - 1; i++) {
-        //!< 如果当前数字比下一个数字大，则交换它们的位置
-        if ((*nums)[i] > (*nums)[i + 1]) {
-            std::swap((*nums)[i], (*nums)[i + 1]);
-        }
-    }
-
-    //!< 递归调用，在每次递归后固定一个元素（即排好序的最后一个元素）
-    recursive_bubble_sort(nums, n - 1);
-}
-}  // namespace sorting
+#include "./bubble_sort.h"
 
 /**
  * @brief 测试用例实现
@@ -130,6 +99,13 @@ static void test() {
         std::cout << double_arr[i] << ", ";
     }
     std::cout << std::endl;
+
+    // 3. 空数组（n - 1 不能从 0 回绕）
+    std::cout << "3rd test using an empty array\n";
+    std::vector<int64_t> empty_arr;
+    sorting::recursive_bubble_sort(&empty_arr, 0);
+    assert(empty_arr.empty());
+    std::cout << " 3rd test passed!\n";
 }
 
 /**
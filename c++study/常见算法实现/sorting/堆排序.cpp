@@ -1,6 +1,6 @@
 /**
  * \file
- * \brief [堆排序算法](https://en.wikipedia.org/wiki/Heapsort) 实现
+ * \brief [堆排序算法](https://en.wikipedia.org/wiki/Heapsort) 的测试，实现见 `heap_sort.h`
  *
  * \author [Ayaan Khan](http://github.com/ayaankhan98)
  *
@@ -19,6 +19,10 @@
 #include <cassert>
 #include <iostream>
 
+#include "./heap_sort.h"
+
+using sorting::heap_sort::heapSort;
+
 /**
  *
  * 工具函数，用于排序后打印数组。
@@ -35,56 +39,6 @@ void printArray(T *arr, int sz) {
 
 /**
  *
- * \addtogroup sorting 排序算法
- * @{
- *
- * 堆化过程可以被看作是从底向上构建堆，通过不断向下筛选以满足堆的性质。
- *
- * @param arr 要排序的数组
- * @param n 数组大小
- * @param i 要比较的节点位置（在二叉树中为元素位置）
- *
- */
-template <typename T>
-void heapify(T *arr, int n, int i) {
-    int largest = i;           // 假设当前节点是最大值
-    int l = 2 * i + 1;         // 左子节点索引
-    int r = 2 * i + 2;         // 右子节点索引
-
-    if (l < n && arr[l] > arr[largest])  // 如果左子节点比当前节点大
-        largest = l;
-
-    if (r < n && arr[r] > arr[largest])  // 如果右子节点比当前节点大
-        largest = r;
-
-    if (largest != i) {  // 如果最大元素不是当前元素，交换并递归堆化
-        std::swap(arr[i], arr[largest]);
-        heapify(arr, n, largest);
-    }
-}
-
-/**
- * 使用堆化过程对数组进行排序
- *
- * @param arr 要排序的数组
- * @param n 数组大小
- *
- */
-template <typename T>
-void heapSort(T *arr, int n) {
-    // 1. 构建最大堆（从最后一个非叶子节点开始）
-    for (int i = n - 1; i >= 0; i--) heapify(arr, n, i);
-
-    // 2. 一个一个的提取元素，并重新堆化
-    for (int i = n - 1; i >= 0; i--) {
-        std::swap(arr[0], arr[i]);  // 将最大元素移到数组末尾
-        heapify(arr, i, 0);         // 对剩余元素重新堆化
-    }
-}
-
-/**
- *
- * @}
  * 测试程序
  *
  */
@@ -0,0 +1,198 @@
+/**
+ * @file
+ * @brief 外部归并排序的测试与基准测试
+ * @details 算法本身见 `external_sort.h`。测试时把内存预算设得很小，
+ * 强制生成大量 run 并进行多轮归并。
+ */
+#include <cassert>     /// 用于 assert
+#include <chrono>      /// 用于基准测试计时
+#include <cstdint>     /// 用于 uint64_t
+#include <cstdio>      /// 用于 std::FILE
+#include <filesystem>  /// 用于临时目录
+#include <iostream>    /// 用于输入输出操作
+#include <random>      /// 用于 std::mt19937_64
+#include <stdexcept>   /// 用于 std::runtime_error
+#include <string>      /// 用于 std::string
+#include <vector>      /// 用于 std::vector
+
+#include "./external_sort.h"
+
+namespace ext = sorting::external_sort;
+
+/**
+ * @brief 16 字节的定长记录
+ */
+struct record {
+    uint64_t key;      ///< 排序键
+    uint64_t payload;  ///< 负载，这里保存记录在输入中的序号
+};
+
+/** 生成 n 条随机记录写入 path，键取值范围为 [0, key_range) */
+static void write_input(const std::string &path, size_t n, uint64_t key_range) {
+    std::mt19937_64 rng(n);
+    std::FILE *f = ext::open_file(path, "wb");
+    std::vector<record> block(1 << 16);
+    for (size_t i = 0; i < n;) {
+        size_t m = std::min(block.size(), n - i);
+        for (size_t j = 0; j < m; j++, i++) {
+            block[j] = {rng() % key_range, i};
+        }
+        std::fwrite(block.data(), sizeof(record), m, f);
+    }
+    std::fclose(f);
+}
+
+/** 检查输出有序、稳定，并且是输入的一个排列 */
+static void check_output(const std::string &path, size_t n) {
+    std::FILE *f = ext::open_file(path, "rb");
+    std::vector<record> all(n + 1);
+    size_t got = std::fread(all.data(), sizeof(record), all.size(), f);
+    std::fclose(f);
+    assert(got == n);
+
+    std::vector<bool> seen(n, false);
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0) {
+            assert(all[i - 1].key <= all[i].key);
+            if (all[i - 1].key == all[i].key) {
+                assert(all[i - 1].payload < all[i].payload);  // 稳定
+            }
+        }
+        assert(all[i].payload < n && !seen[all[i].payload]);
+        seen[all[i].payload] = true;
+    }
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    const std::string dir = std::filesystem::temp_directory_path().string();
+    const std::string input = dir + "/extsort_test_input.bin";
+    const std::string output = dir + "/extsort_test_output.bin";
+    auto by_key = [](const record &a, const record &b) { return a.key < b.key; };
+
+    ext::config cfg;
+    cfg.memory_budget = 1 << 20;  // 1 MB：每个 run 32768 条记录
+    cfg.io_buffer_bytes = 64 << 10;
+    cfg.num_threads = 2;
+    cfg.temp_dir = dir;
+
+    // 第1个测试：空文件与小于一个 run 的文件
+    for (size_t n : {0, 1000}) {
+        write_input(input, n, 100);
+        ext::stats st = ext::sort_file<record>(input, output, cfg, by_key);
+        assert(st.records == n);
+        check_output(output, n);
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：多个 run、多轮归并，比较函数排序
+    const size_t n = 1000000;
+    write_input(input, n, 5000);
+    ext::stats st = ext::sort_file<record>(input, output, cfg, by_key);
+    assert(st.records == n && st.initial_runs == 31 && st.merge_passes >= 2);
+    check_output(output, n);
+    std::cout << "第2个测试: 通过！（" << st.initial_runs << " 个 run，"
+              << st.merge_passes << " 轮归并）\n";
+
+    // 第3个测试：按键排序（基数排序生成 run），分别用 fread 和 mmap 读取
+    for (bool use_mmap : {false, true}) {
+        cfg.use_mmap = use_mmap;
+        st = ext::sort_file_by_key<record>(input, output, cfg,
+                                           [](const record &r) { return r.key; });
+        assert(st.records == n);
+        check_output(output, n);
+    }
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：比较函数在排序的不同阶段抛出异常（包括中间某一轮归并的中途），临时文件都被删除
+    const std::string temp_dir = dir + "/extsort_test_temp";
+    std::filesystem::create_directory(temp_dir);
+    cfg.temp_dir = temp_dir;
+    cfg.use_mmap = false;
+    cfg.num_threads = 1;  // 异常在调用线程中抛出
+    size_t comparisons = 0, limit = 0;
+    auto throwing = [&comparisons, &limit](const record &a, const record &b) {
+        if (++comparisons == limit) {
+            throw std::runtime_error("比较函数抛出异常");
+        }
+        return a.key < b.key;
+    };
+    ext::sort_file<record>(input, output, cfg, throwing);
+    const size_t total = comparisons;
+    for (double fraction : {0.1, 0.5, 0.7, 0.8, 0.9, 0.99}) {
+        comparisons = 0;
+        limit = size_t(double(total) * fraction);
+        bool thrown = false;
+        try {
+            ext::sort_file<record>(input, output, cfg, throwing);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(std::filesystem::is_empty(temp_dir));
+    }
+    std::cout << "第4个测试: 通过！\n";
+
+    // 第5个测试：文件大小不是记录大小的整数倍时抛出异常，而不是丢掉末尾不完整的记录
+    for (size_t records : {size_t(0), size_t(1000), n}) {
+        write_input(input, records, 100);
+        std::filesystem::resize_file(input, records * sizeof(record) + 5);
+        for (bool use_mmap : {false, true}) {
+            cfg.use_mmap = use_mmap;
+            bool thrown = false;
+            try {
+                ext::sort_file<record>(input, output, cfg, by_key);
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            assert(thrown);
+            assert(std::filesystem::is_empty(temp_dir));
+        }
+    }
+    cfg.use_mmap = false;
+    std::filesystem::remove(temp_dir);
+    std::cout << "第5个测试: 通过！\n";
+
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
+
+/**
+ * @brief 基准测试：报告端到端吞吐量
+ */
+static void benchmark() {
+    const std::string dir = std::filesystem::temp_directory_path().string();
+    const std::string input = dir + "/extsort_bench_input.bin";
+    const std::string output = dir + "/extsort_bench_output.bin";
+    const size_t n = size_t(1) << 23;  // 128 MB
+    write_input(input, n, ~uint64_t(0));
+
+    ext::config cfg;
+    cfg.memory_budget = 32 << 20;
+    cfg.temp_dir = dir;
+
+    auto t0 = std::chrono::steady_clock::now();
+    ext::stats st = ext::sort_file_by_key<record>(input, output, cfg,
+                                                  [](const record &r) { return r.key; });
+    auto t1 = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "\n基准测试：" << (n * sizeof(record) >> 20) << " MB，内存预算 "
+              << (cfg.memory_budget >> 20) << " MB，" << st.initial_runs << " 个 run，"
+              << seconds << " 秒，" << (n * sizeof(record) >> 20) / seconds << " MB/s\n";
+
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();
+    benchmark();
+    return 0;
+}
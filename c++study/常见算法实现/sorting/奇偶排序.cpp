@@ -1,37 +1,12 @@
-/* C++ 实现 奇偶排序（Odd-Even Sort） */
+/* C++ 实现 奇偶排序（Odd-Even Sort），算法本身见 odd_even_sort.h */
 
 #include <iostream>
 #include <vector>
 
-using namespace std;
-
-// 奇偶排序算法的实现
-void oddEven(vector<int> &arr, int size) {
-    bool sorted = false;
-    
-    // 当数组未排序完成时，继续循环
-    while (!sorted) {
-        sorted = true;
-        
-        // 进行奇数索引位置的元素比较和交换
-        for (int i = 1; i < size - 1; i += 2)  // 奇数位置
-        {
-            if (arr[i] > arr[i + 1]) {  // 如果当前元素大于下一个元素
-                swap(arr[i], arr[i + 1]);  // 交换元素
-                sorted = false;  // 设置为未排序，继续进行下一轮
-            }
-        }
+#include "./odd_even_sort.h"
 
-        // 进行偶数索引位置的元素比较和交换
-        for (int i = 0; i < size - 1; i += 2)  // 偶数位置
-        {
-            if (arr[i] > arr[i + 1]) {  // 如果当前元素大于下一个元素
-                swap(arr[i], arr[i + 1]);  // 交换元素
-                sorted = false;  // 设置为未排序，继续进行下一轮
-            }
-        }
-    }
-}
+using namespace std;
+using sorting::odd_even_sort::oddEven;
 
 // 输出排序后的数组
 void show(vector<int> A, int size) {
@@ -0,0 +1,157 @@
+/**
+ * @file
+ * @brief 并行归并排序与 k 路归并的测试与基准测试
+ * @details 算法本身见 `parallel_merge_sort.h`。
+ */
+#include <algorithm>  /// 用于 std::stable_sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cmath>      /// 用于 std::signbit
+#include <cstdint>    /// 用于 uint32_t
+#include <iostream>   /// 用于输入输出操作
+#include <memory>     /// 用于 std::unique_ptr
+#include <random>     /// 用于 std::mt19937
+#include <thread>     /// 用于 std::thread::hardware_concurrency
+#include <utility>    /// 用于 std::pair
+#include <vector>     /// 用于 std::vector
+
+#include "./parallel_merge_sort.h"
+
+using sorting::parallel_merge_sort::multiway_merge;
+using sorting::parallel_merge_sort::parallel_merge_sort;
+
+/** 只按 first 比较，用于检查稳定性 */
+static bool by_first(const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first < b.first;
+}
+
+/**
+ * @brief 测试 merge path 切分
+ */
+static void test_merge_path() {
+    std::vector<int> a = {1, 3, 3, 5, 7}, b = {2, 3, 4, 8};
+    std::vector<int> out(a.size() + b.size());
+    // 任意切分点两侧分别合并，拼起来应与整体合并一致
+    for (size_t diag = 0; diag <= out.size(); diag++) {
+        size_t i = sorting::parallel_merge_sort::merge_path(
+            a.data(), a.size(), b.data(), b.size(), diag, std::less<int>());
+        size_t j = diag - i;
+        sorting::parallel_merge_sort::merge(a.data(), i, b.data(), j, out.data(),
+                                            std::less<int>());
+        sorting::parallel_merge_sort::merge(a.data() + i, a.size() - i, b.data() + j,
+                                            b.size() - j, out.data() + diag,
+                                            std::less<int>());
+        assert(out == std::vector<int>({1, 2, 3, 3, 3, 4, 5, 7, 8}));
+    }
+    std::cout << "merge path 测试: 通过！\n";
+}
+
+/**
+ * @brief 测试并行归并排序
+ */
+static void test_sort() {
+    std::mt19937 rng(31);
+    for (size_t threads : {1, 3, 8}) {
+        for (size_t n : {0, 1, 31, 32, 33, 1000, 50000, 200001}) {
+            std::vector<std::pair<int, int>> arr(n);
+            for (size_t i = 0; i < n; i++) {
+                arr[i] = {int(rng() % 1000), int(i)};
+            }
+            std::vector<std::pair<int, int>> expected = arr;
+            std::stable_sort(expected.begin(), expected.end(), by_first);
+            parallel_merge_sort(&arr, threads, by_first);
+            assert(arr == expected);
+        }
+    }
+    // 只能移动的类型：排序过程中不能出现拷贝
+    for (size_t threads : {1, 3}) {
+        std::vector<std::unique_ptr<int>> ptrs;
+        for (int i = 0; i < 5000; i++) ptrs.push_back(std::make_unique<int>(int(rng() % 1000)));
+        parallel_merge_sort(&ptrs, threads, [](const std::unique_ptr<int> &a,
+                                               const std::unique_ptr<int> &b) { return *a < *b; });
+        for (size_t i = 1; i < ptrs.size(); i++) assert(ptrs[i - 1] && *ptrs[i - 1] <= *ptrs[i]);
+    }
+    // -0.0 与 +0.0 比较相等但可以区分，稳定排序必须保持它们原来的先后次序
+    for (size_t threads : {1, 3}) {
+        std::vector<double> arr(1000);
+        for (double &x : arr) {
+            x = rng() % 4 == 0 ? double(rng() % 3) : (rng() % 2 ? 0.0 : -0.0);
+        }
+        std::vector<double> expected = arr;
+        std::stable_sort(expected.begin(), expected.end());
+        parallel_merge_sort(&arr, threads);
+        for (size_t i = 0; i < arr.size(); i++) {
+            assert(arr[i] == expected[i] && std::signbit(arr[i]) == std::signbit(expected[i]));
+        }
+    }
+    std::cout << "并行归并排序测试: 通过！\n";
+}
+
+/**
+ * @brief 测试 k 路归并：把数组切块分别排序，再合并
+ */
+static void test_multiway() {
+    std::mt19937 rng(5);
+    for (size_t k : {1, 2, 5, 16, 33}) {
+        std::vector<std::pair<int, int>> arr(10000);
+        for (size_t i = 0; i < arr.size(); i++) {
+            arr[i] = {int(rng() % 100), int(i)};
+        }
+        std::vector<std::pair<int, int>> expected = arr;
+        std::stable_sort(expected.begin(), expected.end(), by_first);
+
+        std::vector<std::pair<const std::pair<int, int> *, const std::pair<int, int> *>> runs;
+        size_t chunk = (arr.size() + k - 1) / k;
+        for (size_t lo = 0; lo < arr.size(); lo += chunk) {
+            size_t hi = std::min(lo + chunk, arr.size());
+            std::stable_sort(arr.begin() + lo, arr.begin() + hi, by_first);
+            runs.push_back({arr.data() + lo, arr.data() + hi});
+        }
+        runs.push_back({arr.data(), arr.data()});  // 空序列
+
+        std::vector<std::pair<int, int>> out(arr.size());
+        auto end = multiway_merge(runs, out.data(), by_first);
+        assert(end == out.data() + out.size());
+        assert(out == expected);
+    }
+    std::cout << "k 路归并测试: 通过！\n";
+}
+
+/**
+ * @brief 与 std::stable_sort 对比的基准测试
+ */
+static void benchmark() {
+    const size_t n = 10000000;
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::mt19937 rng(7);
+    std::vector<uint32_t> a(n);
+    for (auto &x : a) {
+        x = rng();
+    }
+    std::vector<uint32_t> b = a;
+
+    auto t0 = std::chrono::steady_clock::now();
+    parallel_merge_sort(&a, threads);
+    auto t1 = std::chrono::steady_clock::now();
+    std::stable_sort(b.begin(), b.end());
+    auto t2 = std::chrono::steady_clock::now();
+    assert(a == b);
+
+    std::cout << "\n基准测试（n = " << n << "，uint32，单位 ns/元素）\n"
+              << "parallel_merge_sort（" << threads << " 线程）: "
+              << std::chrono::duration<double, std::nano>(t1 - t0).count() / n
+              << "\nstd::stable_sort: "
+              << std::chrono::duration<double, std::nano>(t2 - t1).count() / n << "\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    test_merge_path();
+    test_sort();
+    test_multiway();
+    benchmark();
+    return 0;
+}
@@ -20,6 +20,9 @@
  *   4. 递归的基准情况是当给定部分的数组只包含一个元素时。
  *   5. 输出结果。
  *
+ * 这里的计数是 `uint32_t`，只适合较小的数组；需要 64 位计数、并行计算或批量求 Kendall tau 距离时，
+ * 见 `inversion_count.h`。
+ *
  * @author [Rakshit Raj](https://github.com/rakshitraj)
  */
 #include <cassert>   /// 用于assert验证
@@ -27,120 +30,10 @@
 #include <iostream>  /// 用于输入输出操作
 #include <vector>    /// 用于std::vector
 
-/**
- * @namespace sorting
- * @brief 排序算法
- */
+#include "./inversion_merge_sort.h"
+
 namespace sorting {
-/**
- * @namespace inversion
- * @brief 使用归并排序算法计算逆序对的函数
- */
 namespace inversion {
-
-// 使用的函数 --->
-// int mergeSort(int* arr, int* temp, int left, int right);
-// int merge(int* arr, int* temp, int left, int mid, int right);
-// int countInversion(int* arr, const int size);
-// void show(int* arr, const int size);
-
-/**
- * @brief 合并两个子数组的函数
- *
- * @details
- * merge() 函数从 mergeSort() 中调用，用于合并排序后的两个子数组，
- * 同时在合并过程中统计逆序对的数量并返回。
- *
- * @param arr    输入数组，即std::vector的数据成员
- * @param temp   用于存储合并结果的临时数组
- * @param left   数组的下界和左半部分的下界
- * @param mid    中点，左半部分的上界，`mid + 1` 为右半部分的下界
- * @param right  数组的上界和右半部分的上界
- * @returns 合并过程中发现的逆序对数量
- */
-template <typename T>
-uint32_t merge(T* arr, T* temp, uint32_t left, uint32_t mid, uint32_t right) {
-    uint32_t i = left;       /* i --> 左子数组的索引 */
-    uint32_t j = mid + 1;    /* j --> 右子数组的索引 */
-    uint32_t k = left;       /* k --> 结果数组temp的索引 */
-    uint32_t inv_count = 0;  // 逆序对计数
-
-    while ((i <= mid) && (j <= right)) {
-        if (arr[i] <= arr[j]) {
-            temp[k++] = arr[i++];  // 将较小的元素放入临时数组
-        } else {
-            temp[k++] = arr[j++];  // 如果右子数组的元素小于左子数组的元素，放入临时数组并增加逆序对的数量
-            inv_count += (mid - i + 1);  // 每次右子数组的元素小于左子数组时，都会增加 (mid - i + 1) 个逆序对
-        }
-    }
-
-    // 将左子数组剩余的元素添加到temp数组
-    while (i <= mid) {
-        temp[k++] = arr[i++];
-    }
-    // 将右子数组剩余的元素添加到temp数组
-    while (j <= right) {
-        temp[k++] = arr[j++];
-    }
-
-    // 将合并结果从temp数组拷贝回arr数组
-    for (k = left; k <= right; k++) {
-        arr[k] = temp[k];
-    }
-
-    return inv_count;  // 返回在合并过程中找到的逆序对数量
-}
-
-/**
- * @brief 实现归并排序并在合并时统计逆序对
- *
- * @details
- * mergeSort() 函数实现了归并排序，是一种分治算法，它将输入数组分成两半，
- * 并对每个子数组递归调用自己，然后调用merge()函数来合并两个子数组。
- *
- * @param arr   - 待排序的数组
- * @param temp  - 合并后的临时数组
- * @param left  - 数组的下界
- * @param right - 数组的上界
- * @returns 数组中的逆序对数量
- */
-template <typename T>
-uint32_t mergeSort(T* arr, T* temp, uint32_t left, uint32_t right) {
-    uint32_t mid = 0, inv_count = 0;
-    if (right > left) {
-        // 计算中点，分割数组
-        mid = (right + left) / 2;
-        // 递归计算左子数组的逆序对数量
-        inv_count += mergeSort(arr, temp, left, mid);  // 左子数组
-        // 递归计算右子数组的逆序对数量
-        inv_count += mergeSort(arr, temp, mid + 1, right);  // 右子数组
-
-        // 在合并时统计逆序对数量
-        inv_count += merge(arr, temp, left, mid, right);
-    }
-    return inv_count;  // 返回逆序对的总数
-}
-
-/**
- * @brief 函数countInversion()返回输入数组中的逆序对数量
- *
- * @details
- * 排序数组的逆序对数量为0，
- * 一个长度为n的数组完全按非升序排列时，逆序对数量为n(n-1)/2，
- * 因为每一对元素都构成一个逆序对。
- *
- * @param arr   - 输入的数组，数据成员为std::vector<int>
- * @param size  - 数组中的元素数量
- * @returns 输入数组中的逆序对数量，同时将数组排序
- */
-template <class T>
-uint32_t countInversion(T* arr, const uint32_t size) {
-    std::vector<T> temp;
-    temp.reserve(size);
-    temp.assign(size, 0);
-    return mergeSort(arr, temp.data(), 0, size - 1);  // 调用mergeSort来统计逆序对数量
-}
-
 /**
  * @brief 打印数组的实用函数
  * @param arr[]   - 要打印的数组
@@ -187,6 +80,14 @@ static void test() {
     std::cout << "逆序对数量: " << inv_count2 << std::endl;
     sorting::inversion::show(arr2.data(), size2);
     std::cout << "\n\n";
+
+    // 测试3 - 空数组和单个元素
+    std::vector<uint64_t> arr3;
+    assert(sorting::inversion::countInversion(arr3.data(), 0) == 0);
+    std::vector<uint64_t> arr4 = { 7 };
+    assert(sorting::inversion::countInversion(arr4.data(), 1) == 0);
+    assert(arr4[0] == 7);
+    std::cout << "测试3 成功!\n";
 }
 
 int main() {
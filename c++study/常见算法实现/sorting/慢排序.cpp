@@ -5,33 +5,13 @@
 // 他们的论文《Pessimal Algorithms and Simplexity Analysis》中描述了这一算法。
 // 该算法将一个问题分解成多个子问题，因此是“最差”的排序算法，
 // 但是它依然在不懈地朝着结果努力。
-// 它的时间复杂度是极其差的。
+// 它的时间复杂度是极其差的。算法本身见 slow_sort.h。
 
 #include <iostream>
 
-// SlowSort 算法的实现
-void SlowSort(int a[], int i, int j) {
-    if (i >= j)  // 如果i大于或等于j，则无需继续排序
-        return;
-    int m = i + (j - i) / 2;  // 计算中点m，避免溢出的方式
-    int temp;
-    
-    // 对左半部分排序
-    SlowSort(a, i, m);
-    
-    // 对右半部分排序
-    SlowSort(a, m + 1, j);
-    
-    // 如果右部分的元素小于中点元素，则交换两者
-    if (a[j] < a[m]) {
-        temp = a[j];  // 交换a[j]和a[m]
-        a[j] = a[m];
-        a[m] = temp;
-    }
-    
-    // 对剩余部分进行排序
-    SlowSort(a, i, j - 1);
-}
+#include "./slow_sort.h"
+
+using sorting::SlowSort;
 
 // 示例主函数
 int main() {
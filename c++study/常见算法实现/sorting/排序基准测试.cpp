@@ -0,0 +1,433 @@
+/**
+ * @file
+ * @brief `sorting/` 中各排序算法的统一基准测试
+ * @details 框架见 `sort_benchmark.h`。对每个算法、每种分布、从 1e2 到 --max-size 的每个 10 的幂，
+ * 输出一行 CSV（ns/元素、比较次数、移动次数、额外的峰值堆内存）到标准输出。
+ *
+ * `sorting/` 中的每个排序算法都放在头文件里，由 registry() 统一登记；各 `.cpp` 只保留自己的测试与演示。
+ * 新增算法时同样先把算法拆到头文件里，再在 registry() 中登记。登记时：
+ *
+ * - \f$O(n^2)\f$ 或更慢的算法用 `max_size` 限制规模，默认参数下整个基准测试能在几分钟内跑完；
+ * - 计数排序、珠排序等值域受限的算法用 `max_value` 跳过最大值放不下的分布（见 `bench::value_bound()`）；
+ * - 非比较排序、只支持算术类型或可平凡复制类型的算法没有计数版本。
+ *
+ * 没有登记的只有 `wave sort.cpp`、`波形排序.cpp`（结果是 a[0] >= a[1] <= a[2] ... 的波形排列，不是有序数组）
+ * 和 `最小交换次数.cpp`（求排序所需的最少交换次数，并不排序）。
+ *
+ * 用法：
+ *
+ *     ./a.out [--max-size N] [--count-max N] [--threads N] [--filter 子串]
+ *             [--baseline 旧结果.csv] [--tolerance 0.1]
+ *
+ * 默认 --max-size 为 1e6、--count-max 为 1e3：计数轮不计时，但 counted<T> 的每次比较/移动都要记数，
+ * O(n^2) 算法在 1e4 上的计数轮比计时本身还慢，是默认运行时间的大头；需要更大规模的计数时显式调大 --count-max。
+ *
+ * 给出 --baseline 时，在标准错误输出中列出相对基线变慢超过 tolerance、或比较/移动次数增加的组合，
+ * 有回退时返回 1。
+ */
+#include <algorithm>    /// 用于 std::sort, std::stable_sort
+#include <chrono>       /// 用于 std::chrono::steady_clock
+#include <cstddef>      /// 用于 std::max_align_t
+#include <cstdint>      /// 用于 uint64_t
+#include <cstdio>       /// 用于 std::fwrite, std::fread, std::remove
+#include <cstdlib>      /// 用于 std::malloc, std::free
+#include <cstring>      /// 用于 std::strcmp
+#include <filesystem>   /// 用于 std::filesystem::temp_directory_path
+#include <fstream>      /// 用于 std::ifstream
+#include <iostream>     /// 用于输入输出操作
+#include <limits>       /// 用于 std::numeric_limits
+#include <list>         /// 用于 std::list
+#include <new>          /// 用于 std::bad_alloc
+#include <string>       /// 用于 std::string
+#include <thread>       /// 用于 std::thread::hardware_concurrency
+#include <type_traits>  /// 用于 std::is_invocable_v
+#include <utility>      /// 用于 std::move
+#include <vector>       /// 用于 std::vector
+
+#include "./bead_sort.h"
+#include "./bitonic_sort.h"
+#include "./bogosort.h"
+#include "./bubble_sort.h"
+#include "./bucket_sort.h"
+#include "./comb_sort.h"
+#include "./counting_sort.h"
+#include "./cycle_sort.h"
+#include "./decimal_radix_sort.h"
+#include "./dnf_sort.h"
+#include "./external_sort.h"
+#include "./gnome_sort.h"
+#include "./heap_sort.h"
+#include "./insertion_sort.h"
+#include "./introsort.h"
+#include "./inversion_count.h"
+#include "./inversion_merge_sort.h"
+#include "./iterative_quick_sort.h"
+#include "./library_sort.h"
+#include "./lsd_radix_sort.h"
+#include "./merge_insertion_sort.h"
+#include "./merge_sort.h"
+#include "./msd_radix_sort.h"
+#include "./non_recursive_merge_sort.h"
+#include "./numeric_sort.h"
+#include "./odd_even_sort.h"
+#include "./pancake_sort.h"
+#include "./parallel_merge_sort.h"
+#include "./pigeonhole_sort.h"
+#include "./quick_sort.h"
+#include "./random_pivot_quick_sort.h"
+#include "./selection_sort.h"
+#include "./shell_sort.h"
+#include "./slow_sort.h"
+#include "./sort_benchmark.h"
+#include "./sorting_network.h"
+#include "./stooge_sort.h"
+#include "./strand_sort.h"
+#include "./timsort.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>  /// 用于 getpid
+#endif
+
+namespace bench = sorting::benchmark;
+using counted = bench::counted<uint64_t>;
+
+// 替换全局的 operator new/delete。每块内存前面多分配一个头部记下请求的大小，释放时从头部读回，
+// 不依赖 glibc 的 malloc_usable_size；头部按 max_align_t 对齐，返回的指针对齐不变。
+// 不允许内联：否则 GCC 会把内联后的 free 与调用方的 new 配对，误报 -Wmismatched-new-delete
+constexpr size_t kAllocHeader = alignof(std::max_align_t);
+
+[[gnu::noinline]] void *operator new(size_t size) {
+    void *p = std::malloc(size + kAllocHeader);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t *>(p) = size;
+    bench::record_allocation(size);
+    return static_cast<char *>(p) + kAllocHeader;
+}
+
+[[gnu::noinline]] void operator delete(void *p) noexcept {
+    if (p == nullptr) {
+        return;
+    }
+    void *base = static_cast<char *>(p) - kAllocHeader;
+    bench::record_free(*static_cast<size_t *>(base));
+    std::free(base);
+}
+
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+
+/**
+ * @brief 本进程专用的临时文件路径，同时运行的多个基准测试不会读写同一个文件
+ * @param suffix 区分同一进程中不同文件的后缀
+ */
+static std::string temp_path(const char *suffix) {
+#if defined(__unix__) || defined(__APPLE__)
+    static const std::string id = std::to_string(getpid());
+#else
+    static const std::string id =
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    const std::string name = "sort_benchmark_" + id + "_" + suffix + ".bin";
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/**
+ * @brief 参与测试的所有算法
+ * @param threads 并行算法使用的线程数
+ */
+static std::vector<bench::sort_entry> registry(size_t threads) {
+    const size_t unlimited = std::numeric_limits<size_t>::max();
+    auto key = [](const counted &x) { return x.value(); };
+    std::vector<bench::sort_entry> entries;
+
+    entries.push_back({"std::sort", unlimited,
+                       [](std::vector<uint64_t> *a) { std::sort(a->begin(), a->end()); },
+                       [](std::vector<counted> *a) { std::sort(a->begin(), a->end()); }});
+    entries.push_back({"std::stable_sort", unlimited,
+                       [](std::vector<uint64_t> *a) { std::stable_sort(a->begin(), a->end()); },
+                       [](std::vector<counted> *a) { std::stable_sort(a->begin(), a->end()); }});
+    entries.push_back({"introsort", unlimited,
+                       [](std::vector<uint64_t> *a) { sorting::introsort::introsort(a); },
+                       [](std::vector<counted> *a) { sorting::introsort::introsort(a); }});
+    // 以最后一个元素为基准，有序输入上退化为 O(n^2)，递归深度为 n
+    entries.push_back({"quick_sort", 10000,
+                       [](std::vector<uint64_t> *a) {
+                           sorting::quick_sort::quick_sort(a, 0, int(a->size()) - 1);
+                       },
+                       [](std::vector<counted> *a) {
+                           sorting::quick_sort::quick_sort(a, 0, int(a->size()) - 1);
+                       }});
+    // 三数取中/ninther 选基准，递归过深时改用堆排序，最坏情况也是 O(n log n)，不需要限制规模
+    entries.push_back({"quick_sort_parallel", unlimited,
+                       [threads](std::vector<uint64_t> *a) {
+                           sorting::quick_sort::quick_sort(a, 0, int(a->size()) - 1, threads);
+                       },
+                       [threads](std::vector<counted> *a) {
+                           sorting::quick_sort::quick_sort(a, 0, int(a->size()) - 1, threads);
+                       }});
+    entries.push_back({"timsort", unlimited,
+                       [](std::vector<uint64_t> *a) { sorting::timsort::timSort(a); },
+                       [](std::vector<counted> *a) { sorting::timsort::timSort(a); }});
+    entries.push_back({"parallel_merge_sort_1", unlimited,
+                       [](std::vector<uint64_t> *a) {
+                           sorting::parallel_merge_sort::parallel_merge_sort(a, 1);
+                       },
+                       [](std::vector<counted> *a) {
+                           sorting::parallel_merge_sort::parallel_merge_sort(a, 1);
+                       }});
+    entries.push_back({"parallel_merge_sort", unlimited,
+                       [threads](std::vector<uint64_t> *a) {
+                           sorting::parallel_merge_sort::parallel_merge_sort(a, threads);
+                       },
+                       [threads](std::vector<counted> *a) {
+                           sorting::parallel_merge_sort::parallel_merge_sort(a, threads);
+                       }});
+    entries.push_back({"lsd_radix_sort", unlimited,
+                       [](std::vector<uint64_t> *a) { sorting::lsd_radix_sort::radix_sort(a); },
+                       [key](std::vector<counted> *a) {
+                           std::vector<counted> buffer(a->size());
+                           sorting::lsd_radix_sort::sort_by_key(a->data(), buffer.data(),
+                                                                a->size(), key);
+                       }});
+    entries.push_back({"american_flag_sort_1", unlimited,
+                       [](std::vector<uint64_t> *a) {
+                           sorting::msd_radix_sort::american_flag_sort(a, 1);
+                       },
+                       [key](std::vector<counted> *a) {
+                           sorting::msd_radix_sort::sort_by_key(a->data(), a->size(), key, 1);
+                       }});
+    entries.push_back({"american_flag_sort", unlimited,
+                       [threads](std::vector<uint64_t> *a) {
+                           sorting::msd_radix_sort::american_flag_sort(a, threads);
+                       },
+                       [key, threads](std::vector<counted> *a) {
+                           sorting::msd_radix_sort::sort_by_key(a->data(), a->size(), key,
+                                                                threads);
+                       }});
+
+    // 以下是其余各 .cpp 中的算法。同一个泛型 lambda 同时用于计时（uint64_t）和计数（counted）
+    const size_t quadratic = 10000;  // O(n^2) 算法的最大规模：1e4 时每次排序约 0.1 秒
+    // 只接受 std::vector<uint64_t> * 的 lambda 没有计数版本
+    auto add = [&entries](std::string name, size_t max_size, auto sort) {
+        bench::sort_entry entry{std::move(name), max_size, sort, nullptr};
+        if constexpr (std::is_invocable_v<decltype(sort), std::vector<counted> *>) {
+            entry.sort_counted = sort;
+        }
+        entries.push_back(std::move(entry));
+        return &entries.back();
+    };
+
+    // 快速排序的变体
+    // 以最后一个元素为基准，有序输入上退化为 O(n^2)，递归深度为 n
+    add("quick_sort_3way", quadratic, [](auto *a) {
+        sorting::quick_sort::quick_sort_3way(a, 0, int(a->size()) - 1);
+    });
+    // Lomuto 分区把等于基准的元素都放在一侧，few_unique、ternary 分布上退化为 O(n^2)
+    add("random_pivot_quick_sort", quadratic, [](auto *a) {
+        sorting::random_pivot_quick_sort::quickSortRP(a->data(), 0, int64_t(a->size()) - 1);
+    });
+    add("iterative_quick_sort", quadratic, [](auto *a) { sorting::iterativeQuickSort(*a); });
+
+    // 归并排序的变体
+    add("merge_sort", unlimited, [](auto *a) {
+        sorting::merge_sort::mergeSort(a->data(), 0, int(a->size()) - 1);
+    });
+    add("non_recursive_merge_sort", unlimited,
+        [](auto *a) { sorting::non_recursive_merge_sort(a->begin(), a->end()); });
+    add("merge_insertion_sort", unlimited,
+        [](auto *a) { sorting::merge_insertion::merge_insertion_sort(a); });
+    // 统计逆序对的同时把数组排好序
+    add("inversion_merge_sort", unlimited, [](auto *a) {
+        sorting::inversion::countInversion(a->data(), uint32_t(a->size()));
+    });
+    add("count_inversions", unlimited,
+        [threads](auto *a) { sorting::inversion::count_inversions(a, threads); });
+    // 经过临时文件的完整外部排序，时间包括写入输入与读出结果；记录必须可平凡复制，没有计数版本
+    add("external_sort", unlimited, [](std::vector<uint64_t> *a) {
+        const std::string input = temp_path("in");
+        const std::string output = temp_path("out");
+        std::FILE *f = sorting::external_sort::open_file(input, "wb");
+        std::fwrite(a->data(), sizeof(uint64_t), a->size(), f);
+        std::fclose(f);
+        sorting::external_sort::config cfg;
+        cfg.memory_budget = size_t(1) << 20;  // 1 MiB：1e6 个元素时会生成多个 run 再归并
+        sorting::external_sort::sort_file<uint64_t>(input, output, cfg);
+        f = sorting::external_sort::open_file(output, "rb");
+        size_t got = std::fread(a->data(), sizeof(uint64_t), a->size(), f);
+        std::fclose(f);
+        std::remove(input.c_str());
+        std::remove(output.c_str());
+        if (got != a->size()) {
+            a->clear();  // 让结果检查失败
+        }
+    });
+
+    // 其它 O(n log n) 的比较排序
+    add("heap_sort", unlimited,
+        [](auto *a) { sorting::heap_sort::heapSort(a->data(), int(a->size())); });
+    add("bitonic_sort", unlimited,
+        [](auto *a) { sorting::bitonic_sort::sort(a->data(), a->size()); });
+    add("comb_sort", unlimited,
+        [](auto *a) { sorting::comb_sort::CombSort(a->data(), 0, a->size()); });
+    // Ciura 的间隔序列最大只有 701，规模很大时接近 O(n^2 / 701)
+    add("shell_sort", 100000, [](auto *a) { sorting::shell_sort(a); });
+    add("shell_sort_halving", 100000,
+        [](auto *a) { sorting::shell_sort_halving(a->data(), a->size()); });
+    add("sorting_network", sorting::sorting_network::kMaxNetworkSize,
+        [](auto *a) { sorting::sorting_network::sort_small(a->data(), a->size()); });
+    // 比较的是十进制字符串，时间包括与字符串之间的转换
+    add("numeric_sort", unlimited, [](std::vector<uint64_t> *a) {
+        std::vector<std::string> s;
+        s.reserve(a->size());
+        for (uint64_t x : *a) {
+            s.push_back(std::to_string(x));
+        }
+        std::sort(s.begin(), s.end(), sorting::numeric_sort::NumericSort);
+        for (size_t i = 0; i < s.size(); i++) {
+            (*a)[i] = std::stoull(s[i]);
+        }
+    });
+
+    // O(n^2) 的比较排序
+    add("insertion_sort", quadratic,
+        [](auto *a) { sorting::insertionSort(a->data(), int(a->size())); });
+    add("binary_insertion_sort", quadratic, [](auto *a) { sorting::insertionSort_binsrch(*a); });
+    add("bubble_sort", quadratic, [](auto *a) { sorting::bubble_sort(a); });
+    add("recursive_bubble_sort", quadratic,
+        [](auto *a) { sorting::recursive_bubble_sort(a, a->size()); });
+    add("selection_sort", quadratic,
+        [](auto *a) { *a = sorting::selectionSort(*a, a->size()); });
+    add("recursive_selection_sort", quadratic, [](auto *a) {
+        sorting::selection_sort_recursive::selectionSortRecursive(*a);
+    });
+    add("cocktail_selection_sort", quadratic, [](auto *a) {
+        sorting::CocktailSelectionSort(a, 0, int64_t(a->size()) - 1);
+    });
+    add("cocktail_selection_sort_recursive", quadratic, [](auto *a) {
+        sorting::CocktailSelectionSort_v2(a, 0, int64_t(a->size()) - 1);
+    });
+    add("gnome_sort", quadratic, [](auto *a) { sorting::gnomeSort(a->data(), a->size()); });
+    add("odd_even_sort", quadratic,
+        [](auto *a) { sorting::odd_even_sort::oddEven(*a, a->size()); });
+    add("cycle_sort", quadratic, [](auto *a) { sorting::cycle_sort::cycle_sort(a); });
+    add("pancake_sort", quadratic,
+        [](auto *a) { sorting::pancake_sort::pancakeSort(*a, int(a->size())); });
+    // 有冲突时整个图书馆重建一次，有序输入上每插入两个元素就重建一次
+    add("library_sort", quadratic,
+        [](auto *a) { sorting::library_sort::librarySort(a->data(), int(a->size())); });
+    // 逆序输入上每一轮只能取出一个元素，链表合并是 O(n^2)
+    add("strand_sort", quadratic, [](auto *a) {
+        using T = typename std::remove_pointer_t<decltype(a)>::value_type;
+        std::list<T> sorted = sorting::strand::strand_sort(std::list<T>(a->begin(), a->end()));
+        std::move(sorted.begin(), sorted.end(), a->begin());
+    });
+
+    // 比 O(n^2) 更慢的算法，只测很小的规模
+    add("stooge_sort", 1000, [](auto *a) { sorting::stooge_sort::stooge_sort(a); });  // O(n^2.71)
+    add("slow_sort", 100, [](auto *a) { sorting::SlowSort(a->data(), 0, int(a->size()) - 1); });
+    add("bogosort", 8, [](auto *a) { sorting::bogosort(a); });  // 期望 O(n * n!)
+
+    // 非比较排序，没有计数版本
+    // 桶号由值换算成 double 得到，只支持算术类型
+    add("bucket_sort", unlimited,
+        [](std::vector<uint64_t> *a) { sorting::bucket_sort::bucketSort(a->data(), a->size()); });
+    add("radix_sort_decimal", unlimited,
+        [](std::vector<uint64_t> *a) { *a = sorting::radix_sort::radix(*a); });
+    // 每一位对 0~9 各扫描一遍数组，O(10 * 20 * n)
+    add("radixsort_decimal_scan", 100000,
+        [](std::vector<uint64_t> *a) { sorting::radixsort(a->data(), int(a->size())); });
+    // 以下算法需要的内存随值域增长
+    add("counting_sort", unlimited,
+        [](std::vector<uint64_t> *a) { sorting::counting_sort::counting_sort(a); })
+        ->max_value = uint64_t(1) << 20;
+    add("pigeonhole_sort", unlimited,
+        [](std::vector<uint64_t> *a) { sorting::pigeonhole_sort(a->data(), a->size()); })
+        ->max_value = uint64_t(1) << 20;
+    // n * max 个珠子
+    add("bead_sort", quadratic,
+        [](std::vector<uint64_t> *a) { sorting::bead_sort::beadSort(a->data(), a->size()); })
+        ->max_value = 1000;
+    // 只能排序 0、1、2 三种值，只测 ternary 分布
+    add("dnf_sort", unlimited,
+        [](std::vector<uint64_t> *a) { sorting::dnf_sort::dnf_sort(a); })
+        ->max_value = 2;
+    return entries;
+}
+
+/**
+ * @brief 输出用法
+ */
+static void usage(std::ostream &out, const char *program) {
+    out << "用法: " << program << " [--max-size N] [--count-max N] [--threads N] [--filter 子串]\n"
+        << "       [--baseline 旧结果.csv] [--tolerance 0.1]\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示没有回退，1 表示相对基线有回退
+ */
+int main(int argc, char **argv) {
+    size_t max_size = 1000000;
+    size_t count_max = 1000;
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string filter, baseline_path;
+    double tolerance = 0.1;
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 == argc) {
+            std::cerr << "参数缺少取值: " << argv[i] << "\n";
+            usage(std::cerr, argv[0]);
+            return 2;
+        }
+        if (std::strcmp(argv[i], "--max-size") == 0) {
+            max_size = std::stoull(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--count-max") == 0) {
+            count_max = std::stoull(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            threads = std::stoull(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--filter") == 0) {
+            filter = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--baseline") == 0) {
+            baseline_path = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0) {
+            tolerance = std::stod(argv[i + 1]);
+        } else {
+            std::cerr << "未知参数: " << argv[i] << "\n";
+            usage(std::cerr, argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<bench::result> results;
+    bench::write_csv_header(std::cout);
+    for (const auto &entry : registry(threads)) {
+        if (entry.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        // 最大规模不到 100 的算法（排序网络、bogosort 等）只测它的最大规模
+        for (size_t n = std::min<size_t>(100, entry.max_size);
+             n <= std::min(max_size, entry.max_size); n *= 10) {
+            for (bench::distribution d : bench::kAllDistributions) {
+                if (bench::value_bound(d, n) > entry.max_value) {
+                    continue;
+                }
+                results.push_back(bench::measure(entry, d, n, count_max));
+                bench::write_csv_row(std::cout, results.back());
+                std::cout.flush();
+            }
+        }
+    }
+
+    if (!baseline_path.empty()) {
+        std::ifstream in(baseline_path);
+        if (!in) {
+            std::cerr << "无法打开基线文件: " << baseline_path << "\n";
+            return 2;
+        }
+        size_t regressions =
+            bench::compare(bench::read_csv(in), results, tolerance, std::cerr);
+        std::cerr << "共 " << regressions << " 处回退\n";
+        return regressions == 0 ? 0 : 1;
+    }
+    return 0;
+}
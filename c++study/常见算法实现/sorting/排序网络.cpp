@@ -0,0 +1,175 @@
+/**
+ * @file
+ * @brief 排序网络与 SIMD Bitonic 排序内核的测试与基准测试
+ * @details 算法本身见 `sorting_network.h`。用 `-mavx2` 或 `-msse4.2` 编译可以启用对应的
+ * SIMD 内核，否则测试标量排序网络。
+ */
+#include <algorithm>  /// 用于 std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cmath>      /// 用于 std::isnan
+#include <cstdint>    /// 用于 int32_t, int64_t
+#include <iostream>   /// 用于输入输出操作
+#include <limits>     /// 用于 std::numeric_limits
+#include <random>     /// 用于 std::mt19937_64
+#include <vector>     /// 用于 std::vector
+
+#include "./sorting_network.h"
+
+namespace sn = sorting::sorting_network;
+
+/**
+ * @brief 用 0-1 原理验证排序网络：网络能排好所有 0/1 序列，就能排好任意序列
+ */
+template <size_t N>
+static void check_zero_one() {
+    static_assert(N <= 20, "只对较小的 N 穷举");
+    for (uint32_t bits = 0; bits < (1u << N); bits++) {
+        int x[N];
+        for (size_t i = 0; i < N; i++) x[i] = (bits >> i) & 1;
+        sn::network_sort<N>(x);
+        assert(std::is_sorted(x, x + N));
+    }
+}
+
+/**
+ * @brief 对每个长度 0..64 随机测试某个小数组排序函数
+ */
+template <typename T, typename Sort>
+static void check_random(Sort sort_fn) {
+    std::mt19937_64 rng(3);
+    for (size_t n = 0; n <= sn::kMaxNetworkSize; n++) {
+        for (int rep = 0; rep < 200; rep++) {
+            std::vector<T> x(n);
+            for (auto &v : x) {
+                v = rep % 2 ? T(int64_t(rng() % 7) - 3) : T(int64_t(rng()));
+            }
+            std::vector<T> expected = x;
+            std::sort(expected.begin(), expected.end());
+            sort_fn(x.data(), n);
+            assert(x == expected);
+        }
+    }
+}
+
+/**
+ * @brief 含 NaN 的输入：结果必须是输入的排列（NaN 个数不变，其余元素不丢失、不重复）
+ * @param sort_fn 小数组排序函数
+ * @param nan_last 为真时还要求 NaN 都在末尾、其余元素有序（SIMD 内核）
+ */
+template <typename T, typename Sort>
+static void check_nan(Sort sort_fn, bool nan_last) {
+    std::mt19937_64 rng(5);
+    for (size_t n = 1; n <= sn::kMaxNetworkSize; n++) {
+        for (int rep = 0; rep < 200; rep++) {
+            std::vector<T> x(n);
+            for (auto &v : x) {
+                v = rng() % 4 == 0 ? std::numeric_limits<T>::quiet_NaN() : T(int64_t(rng() % 100));
+            }
+            auto split = [](std::vector<T> v) {
+                auto mid = std::partition(v.begin(), v.end(), [](T a) { return !std::isnan(a); });
+                size_t nans = size_t(v.end() - mid);
+                v.erase(mid, v.end());
+                std::sort(v.begin(), v.end());
+                return std::make_pair(v, nans);
+            };
+            const auto expected = split(x);
+            sort_fn(x.data(), n);
+            assert(split(x) == expected);
+            if (nan_last) {
+                const size_t m = n - expected.second;
+                assert(std::equal(x.begin(), x.begin() + m, expected.first.begin()));
+                assert(std::all_of(x.begin() + m, x.end(), [](T a) { return std::isnan(a); }));
+            }
+        }
+    }
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    // 第1个测试：比较器个数与 0-1 原理
+    static_assert(sn::network<4>::size == 5, "4 个元素的 Batcher 网络有 5 个比较器");
+    static_assert(sn::network<8>::size == 19, "8 个元素的 Batcher 网络有 19 个比较器");
+    check_zero_one<5>();
+    check_zero_one<12>();
+    check_zero_one<16>();
+    check_zero_one<17>();
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：标量排序网络
+    check_random<int32_t>([](int32_t *x, size_t n) { sn::network_sort_n(x, n); });
+    check_random<double>([](double *x, size_t n) { sn::network_sort_n(x, n); });
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：统一入口（有 SIMD 内核时走 SIMD）
+    check_random<int32_t>([](int32_t *x, size_t n) { sn::sort_small(x, n); });
+    check_random<float>([](float *x, size_t n) { sn::sort_small(x, n); });
+    check_random<int64_t>([](int64_t *x, size_t n) { sn::sort_small(x, n); });
+    check_random<uint16_t>([](uint16_t *x, size_t n) { sn::sort_small(x, n); });
+#if defined(__AVX2__) || defined(__SSE4_2__)
+    // 直接测试 SIMD 内核，包括 sort_small 不会交给它的短数组
+    check_random<int32_t>([](int32_t *x, size_t n) { sn::bitonic_sort_simd(x, n); });
+    check_random<float>([](float *x, size_t n) { sn::bitonic_sort_simd(x, n); });
+    check_random<int64_t>([](int64_t *x, size_t n) { sn::bitonic_sort_simd(x, n); });
+#endif
+    std::cout << "第3个测试: 通过！（SIMD 内核: "
+              << (sn::has_simd_kernel<int32_t>() ? "启用" : "未启用") << "）\n";
+
+    // 第4个测试：含 NaN 的浮点数不会丢失或重复元素
+    check_nan<float>([](float *x, size_t n) { sn::sort_small(x, n); }, false);
+    check_nan<double>([](double *x, size_t n) { sn::sort_small(x, n); }, false);
+#if defined(__AVX2__) || defined(__SSE4_2__)
+    check_nan<float>([](float *x, size_t n) { sn::bitonic_sort_simd(x, n); }, true);
+#endif
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 对比小数组排序的速度
+ */
+template <typename T>
+static void benchmark_type(const char *name) {
+    std::mt19937_64 rng(11);
+    const size_t total = 1 << 22;
+    std::vector<T> input(total);
+    for (auto &v : input) v = T(int64_t(rng()));
+
+    std::cout << name << "\n";
+    for (size_t n : {8, 16, 32, 64}) {
+        auto time = [&](auto sort_fn) {
+            std::vector<T> a = input;
+            auto t0 = std::chrono::steady_clock::now();
+            for (size_t i = 0; i + n <= total; i += n) sort_fn(a.data() + i, n);
+            auto t1 = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(t1 - t0).count() / total;
+        };
+        double net = time([](T *x, size_t m) { sn::network_sort_n(x, m); });
+        double small = time([](T *x, size_t m) { sn::sort_small(x, m); });
+        double stl = time([](T *x, size_t m) { std::sort(x, x + m); });
+        std::cout << "  n = " << n << "\t排序网络: " << net << "\tsort_small: " << small
+                  << "\tstd::sort: " << stl << "\n";
+    }
+}
+
+/**
+ * @brief 基准测试（单位 ns/元素）
+ */
+static void benchmark() {
+    std::cout << "\n基准测试（单位 ns/元素）\n";
+    benchmark_type<int32_t>("int32");
+    benchmark_type<float>("float");
+    benchmark_type<int64_t>("int64");
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();
+    benchmark();
+    return 0;
+}
@@ -1,7 +1,7 @@
 /**
  * \file
  * \brief [二分插入排序算法
- * (插入排序)](https://en.wikipedia.org/wiki/Insertion_sort)
+ * (插入排序)](https://en.wikipedia.org/wiki/Insertion_sort)的测试，实现见 `insertion_sort.h`
  *
  * \details
  * 当比较操作的代价超过交换操作时，比如使用引用存储的字符串键，或者像人类交互（选择并排显示的一个）等情况，
@@ -31,65 +31,7 @@
 #include <iostream>   /// 用于 IO 操作
 #include <vector>     /// 用于操作向量
 
-/**
- * \namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-
-/**
- * \brief 二分查找函数，用于查找元素的合适位置。
- * \tparam T 泛型数据类型。
- * \param arr 要搜索的实际向量。
- * \param val 需要找到合适位置的值。
- * \param low 搜索范围的下界。
- * \param high 搜索范围的上界。
- * \returns 返回值 val 在 arr 中的合适位置索引。
- */
-template <class T>
-int64_t binary_search(std::vector<T> &arr, T val, int64_t low, int64_t high) {
-    if (high <= low) {
-        // 如果 val 大于 arr[low]，则返回 low + 1，否则返回 low
-        return (val > arr[low]) ? (low + 1) : low;
-    }
-    int64_t mid = low + (high - low) / 2;  // 计算中间位置
-    if (arr[mid] > val) {
-        // 如果中间值大于 val，继续在左侧递归查找
-        return binary_search(arr, val, low, mid - 1);
-    } else if (arr[mid] < val) {
-        // 如果中间值小于 val，继续在右侧递归查找
-        return binary_search(arr, val, mid + 1, high);
-    } else {
-        // 如果值相等，返回 mid + 1
-        return mid + 1;
-    }
-}
-
-/**
- * \brief 插入排序函数，使用二分查找来找到合适的插入位置。
- * \tparam T 泛型数据类型。
- * \param arr 要排序的实际向量。
- * \returns 无返回值。
- */
-template <typename T>
-void insertionSort_binsrch(std::vector<T> &arr) {
-    int64_t n = arr.size();  // 获取向量的大小
-
-    // 从第二个元素开始遍历
-    for (int64_t i = 1; i < n; i++) {
-        T key = arr[i];  // 当前要插入的元素
-        int64_t j = i - 1;
-        // 使用二分查找找到当前元素的插入位置
-        int64_t loc = sorting::binary_search(arr, key, 0, j);
-        // 移动元素以腾出位置
-        while (j >= loc) {
-            arr[j + 1] = arr[j];
-            j--;
-        }
-        arr[j + 1] = key;  // 插入元素到正确的位置
-    }
-}
-}  // namespace sorting
+#include "./insertion_sort.h"
 
 /**
  * @brief 自我测试实现
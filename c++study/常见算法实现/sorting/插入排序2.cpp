@@ -1,7 +1,7 @@
 /**
  *
  * \file
- * \brief [插入排序算法](https://en.wikipedia.org/wiki/Insertion_sort)
+ * \brief [插入排序算法](https://en.wikipedia.org/wiki/Insertion_sort)的测试，实现见 `insertion_sort.h`
  *
  * \details
  * 插入排序是一种简单的排序算法，它通过逐步构建最终排序的数组来实现排序。
@@ -32,53 +32,7 @@
 #include <iostream>
 #include <vector>
 
-/** \namespace sorting
- * \brief 排序算法
- */
-namespace sorting {
-/** \brief
- * 插入排序函数
- *
- * @tparam T 数组的类型
- * @param [in,out] arr 要排序的数组
- * @param n 数组的大小
- */
-template <typename T>
-void insertionSort(T *arr, int n) {
-    for (int i = 1; i < n; i++) {  // 从数组的第二个元素开始
-        T temp = arr[i];            // 取出当前元素
-        int j = i - 1;
-        // 将当前元素与前面已排序的元素逐一比较并插入到正确的位置
-        while (j >= 0 && temp < arr[j]) {
-            arr[j + 1] = arr[j];  // 移动元素
-            j--;
-        }
-        arr[j + 1] = temp;  // 插入元素到正确的位置
-    }
-}
-
-/** 插入排序函数（针对std::vector）
- *
- * @tparam T 数组的类型
- * @param [in,out] arr 指向要排序数组的指针
- */
-template <typename T>
-void insertionSort(std::vector<T> *arr) {
-    size_t n = arr->size();  // 获取数组大小
-
-    for (size_t i = 1; i < n; i++) {  // 从第二个元素开始
-        T temp = arr->at(i);           // 获取当前元素
-        int32_t j = i - 1;
-        // 将当前元素与前面已排序的元素逐一比较并插入到正确的位置
-        while (j >= 0 && temp < arr->at(j)) {
-            arr->at(j + 1) = arr->at(j);  // 移动元素
-            j--;
-        }
-        arr->at(j + 1) = temp;  // 插入元素到正确的位置
-    }
-}
-
-}  // namespace sorting
+#include "./insertion_sort.h"
 
 /**
  * @brief 创建随机数组的辅助函数
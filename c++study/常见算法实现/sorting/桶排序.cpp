@@ -1,32 +1,12 @@
-// C++ 程序使用桶排序算法对数组进行排序
+// C++ 程序使用桶排序算法对数组进行排序，实现见 bucket_sort.h
 #include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <vector>
 
-// 使用桶排序算法对数组 arr[] 进行排序，数组大小为 n
-void bucketSort(float arr[], int n) {
-    // 1) 创建 n 个空桶
-    std::vector<float> *b = new std::vector<float>[n];
+#include "./bucket_sort.h"
 
-    // 2) 将数组元素分配到不同的桶中
-    for (int i = 0; i < n; i++) {
-        int bi = n * arr[i];  // 计算桶的索引
-        b[bi].push_back(arr[i]);  // 将元素放入对应的桶中
-    }
-
-    // 3) 对每个桶内的元素进行排序
-    for (int i = 0; i < n; i++) {
-        std::sort(b[i].begin(), b[i].end());  // 对每个桶中的元素进行排序
-    }
-
-    // 4) 将所有桶中的元素合并到原数组 arr[] 中
-    int index = 0;  // 用于重新排列元素的索引
-    for (int i = 0; i < n; i++)
-        for (int j = 0; j < b[i].size(); j++) arr[index++] = b[i][j];  // 将桶中的元素按顺序复制回数组
-
-    // 释放桶的内存
-    delete[] b;
-}
+using sorting::bucket_sort::bucketSort;
 
 /* 驱动程序用于测试上述函数 */
 int main() {
@@ -39,5 +19,11 @@ int main() {
     for (int i = 0; i < n; i++) {
         std::cout << arr[i] << " ";  // 输出每个排序后的元素
     }
+
+    // 不在 [0, 1) 范围内的值（负数、1 以及更大的数）也要落在某个桶里
+    float arr2[] = {3.5, -1.25, 1, 0, 2.75, 1, -7};
+    int n2 = sizeof(arr2) / sizeof(arr2[0]);
+    bucketSort(arr2, n2);
+    assert(std::is_sorted(arr2, arr2 + n2));
     return 0;
 }
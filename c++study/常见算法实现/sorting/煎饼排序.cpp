@@ -13,6 +13,7 @@
  * @author [Divyansh Gupta](https://github.com/divyansh12323)
  * @see 更多关于 [Pancake sort](https://en.wikipedia.org/wiki/Pancake_sorting)
  * @see 相关问题在 [Leetcode](https://leetcode.com/problems/pancake-sorting/)
+ * @see pancake_sort.h 算法本身
  */
 
 #include <algorithm>  // 用于 std::is_sorted
@@ -20,66 +21,7 @@
 #include <iostream>   // 用于输入输出操作
 #include <vector>     // 用于 std::vector
 
-/**
- * @namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-/**
- * @namespace pancake_sort
- * @brief 薄煎饼排序算法的相关函数
- */
-namespace pancake_sort {
-/**
- * @brief 反转 C 风格数组中的元素
- * @param [start,end] arr 数组的元素。
- * @param start 数组的起始索引
- * @param end 数组的结束索引
- * @returns void
- */
-template <typename T>
-void reverse(std::vector<T> &arr, int start, int end) {
-    T temp;  // 临时变量
-    while (start <= end) {
-        temp = arr[start];
-        arr[start] = arr[end];
-        arr[end] = temp;
-        start++;
-        end--;
-    }
-}
-
-/**
- * @brief 该实现用于处理 C 风格数组输入，并就地修改数组。
- * @param [start,end] arr 数组元素
- * @param size 数组的大小
- * @returns 0
- */
-template <typename T>
-int pancakeSort(std::vector<T> &arr, int size) {
-    // 从最大元素开始，逐步减少排序的范围
-    for (int i = size; i > 1; --i) {
-        int max_index = 0, j = 0;  // 初始化一些变量
-        T max_value = 0;
-        
-        // 找到最大元素的索引
-        for (j = 0; j < i; j++) {
-            if (arr[j] >= max_value) {
-                max_value = arr[j];
-                max_index = j;
-            }
-        }
-
-        // 如果最大元素不是当前范围的最后一个元素，则进行两次反转
-        if (max_index != i - 1) {
-            reverse(arr, 0, max_index);  // 反转前半部分
-            reverse(arr, 0, i - 1);      // 反转整个当前范围
-        }
-    }
-    return 0;
-}
-}  // namespace pancake_sort
-}  // namespace sorting
+#include "./pancake_sort.h"
 
 /**
  * @brief 测试实现
@@ -122,6 +64,18 @@ static void test() {
         std::cout << arr3[i] << ", ";
     }
     std::cout << std::endl;
+
+    // 示例4：全是负数的数组（最大值小于 0）
+    const int size4 = 6;
+    std::cout << "\nTest 4- 负数...";
+    std::vector<int> arr4 = {-3, -10, -1, -7, -2, -5};
+    sorting::pancake_sort::pancakeSort(arr4, size4);
+    assert(std::is_sorted(arr4.begin(), arr4.end()));  // 检查数组是否排序
+    std::cout << "通过测试\n";
+    for (int i = 0; i < size4; i++) {
+        std::cout << arr4[i] << " ,";
+    }
+    std::cout << std::endl;
 }
 
 /**
@@ -0,0 +1,133 @@
+/**
+ * @file
+ * @brief 64 位并行逆序对计数、树状数组版本与 Kendall tau 批量接口的测试与基准测试
+ * @details 算法本身见 `inversion_count.h`。
+ */
+#include <algorithm>  /// 用于 std::is_sorted, std::shuffle
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 uint32_t, uint64_t
+#include <iostream>   /// 用于输入输出操作
+#include <numeric>    /// 用于 std::iota
+#include <random>     /// 用于 std::mt19937
+#include <thread>     /// 用于 std::thread::hardware_concurrency
+#include <vector>     /// 用于 std::vector
+
+#include "./inversion_count.h"
+
+using sorting::inversion::count_inversions;
+using sorting::inversion::count_inversions_bounded;
+using sorting::inversion::kendall_tau;
+
+/**
+ * @brief 朴素的 O(n^2) 逆序对计数，作为对照
+ */
+static uint64_t brute_force(const std::vector<int> &a) {
+    uint64_t count = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = i + 1; j < a.size(); j++) {
+            count += a[j] < a[i];
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937 rng(7);
+
+    // 第1个测试：与朴素算法对照，覆盖小段、跨任务边界和大量重复元素
+    for (size_t n : {0, 1, 2, 31, 32, 33, 100, 1000, 20000}) {
+        for (int keys : {3, 1 << 20}) {
+            std::vector<int> a(n);
+            for (auto &v : a) v = int(rng() % keys);
+            uint64_t expected = brute_force(a);
+            assert(count_inversions_bounded(a.data(), n, keys - 1) == expected);
+            for (size_t threads : {1, 4}) {
+                std::vector<int> b = a;
+                assert(count_inversions(&b, threads) == expected);
+                assert(std::is_sorted(b.begin(), b.end()));
+            }
+        }
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：逆序数组的逆序对数超过 2^32
+    const size_t n = 200000;
+    std::vector<uint32_t> rev(n);
+    for (size_t i = 0; i < n; i++) rev[i] = uint32_t(n - 1 - i);
+    const uint64_t all_pairs = uint64_t(n) * (n - 1) / 2;
+    assert(count_inversions_bounded(rev.data(), n, n - 1) == all_pairs);
+    assert(count_inversions(&rev, 4) == all_pairs);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：Kendall tau 距离，批量接口与逐个计算一致，两种并行方式一致
+    std::vector<uint32_t> reference(50000);
+    std::iota(reference.begin(), reference.end(), 0);
+    std::shuffle(reference.begin(), reference.end(), rng);
+    kendall_tau tau(reference);
+    assert(tau.distance(reference, 2) == 0);
+    std::vector<uint32_t> reversed(reference.rbegin(), reference.rend());
+    assert(tau.distance(reversed, 2) == uint64_t(50000) * 49999 / 2);
+
+    std::vector<std::vector<uint32_t>> rankings(6, reference);
+    for (auto &r : rankings) std::shuffle(r.begin(), r.end(), rng);
+    std::vector<uint64_t> by_ranking = tau.distance_batch(rankings, 3);
+    std::vector<uint64_t> within_ranking = tau.distance_batch(rankings, 8);
+    assert(by_ranking == within_ranking);
+    for (size_t r = 0; r < rankings.size(); r++) {
+        // 按参考排名重新编号后用树状数组计数
+        std::vector<uint32_t> position(reference.size()), seq(reference.size());
+        for (size_t i = 0; i < reference.size(); i++) position[reference[i]] = uint32_t(i);
+        for (size_t i = 0; i < seq.size(); i++) seq[i] = position[rankings[r][i]];
+        assert(by_ranking[r] ==
+               count_inversions_bounded(seq.data(), seq.size(), seq.size() - 1));
+    }
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 基准测试：对随机排列计数
+ */
+static void benchmark() {
+    const size_t n = 1 << 24;
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> input(n);
+    std::iota(input.begin(), input.end(), 0);
+    std::shuffle(input.begin(), input.end(), std::mt19937(1));
+
+    auto time = [&](const char *name, auto count_fn) {
+        std::vector<uint32_t> a = input;
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t count = count_fn(a);
+        auto t1 = std::chrono::steady_clock::now();
+        std::cout << "  " << name << ": "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count()
+                  << " ms（逆序对 " << count << "）\n";
+    };
+
+    std::cout << "\n基准测试（n = " << n << " 的随机排列）\n";
+    std::vector<uint32_t> buffer(n);
+    time("归并计数，1 线程", [&](std::vector<uint32_t> &a) {
+        return count_inversions(a.data(), n, buffer.data(), 1);
+    });
+    time("归并计数，多线程", [&](std::vector<uint32_t> &a) {
+        return count_inversions(a.data(), n, buffer.data(), threads);
+    });
+    time("树状数组", [&](std::vector<uint32_t> &a) {
+        return count_inversions_bounded(a.data(), n, n - 1);
+    });
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main() {
+    tests();
+    benchmark();
+    return 0;
+}
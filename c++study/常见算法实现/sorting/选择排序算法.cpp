@@ -1,6 +1,6 @@
 /******************************************************************************
  * @file
- * @brief 实现了使用交换操作的 [选择排序算法](https://en.wikipedia.org/wiki/Selection_sort)
+ * @brief 使用交换操作的 [选择排序算法](https://en.wikipedia.org/wiki/Selection_sort)的测试，实现见 `selection_sort.h`
  * @details
  * 选择排序算法将输入的向量分为两个部分：已排序的子向量（从左到右构建）和剩余的未排序部分。
  * 初始时，已排序的子向量为空，未排序的部分是整个输入向量。
@@ -23,41 +23,7 @@
 #include <iostream>   /// 用于输入输出操作
 #include <vector>     /// 用于 std::vector
 
-/******************************************************************************
- * @namespace sorting
- * @brief 排序算法
- *******************************************************************************/
-namespace sorting {
-/******************************************************************************
- * @brief 选择排序的主函数实现
- * @param arr 需要排序的向量
- * @param len 向量的长度
- * @returns 返回排序后的向量
- *******************************************************************************/
-
-std::vector<uint64_t> selectionSort(const std::vector<uint64_t> &arr,
-                                    uint64_t len) {
-    std::vector<uint64_t> array(
-        arr.begin(),
-        arr.end());  // 声明一个新的向量用于存储结果
-    for (uint64_t it = 0; it < len; ++it) {
-        uint64_t min = it;  // 初始化最小值为当前索引
-        for (uint64_t it2 = it + 1; it2 < len; ++it2) {
-            if (array[it2] < array[min]) {  // 找到比当前最小值更小的元素
-                min = it2;  // 更新最小值的索引
-            }
-        }
-
-        if (min != it) {  // 如果最小值的索引不等于当前索引，交换元素
-            uint64_t tmp = array[min];
-            array[min] = array[it];
-            array[it] = tmp;
-        }
-    }
-
-    return array;  // 返回排序后的向量
-}
-}  // namespace sorting
+#include "./selection_sort.h"
 
 /*******************************************************************************
  * @brief 自测试用例实现
@@ -96,10 +62,10 @@ static void test() {
 
     // 测试用例 #4
     // [1, 9, 11, 546, 26, 65, 212, 14, -11] 应该返回 [-11, 1, 9, 11, 14, 26, 65, 212, 546]
-    std::vector<uint64_t> vector4 = {1, 9, 11, 546, 26, 65, 212, 14, -11};
-    uint64_t vector4size = vector2.size();
+    std::vector<int64_t> vector4 = {1, 9, 11, 546, 26, 65, 212, 14, -11};
+    uint64_t vector4size = vector4.size();
     std::cout << "4th test... ";
-    std::vector<uint64_t> result_test4;
+    std::vector<int64_t> result_test4;
     result_test4 = sorting::selectionSort(vector4, vector4size);
     assert(std::is_sorted(result_test4.begin(), result_test4.end()));  // 检查排序是否正确
     std::cout << "Passed" << std::endl;
@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief 使用递归实现的 [选择排序](https://en.wikipedia.org/wiki/Selection_sort)
+ * @brief 使用递归实现的 [选择排序](https://en.wikipedia.org/wiki/Selection_sort)的测试，实现见 `selection_sort.h`
  * @details
  * 选择排序算法将输入列表分为两部分：已排序的子列表（从左到右构建）和剩余的未排序项。
  * 初始时，已排序的子列表为空，未排序的子列表是整个输入列表。
@@ -23,65 +23,7 @@
 #include <iostream>   /// 用于 std::swap 和输入输出操作
 #include <vector>     /// 用于 std::vector
 
-/**
- * @namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-/**
- * @namespace selection_sort_recursive
- * @brief 使用递归实现的 [选择排序](https://en.wikipedia.org/wiki/Selection_sort)
- */
-namespace selection_sort_recursive {
-/**
- * @brief 主要函数用于查找最小元素的索引
- * @tparam T 数组的类型
- * @param in_arr 要查找最小元素的数组
- * @param current_position 当前处理的位置（索引）
- * @returns 最小元素的索引
- */
-template <typename T>
-uint64_t findMinIndex(const std::vector<T> &in_arr,
-                      uint64_t current_position = 0) {
-    // 如果当前位置是数组的倒数第二个元素，返回当前位置
-    if (current_position + 1 == in_arr.size()) {
-        return current_position;
-    }
-    // 递归调用，找到当前数组中最小元素的索引
-    uint64_t answer = findMinIndex(in_arr, current_position + 1);
-    // 如果当前位置的元素更小，更新最小元素的索引
-    if (in_arr[current_position] < in_arr[answer]) {
-        answer = current_position;
-    }
-    return answer;
-}
-
-/**
- * @brief 主要函数实现选择排序
- * @tparam T 数组的类型
- * @param in_arr 要排序的数组，
- * @param current_position 当前处理的位置（索引）
- * @returns void
- */
-template <typename T>
-void selectionSortRecursive(std::vector<T> &in_arr,
-                            uint64_t current_position = 0) {
-    // 当当前位置等于数组的大小时，排序完成，递归结束
-    if (current_position == in_arr.size()) {
-        return;
-    }
-    // 找到从当前位置开始的最小元素的索引
-    uint64_t min_element_idx =
-        selection_sort_recursive::findMinIndex(in_arr, current_position);
-    // 如果最小元素的索引不等于当前索引，交换位置
-    if (min_element_idx != current_position) {
-        std::swap(in_arr[min_element_idx], in_arr[current_position]);
-    }
-    // 对剩余未排序部分递归进行选择排序
-    selectionSortRecursive(in_arr, current_position + 1);
-}
-}  // namespace selection_sort_recursive
-}  // namespace sorting
+#include "./selection_sort.h"
 
 /**
  * @brief 自测试用例实现
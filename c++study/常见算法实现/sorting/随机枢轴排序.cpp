@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief 实现 [随机枢轴快速排序](https://www.sanfoundry.com/cpp-program-implement-quick-sort-using-randomisation) 算法
+ * @brief 测试 [随机枢轴快速排序](https://www.sanfoundry.com/cpp-program-implement-quick-sort-using-randomisation) 算法，实现见 `random_pivot_quick_sort.h`
  * @details
  *          * 随机枢轴快速排序算法与传统的快速排序非常相似，唯一的区别在于如何选择枢轴元素。
  *          * 快速排序本身速度很快，但在最坏情况下，时间复杂度可能达到 O(n^2)。
@@ -31,7 +31,8 @@
 #include <cassert>    /// 用于 assert
 #include <ctime>      /// 用于初始化随机数生成器
 #include <iostream>   /// 用于输入输出操作
-#include <tuple>      /// 用于从函数返回多个值
+
+#include "./random_pivot_quick_sort.h"
 
 /**
  * @namespace sorting
@@ -57,72 +58,6 @@ void showArray(std::array<int64_t, T> arr) {
     std::cout << std::endl;
 }
 
-/**
- * @brief 获取数组中指定范围内的随机索引
- * @param start 数组的起始索引
- * @param end 数组的结束索引
- * @returns int64_t 返回起始索引到结束索引之间的随机整数
- */
-int64_t getRandomIndex(int64_t start, int64_t end) {
-    srand(time(nullptr));  // 初始化随机数生成器
-    int64_t randomPivotIndex = start + rand() % (end - start + 1);
-    return randomPivotIndex;
-}
-
-/**
- * @brief 快速排序的分区函数
- * @tparam size 数组的大小
- * @param start 数组的起始索引
- * @param end 数组的结束索引
- * @returns std::tuple<int64_t , std::array<int64_t , size>> 返回枢轴元素的索引和排序后的数组
- */
-template <size_t size>
-std::tuple<int64_t, std::array<int64_t, size>> partition(
-    std::array<int64_t, size> arr, int64_t start, int64_t end) {
-    int64_t pivot = arr[end];  // 选择最后一个元素作为枢轴
-    int64_t pInd = start;
-
-    // 遍历数组，按大小对元素进行分区
-    for (int64_t i = start; i < end; i++) {
-        if (arr[i] <= pivot) {
-            std::swap(arr[i], arr[pInd]);  // 交换当前元素和分区索引位置的元素
-            pInd++;
-        }
-    }
-    std::swap(arr[pInd], arr[end]);  // 将枢轴元素放到正确的位置
-    return std::make_tuple(pInd, arr);  // 返回分区索引和排序后的数组
-}
-
-/**
- * @brief 随机枢轴快速排序函数
- * @tparam size 数组的大小
- * @param start 数组的起始索引
- * @param end 数组的结束索引
- * @returns std::array<int64_t , size> 返回排序后的数组
- */
-template <size_t size>
-std::array<int64_t, size> quickSortRP(std::array<int64_t, size> arr,
-                                      int64_t start, int64_t end) {
-    if (start < end) {
-        int64_t randomIndex = getRandomIndex(start, end);
-
-        // 将枢轴与数组的最后一个元素交换
-        std::swap(arr[end], arr[randomIndex]);
-
-        int64_t pivotIndex = 0;
-        // 获取枢轴索引和排序后的数组
-        std::tie(pivotIndex, arr) = partition(arr, start, end);
-
-        // 递归调用对左右子数组进行排序
-        std::array<int64_t, arr.size()> rightSortingLeft =
-            quickSortRP(arr, start, pivotIndex - 1);
-        std::array<int64_t, arr.size()> full_sorted =
-            quickSortRP(rightSortingLeft, pivotIndex + 1, end);
-        arr = full_sorted;
-    }
-    return arr;
-}
-
 /**
  * @brief 用于生成指定大小和范围的无序数组
  * @tparam size 输出数组的大小
@@ -176,6 +111,7 @@ class TestCases {
         testCase_1();
         testCase_2();
         testCase_3();
+        testCase_4();
 
         log("Test Cases over!");
         std::cout << std::endl;
@@ -262,6 +198,28 @@ class TestCases {
         log("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
             "~");
     }
+
+    /**
+     * @brief 连续选取的枢轴下标不能总是相同
+     * @returns void
+     */
+    void testCase_4() {
+        log("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
+            "~");
+        log("Test case 4: Consecutive pivot indices are not all equal.");
+
+        int64_t first = sorting::random_pivot_quick_sort::getRandomIndex(0, 1000);
+        bool all_equal = true;
+        for (int i = 0; i < 20; i++) {
+            int64_t index = sorting::random_pivot_quick_sort::getRandomIndex(0, 1000);
+            assert(0 <= index && index <= 1000);
+            all_equal = all_equal && index == first;
+        }
+        assert(!all_equal);
+        log("[PASS] : TEST CASE 4 PASS!");
+        log("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~"
+            "~");
+    }
 };
 
 /**
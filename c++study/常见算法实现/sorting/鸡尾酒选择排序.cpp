@@ -1,87 +1,40 @@
 // 返回排序后的元素，通过进行鸡尾酒选择排序（Cocktail Selection Sort）
 // 这是一种排序算法，通过同时选择数组中的最小和最大元素，并将其交换到最低和最高的可用位置，
-// 迭代或递归地进行排序
+// 迭代或递归地进行排序，实现见 selection_sort.h
 
 #include <algorithm>
+#include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <vector>
 
-// 迭代版本的鸡尾酒选择排序
-void CocktailSelectionSort(std::vector<int> *vec, int low, int high) {
-    // 当 low <= high 时继续执行排序
-    while (low <= high) {
-        // 初始化最小和最大元素及其索引
-        int minimum = (*vec)[low];
-        int minimumindex = low;
-        int maximum = (*vec)[high];
-        int maximumindex = high;
+#include "./selection_sort.h"
 
-        // 查找最小值和最大值及其索引
-        for (int i = low; i <= high; i++) {
-            if ((*vec)[i] >= maximum) {
-                maximum = (*vec)[i];
-                maximumindex = i;
-            }
-            if ((*vec)[i] <= minimum) {
-                minimum = (*vec)[i];
-                minimumindex = i;
-            }
-        }
+using sorting::CocktailSelectionSort;
+using sorting::CocktailSelectionSort_v2;
 
-        // 如果最小元素和最大元素不是在低位和高位，则交换它们到低位和高位
-        if (low != maximumindex || high != minimumindex) {
-            std::swap((*vec)[low], (*vec)[minimumindex]);
-            std::swap((*vec)[high], (*vec)[maximumindex]);
-        } else {
-            // 如果最小和最大元素已经在正确的位置，则交换低位和高位的元素
-            std::swap((*vec)[low], (*vec)[high]);
-        }
-
-        // 继续处理剩余的部分
-        low++;
-        high--;
+// 自我测试：两个版本的结果都要与 std::sort 相同
+static void test() {
+    for (int n = 0; n <= 40; n++) {
+        std::vector<int> v(n);
+        for (auto &x : v) x = std::rand() % 10;
+        std::vector<int> expected = v;
+        std::sort(expected.begin(), expected.end());
+        std::vector<int> v2 = v;
+        CocktailSelectionSort(&v, 0, n - 1);
+        CocktailSelectionSort_v2(&v2, 0, n - 1);
+        assert(v == expected);
+        assert(v2 == expected);
     }
-}
-
-// 递归版本的鸡尾酒选择排序
-void CocktailSelectionSort_v2(std::vector<int> *vec, int low, int high) {
-    // 递归终止条件
-    if (low >= high)
-        return;
-
-    // 初始化最小和最大元素及其索引
-    int minimum = (*vec)[low];
-    int minimumindex = low;
-    int maximum = (*vec)[high];
-    int maximumindex = high;
-
-    // 查找最小值和最大值及其索引
-    for (int i = low; i <= high; i++) {
-        if ((*vec)[i] >= maximum) {
-            maximum = (*vec)[i];
-            maximumindex = i;
-        }
-        if ((*vec)[i] <= minimum) {
-            minimum = (*vec)[i];
-            minimumindex = i;
-        }
-    }
-
-    // 如果最小元素和最大元素不是在低位和高位，则交换它们到低位和高位
-    if (low != maximumindex || high != minimumindex) {
-        std::swap((*vec)[low], (*vec)[minimumindex]);
-        std::swap((*vec)[high], (*vec)[maximumindex]);
-    } else {
-        // 如果最小和最大元素已经在正确的位置，则交换低位和高位的元素
-        std::swap((*vec)[low], (*vec)[high]);
-    }
-
-    // 递归处理剩余部分
-    CocktailSelectionSort_v2(vec, low + 1, high - 1);
+    std::vector<int> v = {3, 1, 2};  // 最大元素在 low 处
+    CocktailSelectionSort(&v, 0, 2);
+    assert(std::is_sorted(v.begin(), v.end()));
 }
 
 // 主函数，选择使用迭代或递归版本
 int main() {
+    test();
+
     int n;
     std::cout << "请输入元素的数量\n";
     std::cin >> n;
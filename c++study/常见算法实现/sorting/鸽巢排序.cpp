@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief [鸽巢排序算法](https://en.wikipedia.org/wiki/Pigeonhole_sort)的实现
+ * @brief [鸽巢排序算法](https://en.wikipedia.org/wiki/Pigeonhole_sort)的测试，实现见 `pigeonhole_sort.h`
  * @author [Lownish](https://github.com/Lownish)
  * @details
  * 鸽巢排序是一种适用于元素数量和可能的键值数量大致相同的情况的排序算法。
@@ -14,47 +14,7 @@
 #include <cassert>    // 用于 assert
 #include <iostream>   // 用于输入输出操作
 
-/**
- * @namespace sorting
- * @brief 排序算法
- */
-namespace sorting {
-
-/**
- * 使用鸽巢排序算法对大小为 n 的数组进行排序
- * 该函数将通过鸽巢算法排序数组并打印结果
- * @param arr 未排序的数组
- * @returns 排序后的数组
- */
-template <std::size_t N>
-std::array<int, N> pigeonSort(std::array<int, N> arr) {
-    // 找到数组中的最小值和最大值
-    auto min = std::min_element(std::begin(arr), std::end(arr));
-    auto max = std::max_element(std::begin(arr), std::end(arr));
-
-    // Range 表示需要的鸽巢数量
-    int range = *max - *min + 1;
-    int *hole = new int[range]();  // 创建一个数组用于存放鸽巢
-
-    // 将所有数组元素放入鸽巢中
-    for (int i = 0; i < N; i++) {
-        hole[arr[i] - *min] = arr[i];
-    }
-
-    // 从鸽巢中取出元素并存储回原数组
-    int count = 0;
-    for (int i = 0; i < range; i++) {
-        while (hole[i] != '\0') {
-            arr[count] = hole[i];
-            hole[i] = {};  // 清空该位置
-            count++;
-        }
-    }
-    delete[] hole;  // 释放鸽巢空间
-
-    return arr;  // 返回排序后的数组
-}
-}  // namespace sorting
+#include "./pigeonhole_sort.h"
 
 /**
  * 测试函数 1，使用未排序的数组 {8, 3, 2, 7, 4, 6, 8}
@@ -114,6 +74,26 @@ static void test_3() {
     std::cout << "\nPassed\n";
 }
 
+/**
+ * 测试函数 4，包含重复元素、0 和负数的数组 {0, -5, 3, 0, 3, -5, 7, 0}
+ * @returns 无
+ */
+static void test_4() {
+    const int n = 8;
+    std::array<int, n> test_array = {0, -5, 3, 0, 3, -5, 7, 0};
+
+    test_array = sorting::pigeonSort<n>(test_array);
+
+    std::array<int, n> expected = {-5, -5, 0, 0, 0, 3, 3, 7};
+    assert(test_array == expected);  // 重复元素和 0 都不能丢失
+
+    // 打印排序后的数组
+    for (int i = 0; i < n; i++) {
+        std::cout << test_array.at(i) << " ";
+    }
+    std::cout << "\nPassed\n";
+}
+
 /**
  * 主函数
  */
@@ -121,6 +101,7 @@ int main() {
     test_1();  // 执行测试 1
     test_2();  // 执行测试 2
     test_3();  // 执行测试 3
+    test_4();  // 执行测试 4
 
     return 0;  // 程序结束
 }
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @brief Aho–Corasick 多模式匹配的测试与基准测试
+ * @details 自动机本身见 `aho_corasick.h`。
+ *
+ * 用法：`./a.out [关键词个数] [文本字节数]`，默认 50000 个关键词、16 MiB 文本。
+ * 基准测试比较稠密表（不限大小）、双数组两种表示，以及逐个模式扫描全文（按前 100 个模式的耗时外推）。
+ */
+#include <algorithm>  /// 用于 std::sort
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+#include "./aho_corasick.h"
+
+using strings::aho_corasick::automaton;
+using strings::aho_corasick::match;
+using strings::aho_corasick::stream_matcher;
+
+/**
+ * @brief 逐个模式用 std::string::find 找出所有（可以重叠的）出现位置
+ */
+static std::vector<match> brute_force(const std::vector<std::string> &patterns,
+                                      const std::string &text) {
+    std::vector<match> result;
+    for (size_t id = 0; id < patterns.size(); id++) {
+        if (patterns[id].empty()) continue;
+        for (size_t pos = text.find(patterns[id]); pos != std::string::npos;
+             pos = text.find(patterns[id], pos + 1)) {
+            result.push_back({id, pos});
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief 按 (起始位置, 模式编号) 排序，便于比较
+ */
+static std::vector<match> sorted(std::vector<match> v) {
+    std::sort(v.begin(), v.end(), [](const match &a, const match &b) {
+        return a.position != b.position ? a.position < b.position : a.pattern < b.pattern;
+    });
+    return v;
+}
+
+/**
+ * @brief 两种表示、一次扫描与随机分块的流式扫描都与暴力结果一致
+ */
+static void check(const std::vector<std::string> &patterns, const std::string &text,
+                  std::mt19937_64 &rng) {
+    std::vector<match> expected = sorted(brute_force(patterns, text));
+    for (size_t limit : {size_t(-1), size_t(0)}) {
+        automaton ac(patterns, limit);
+        assert(ac.dense() == (limit != 0));
+        assert(sorted(ac.find_all(text)) == expected);
+
+        stream_matcher stream(ac);
+        std::vector<match> streamed;
+        for (size_t pos = 0; pos < text.size();) {
+            size_t len = std::min<size_t>(text.size() - pos, rng() % 8);
+            stream.feed(std::string_view(text).substr(pos, len),
+                        [&](const match &m) { streamed.push_back(m); });
+            pos += len;
+        }
+        assert(stream.offset() == text.size());
+        assert(sorted(streamed) == expected);
+    }
+}
+
+/**
+ * @brief 随机字符串
+ */
+static std::string random_string(size_t n, const std::string &alphabet, std::mt19937_64 &rng) {
+    std::string s(n, ' ');
+    for (auto &ch : s) ch = alphabet[rng() % alphabet.size()];
+    return s;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(15);
+
+    // 第1个测试：经典例子，模式互为前缀/后缀、重叠出现
+    std::vector<std::string> classic = {"he", "she", "his", "hers"};
+    std::vector<match> found = sorted(automaton(classic).find_all("ushers"));
+    assert((found == std::vector<match>{{1, 1}, {0, 2}, {3, 2}}));
+    check(classic, "ushershishehishers", rng);
+    check({"a", "aa", "aaa"}, std::string(20, 'a'), rng);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：重复模式、空模式、没有模式、空文本、任意字节（包括 '\0' 和 0xFF）
+    check({"ab", "", "ab", "b"}, "abab", rng);
+    check({}, "abc", rng);
+    check({"abc"}, "", rng);
+    std::string bytes = {'\0', char(0xFF), 'x', '\0'};
+    check({std::string(1, '\0'), std::string(1, char(0xFF)) + "x", bytes}, bytes + bytes, rng);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：小字母表上的随机模式与文本（大量重叠匹配）
+    for (int round = 0; round < 50; round++) {
+        std::vector<std::string> patterns;
+        size_t count = 1 + rng() % 30;
+        for (size_t i = 0; i < count; i++) {
+            patterns.push_back(random_string(1 + rng() % 6, "abc", rng));
+        }
+        check(patterns, random_string(rng() % 500, "abcd", rng), rng);
+    }
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 在随机单词组成的文本中查找大量关键词（单位 MiB/s）
+ */
+static void benchmark(size_t num_keywords, size_t text_bytes) {
+    std::mt19937_64 rng(7);
+    const std::string letters = "abcdefghijklmnopqrstuvwxyz";
+    std::vector<std::string> keywords;
+    for (size_t i = 0; i < num_keywords; i++) {
+        keywords.push_back(random_string(4 + rng() % 9, letters, rng));
+    }
+    // 文本由随机单词和少量关键词组成，单词之间用空格分隔
+    std::string text;
+    while (text.size() < text_bytes) {
+        text += rng() % 20 == 0 ? keywords[rng() % num_keywords]
+                                : random_string(2 + rng() % 8, letters, rng);
+        text += ' ';
+    }
+    const double mib = double(text.size()) / (1 << 20);
+
+    std::cout << "\n基准测试（" << num_keywords << " 个关键词，" << mib << " MiB 文本）\n";
+    size_t expected = 0;
+    for (size_t limit : {size_t(-1), size_t(0)}) {
+        auto t0 = std::chrono::steady_clock::now();
+        automaton ac(keywords, limit);
+        auto t1 = std::chrono::steady_clock::now();
+        size_t count = 0;
+        ac.scan(text, [&](const match &) { count++; });
+        auto t2 = std::chrono::steady_clock::now();
+        assert(expected == 0 || count == expected);
+        expected = count;
+        std::cout << (ac.dense() ? "稠密表" : "双数组") << ": 构建 "
+                  << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms，扫描 "
+                  << mib / std::chrono::duration<double>(t2 - t1).count() << " MiB/s，状态数 "
+                  << ac.state_count() << "，字母表 " << ac.alphabet_size() << "，内存 "
+                  << double(ac.memory_bytes()) / (1 << 20) << " MiB，匹配 " << count << "\n";
+    }
+
+    const size_t sample = std::min<size_t>(100, num_keywords);
+    auto t0 = std::chrono::steady_clock::now();
+    size_t count = 0;
+    for (size_t i = 0; i < sample; i++) {
+        for (size_t pos = text.find(keywords[i]); pos != std::string::npos;
+             pos = text.find(keywords[i], pos + 1)) {
+            count++;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(t1 - t0).count() * num_keywords / sample;
+    std::cout << "逐个模式 std::string::find: 估计 " << seconds << " s（" << mib / seconds
+              << " MiB/s）\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000,
+              argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 16 << 20);
+    return 0;
+}
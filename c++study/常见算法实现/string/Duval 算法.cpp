@@ -1,65 +1,49 @@
 /**
- * @file duval.cpp
- * @brief 实现 [Duval 算法](https://en.wikipedia.org/wiki/Lyndon_word)
+ * @file
+ * @brief Duval 算法的测试与基准测试
+ * @details 算法本身见 `duval.h`。
  *
- * @details
- * Duval 算法是用于寻找字符串的字典序最小旋转的算法。它基于 Lyndon 字的概念。
- * Lyndon 字定义为在旋转等价类中字典序最小的字符串。旋转等价类是通过旋转字符串得到的所有字符串的集合。
- * 例如，"abc" 的旋转等价类是 {"abc", "bca", "cab"}，其中字典序最小的字符串是 "abc"。
- *
- * Duval 算法通过遍历字符串并找到一个字典序最小的旋转，确保其是一个 Lyndon 字。
- * 这个过程通过比较字符串与其后缀并找到字典序小于字符串的最小后缀来实现。
- * 然后将该后缀添加到结果中，继续对剩余的字符串进行同样的操作。
- * 该算法的时间复杂度是 O(n)，其中 n 是字符串的长度。
- *
- * @note 虽然 Lyndon 字是描述字符串的概念，Duval 算法也可以用于找到任何可比较元素序列的字典序最小循环移位。
- *
- * @author [Amine Ghoussaini](https://github.com/aminegh20)
-*/
+ * 用法：`./a.out [文本字节数]`，默认 64 MiB。
+ */
 
+#include <algorithm> /// 用于 std::max
 #include <array>    /// 用于 std::array
 #include <cassert>  /// 用于 assert
+#include <chrono>   /// 用于基准测试计时
 #include <cstddef>  /// 用于 std::size_t
+#include <cstdlib>  /// 用于 std::strtoull
 #include <deque>    /// 用于 std::deque
 #include <iostream> /// 用于 std::cout 和 std::endl
+#include <random>   /// 用于 std::mt19937_64
 #include <string>   /// 用于 std::string
+#include <string_view> /// 用于 std::string_view
 #include <vector>   /// 用于 std::vector
 
+#include "./duval.h"
+
 /**
- * @brief 字符串操作算法
- * @namespace
- */
-namespace string {
-/**
- * @brief 查找序列的字典序最小循环移位
- * @tparam T 序列的类型
- * @param s 序列
- * @returns 序列的字典序最小循环移位的 0 索引位置
+ * @brief 按定义检查 Lyndon 分解：各因子拼起来是原文、都是 Lyndon 字、且不增
  */
-template <typename T>
-size_t duval(const T& s) {
-    size_t n = s.size();  // 获取序列的长度
-    size_t i = 0, ans = 0;  // 初始化 i 和 ans 为 0
-    while (i < n) {  // 遍历序列
-        ans = i;  // 设置当前最小循环移位的位置
-        size_t j = i + 1, k = i;
-        while (j < (n + n) && s[j % n] >= s[k % n]) {  // 比较序列中的后缀
-            if (s[k % n] < s[j % n]) {  // 如果当前字符小于下一个字符，更新 k
-                k = i;
-            } else {
-                k++;  // 否则，k 向后移动
-            }
-            j++;  // 移动 j
-        }
-        while (i <= k) {  // 更新 i 的值
-            i += j - k;  // 通过 j 和 k 的差值调整 i
-        }
+static void check_factorization(const std::string& s) {
+    std::string_view text(s);
+    std::vector<std::string_view> factors;
+    size_t pos = 0;
+    string::lyndon_factorization range(text);
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        assert(it.position() == pos);
+        assert((*it).data() == s.data() + pos);  // 指向原文本，没有复制
+        factors.push_back(*it);
+        pos += (*it).size();
+    }
+    assert(pos == s.size());
+    for (size_t i = 0; i < factors.size(); i++) {
+        auto w = factors[i];
+        assert(!w.empty());
+        for (size_t k = 1; k < w.size(); k++) assert(w < w.substr(k));  // 严格小于所有真后缀
+        if (i > 0) assert(factors[i - 1] >= w);
     }
-    return ans;  // 返回字典序最小的循环移位的索引
 }
 
-}  // namespace string
-
 /**
  * @brief 自测函数实现
  * 返回 void
@@ -95,14 +79,55 @@ static void test() {
     std::vector<int> v2 = {5, 2, 1, 3, -4};
     assert(duval(v2) == 4);  // 检查最小循环移位位置是否为 4
 
+    // 测试 8：Lyndon 分解
+    std::vector<std::string_view> factors;
+    for (std::string_view w : lyndon_factorization("banana")) factors.push_back(w);
+    assert((factors == std::vector<std::string_view>{"b", "an", "an", "a"}));
+    factors.clear();
+    for (std::string_view w : lyndon_factorization("abaabaabaab")) factors.push_back(w);
+    assert((factors == std::vector<std::string_view>{"ab", "aab", "aab", "aab"}));
+    assert(lyndon_factorization("").begin() == lyndon_factorization("").end());
+
+    // 测试 9：随机字符串（含大于 0x7f 的字节）
+    std::mt19937_64 rng(21);
+    for (int round = 0; round < 500; round++) {
+        std::string s(rng() % 80, ' ');
+        for (auto& ch : s) ch = "ab\xff"[rng() % (round % 2 ? 2 : 3)];
+        check_factorization(s);
+    }
+
     std::cout << "所有测试都通过了!" << std::endl;  // 所有测试通过后的输出
 }
 
+/**
+ * @brief 惰性地分解一段大文本，只统计因子个数和最长因子
+ */
+static void benchmark(size_t bytes) {
+    std::mt19937_64 rng(2121);
+    std::string text(bytes, ' ');
+    for (auto& ch : text) ch = "ab"[rng() % 2];
+    auto t0 = std::chrono::steady_clock::now();
+    size_t count = 0, longest = 0;
+    for (std::string_view w : string::lyndon_factorization(text)) {
+        count++;
+        longest = std::max(longest, w.size());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    size_t rotation = string::duval(text);
+    auto t2 = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    std::cout << "\n基准测试（" << double(bytes) / (1 << 20) << " MiB 文本）\nLyndon 分解: " << count
+              << " 个因子，最长 " << longest << "，" << ms << " ms（" << bytes / ms / 1e3
+              << " MB/s，无额外内存）；最小循环移位 " << rotation << "："
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+}
+
 /**
  * @brief 主函数
  * @returns 0 程序退出时返回 0
  */
-int main() {
+int main(int argc, char** argv) {
     test();  // 运行自测函数
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64 << 20);
     return 0;
 }
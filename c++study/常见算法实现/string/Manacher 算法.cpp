@@ -1,114 +1,66 @@
 /**
  * @file
- * @brief 实现 [Manacher 算法](https://en.wikipedia.org/wiki/Longest_palindromic_substring) 用于在字符串中查找最长回文子串
- * @details
- * Manacher 算法用于在 O(n) 时间内找到字符串中的最长回文子串。它利用了回文串的特性，即回文串的前半部分与后半部分对称，因此如果前半部分是回文串，那么后半部分也是回文串。
- * @author [Riti Kumari](https://github.com/riti2409)
+ * @brief Manacher 算法的测试与基准测试
+ * @details 算法本身见 `manacher.h`。
+ *
+ * 用法：`./a.out [文本字节数]`，默认 16 MiB。
+ * 基准测试与插入分隔符、复制整个文本的写法比较。
  */
 
-#include <cassert>   /// 用于断言
-#include <iostream>  /// 用于输入输出操作
-#include <vector>    /// 用于 std::vector 容器
-#ifdef _MSC_VER
-#include <string>  /// 对于 MS Visual C++，需要包含 <string>
-#else
-#include <cstring>  /// 对于其他编译器，使用 <cstring>
-#endif
+#include <algorithm>  /// 用于 std::min
+#include <cassert>    /// 用于断言
+#include <chrono>     /// 用于基准测试计时
+#include <cstdint>    /// 用于 uint64_t
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector 容器
+
+#include "./manacher.h"
 
 /**
- * @namespace strings
- * @brief 字符串相关算法
- */
-namespace strings {
-/**
- * @namespace manacher
- * @brief 实现 [Manacher 算法](https://en.wikipedia.org/wiki/Longest_palindromic_substring) 的函数
- */
-namespace manacher {
-/**
- * @brief 实现 Manacher 算法
- * @param prototype 输入字符串，在该字符串中查找回文子串
- * @returns 返回最长的回文子串
+ * @brief 暴力检查每个子串，与回文半径数组的各种查询比较
  */
-std::string manacher(const std::string &prototype) {
-    if (prototype.size() > 0) {
-        // 在输入字符串之间插入特殊字符（#），以处理偶数长度回文的情况
-        std::string stuffed_string = "";
-        for (auto str : prototype) {
-            stuffed_string += str;
-            stuffed_string += "#";
-        }
-        stuffed_string = "@#" + stuffed_string + "&";  // 在字符串两端添加特殊字符以方便边界处理
-
-        std::vector<uint64_t> palindrome_max_half_length(
-            stuffed_string.size(),
-            0);  // 用于存储每个字符为中心的最大回文半长度
-
-        uint64_t bigger_center =
-            0;  // 用于记录回文的中心位置（最右侧的回文中心）
-
-        uint64_t right = 0;  // 用于记录回文从 center 到最右边的最远距离
-
-        // i 是考虑作为回文中心的字符索引
-        for (uint64_t i = 1; i < stuffed_string.size() - 1; i++) {
-            if (i < right) {  // 如果 i 在当前最大回文范围内，利用对称性
-                uint64_t opposite_to_i =
-                    2 * bigger_center - i;  // 对称位置
-
-                // 选择当前回文中心和对称位置的回文半长度中的较小者作为 i 的最初半长度
-                palindrome_max_half_length[i] = std::min(
-                    palindrome_max_half_length[opposite_to_i], right - i);
-            }
-
-            // 尝试扩展回文串，直到不再匹配
-            while (stuffed_string[i + (palindrome_max_half_length[i] + 1)] == 
-                   stuffed_string[i - (palindrome_max_half_length[i] + 1)]) {
-                palindrome_max_half_length[i]++;
-            }
-
-            // 如果当前回文串超出了 right 位置，更新 center 和 right
-            if (i + palindrome_max_half_length[i] > right) {
-                bigger_center = i;
-                right = i + palindrome_max_half_length[i];
-            }
-        }
-
-        // 提取最长回文子串
-        uint64_t half_length = 0;   // 最长回文的半长度
-        uint64_t center_index = 0;  // 最长回文中心的索引
-
-        for (uint64_t i = 1; i < stuffed_string.size() - 1; i++) {
-            if (palindrome_max_half_length[i] > half_length) {
-                half_length = palindrome_max_half_length[i];
-                center_index = i;
-            }
+static void check(const std::string &s) {
+    const size_t n = s.size();
+    strings::manacher::palindromes p(s);
+    auto is_pal = [&](size_t pos, size_t len) {
+        for (size_t x = 0; x < len / 2; x++) {
+            if (s[pos + x] != s[pos + len - 1 - x]) return false;
         }
-
-        std::string palindromic_substring =
-            "";  // 用于存储最终的回文子串
-
-        if (half_length > 0) {
-            // 通过中心索引和半长度计算回文串的起始和结束位置
-            uint64_t start = center_index - half_length + 1;
-            uint64_t end = center_index + half_length - 1;
-            for (uint64_t index = start; index <= end; index += 2) {  // 每两个字符之间跳一步
-                palindromic_substring += stuffed_string[index];
+        return true;
+    };
+    uint64_t total = 0;
+    std::vector<uint64_t> starts(n, 0), ends(n, 0);
+    size_t longest = 0;
+    for (size_t pos = 0; pos < n; pos++) {
+        for (size_t len = 1; pos + len <= n; len++) {
+            bool pal = is_pal(pos, len);
+            assert(p.is_palindrome(pos, len) == pal);
+            if (pal) {
+                total++;
+                starts[pos]++;
+                ends[pos + len - 1]++;
+                longest = std::max(longest, len);
             }
-        } else {
-            // 如果没有回文子串，返回任意一个字符作为回文子串
-            palindromic_substring = prototype[0];
         }
-        return palindromic_substring;
-
-    } else {
-        // 处理空字符串的情况
-        return "";
     }
+    for (size_t i = 0; i < n; i++) {
+        assert(is_pal(i + 1 - p.odd()[i], 2 * p.odd()[i] - 1));
+        assert(i < p.odd()[i] || i + p.odd()[i] >= n ||
+               s[i - p.odd()[i]] != s[i + p.odd()[i]]);
+        assert(is_pal(i - p.even()[i], 2 * p.even()[i]));
+        assert(i < p.even()[i] + 1 || i + p.even()[i] >= n ||
+               s[i - p.even()[i] - 1] != s[i + p.even()[i]]);
+    }
+    assert(p.count() == total);
+    assert(p.starts_per_position() == starts);
+    assert(p.ends_per_position() == ends);
+    assert(p.longest().size() == longest);
+    assert(is_pal(p.longest().data() - s.data(), p.longest().size()));
 }
 
-}  // namespace manacher
-}  // namespace strings
-
 /**
  * @brief 自测试函数
  * @returns void
@@ -127,14 +79,72 @@ static void test() {
     assert(strings::manacher::manacher("xy") == "x");  // 无回文
     assert(strings::manacher::manacher("abced") == "a");  // 无回文
 
+    // 回文半径数组与暴力比较
+    strings::manacher::palindromes aaa("aaa");
+    assert((aaa.odd() == std::vector<uint32_t>{1, 2, 1}));
+    assert((aaa.even() == std::vector<uint32_t>{0, 1, 1}));
+    assert(aaa.count() == 6);
+    std::mt19937_64 rng(20);
+    for (int round = 0; round < 300; round++) {
+        std::string s(rng() % 60, ' ');
+        for (auto &ch : s) ch = "ab\x80"[rng() % (round % 2 ? 2 : 3)];
+        check(s);
+    }
+
     std::cout << "所有测试已通过！" << std::endl;
 }
 
+/**
+ * @brief 插入分隔符的写法（逐字节复制文本，半径数组长 2n + 3），作为对照
+ */
+static uint64_t stuffed_count(const std::string &s) {
+    std::string t = "@#";
+    for (char ch : s) {
+        t += ch;
+        t += '#';
+    }
+    t += '&';
+    std::vector<uint64_t> radius(t.size(), 0);
+    uint64_t center = 0, right = 0, total = 0;
+    for (uint64_t i = 1; i + 1 < t.size(); i++) {
+        if (i < right) radius[i] = std::min(radius[2 * center - i], right - i);
+        while (t[i + radius[i] + 1] == t[i - radius[i] - 1]) radius[i]++;
+        if (i + radius[i] > right) {
+            center = i;
+            right = i + radius[i];
+        }
+        total += (radius[i] + 1) / 2;  // 以该位置为中心的回文个数
+    }
+    return total;
+}
+
+/**
+ * @brief 在随机文本上统计回文子串个数
+ */
+static void benchmark(size_t bytes) {
+    std::mt19937_64 rng(2020);
+    std::string text(bytes, ' ');
+    for (auto &ch : text) ch = "ab"[rng() % 2];  // 小字母表，回文多
+    std::cout << "\n基准测试（" << double(bytes) / (1 << 20) << " MiB 文本）\n";
+    auto t0 = std::chrono::steady_clock::now();
+    strings::manacher::palindromes p(text);
+    uint64_t total = p.count();
+    auto t1 = std::chrono::steady_clock::now();
+    uint64_t expected = stuffed_count(text);
+    auto t2 = std::chrono::steady_clock::now();
+    assert(total == expected);
+    std::cout << "回文子串 " << total << " 个；奇偶半径数组: "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count()
+              << " ms，插入分隔符: " << std::chrono::duration<double, std::milli>(t2 - t1).count()
+              << " ms\n";
+}
+
 /**
  * @brief 主函数
  * @returns 0 程序退出时返回 0
  */
-int main() {
+int main(int argc, char **argv) {
     test();  // 运行自测试
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16 << 20);
     return 0;
 }
@@ -1,6 +1,8 @@
 /**
  * \file
  * \brief [Rabin-Karp 算法](https://en.wikipedia.org/wiki/Rabin–Karp_algorithm)，用于在文本中查找模式，时间复杂度为 O(n + m)
+ *
+ * \note 模 2^61-1 的滚动哈希（O(1) 子串哈希、等长多模式查找）见 `rolling_hash.h`。
  */
 #include <cassert>
 #include <cmath>
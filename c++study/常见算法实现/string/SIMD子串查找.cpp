@@ -0,0 +1,189 @@
+/**
+ * @file
+ * @brief 首尾字节过滤的 SIMD 子串查找与流式查找的测试，以及与 KMP、Boyer–Moore、Horspool 的基准测试
+ * @details 算法本身见 `simd_search.h`，对照的三种算法分别见 `kmp.h`、`boyer_moore.h` 和 `horspool.h`。
+ *
+ * 用法：`./a.out [文本字节数]`，默认 32 MiB。用 `-mavx2` 编译才会测试 AVX2 过滤器。
+ * 基准测试的文本是随机小写字母，模式只出现在文本末尾，因此每种算法都要扫描整个文本。
+ */
+#include <algorithm>  /// 用于 std::min
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+#include "./boyer_moore.h"
+#include "./horspool.h"
+#include "./kmp.h"
+#include "./simd_search.h"
+
+namespace ss = strings::simd_search;
+
+/**
+ * @brief 用 std::string::find 找出所有（可以重叠的）出现位置
+ */
+static std::vector<size_t> brute_force(const std::string &text, const std::string &pattern) {
+    std::vector<size_t> result;
+    if (pattern.empty()) return result;
+    for (size_t pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + 1)) {
+        result.push_back(pos);
+    }
+    return result;
+}
+
+/**
+ * @brief 用指定的过滤器检查 find、find_all 与随机分块的流式查找
+ */
+template <typename Filter>
+static void check(const std::string &text, const std::string &pattern, std::mt19937_64 &rng) {
+    std::vector<size_t> expected = brute_force(text, pattern);
+    assert(ss::find_all<Filter>(text, pattern) == expected);
+    assert(ss::find<Filter>(text, pattern) == (expected.empty() ? ss::npos : expected[0]));
+    size_t from = rng() % (text.size() + 2);
+    auto it = std::lower_bound(expected.begin(), expected.end(), from);
+    assert(ss::find<Filter>(text, pattern, from) == (it == expected.end() ? ss::npos : *it));
+
+    ss::stream_searcher<Filter> stream(pattern);
+    std::vector<size_t> streamed;
+    for (size_t pos = 0; pos < text.size();) {
+        // 块的大小有时小于模式长度，有时远大于向量宽度
+        size_t len = std::min<size_t>(text.size() - pos, rng() % 2 ? rng() % 4 : rng() % 100);
+        stream.feed(std::string_view(text).substr(pos, len),
+                    [&](size_t p) { streamed.push_back(p); });
+        pos += len;
+    }
+    assert(stream.offset() == text.size());
+    assert(streamed == expected);
+}
+
+/**
+ * @brief 所有可用的过滤器各检查一遍
+ */
+static void check_all(const std::string &text, const std::string &pattern, std::mt19937_64 &rng) {
+    check<ss::swar_filter>(text, pattern, rng);
+#if defined(__SSE2__)
+    check<ss::sse2_filter>(text, pattern, rng);
+#endif
+#if defined(__AVX2__)
+    check<ss::avx2_filter>(text, pattern, rng);
+#endif
+}
+
+/**
+ * @brief 随机字符串
+ */
+static std::string random_string(size_t n, const std::string &alphabet, std::mt19937_64 &rng) {
+    std::string s(n, ' ');
+    for (auto &ch : s) ch = alphabet[rng() % alphabet.size()];
+    return s;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(16);
+
+    // 第1个测试：简单例子、重叠出现、空模式、空文本、模式比文本长
+    assert(ss::find("helloWorld", "World") == 5);
+    assert(ss::find("abcabc", "bca") == 1);
+    assert(ss::find("abc", "") == ss::npos);
+    assert(ss::find("", "a") == ss::npos);
+    assert(ss::find("abc", "abcd") == ss::npos);
+    assert(ss::find("abc", "c", 4) == ss::npos);
+    assert((ss::find_all(std::string(40, 'a'), "aaa").size() == 38));
+    check_all("ushershishehishers", "he", rng);
+    check_all(std::string(100, 'a'), "aaaa", rng);
+    check_all("", "x", rng);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：任意字节（包括 '\0' 和 0x80 以上，SWAR 的按字节比较不能跨字节进位）
+    std::string bytes;
+    for (int i = 0; i < 300; i++) bytes += char(rng() % 3 == 0 ? 0 : 0x7F + rng() % 3);
+    for (size_t m : {1, 2, 3, 9}) check_all(bytes, bytes.substr(100, m), rng);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：小字母表上的随机文本，模式长度从 1 到超过向量宽度
+    for (int round = 0; round < 300; round++) {
+        std::string text = random_string(rng() % 400, "ab", rng);
+        size_t m = 1 + rng() % 70;
+        std::string pattern = rng() % 2 && text.size() >= m
+                                  ? text.substr(rng() % (text.size() - m + 1), m)
+                                  : random_string(m, "ab", rng);
+        check_all(text, pattern, rng);
+    }
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 在随机文本中查找只出现在末尾的模式（单位 MiB/s）
+ */
+static void benchmark(size_t text_bytes) {
+    std::mt19937_64 rng(61);
+    const std::string letters = "abcdefghijklmnopqrstuvwxyz";
+    const double mib = double(text_bytes) / (1 << 20);
+
+    for (size_t m : {4, 16, 64}) {
+        std::string pattern = random_string(m, letters, rng);
+        std::string text = random_string(text_bytes, letters, rng);
+        // 保证模式在前面没有出现过
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern)) {
+            text[pos] = pattern[0] == 'a' ? 'b' : 'a';
+        }
+        text.replace(text.size() - m, m, pattern);
+        const size_t expected = text.size() - m;
+
+        auto time = [&](const char *name, auto search) {
+            auto t0 = std::chrono::steady_clock::now();
+            size_t found = search();
+            auto t1 = std::chrono::steady_clock::now();
+            assert(found == expected);
+            (void)found;
+            std::cout << name << ": " << mib / std::chrono::duration<double>(t1 - t0).count()
+                      << "\n";
+        };
+
+        std::cout << "\n模式长度 " << m << "（" << mib << " MiB 文本，单位 MiB/s）\n";
+        time("KMP", [&] { return string_search::kmp(pattern, text); });
+        time("Boyer-Moore", [&] {
+            strings::boyer_moore::pattern bm;
+            strings::boyer_moore::init_pattern(pattern, bm);
+            return strings::boyer_moore::search(text, bm).at(0);
+        });
+        time("Horspool", [&] {
+            return strings::horspool::horspool(text, pattern) ? expected : ss::npos;
+        });
+        time("std::string::find", [&] { return text.find(pattern); });
+        time("simd_search（SWAR）", [&] { return ss::find<ss::swar_filter>(text, pattern); });
+#if defined(__SSE2__)
+        time("simd_search（SSE2）", [&] { return ss::find<ss::sse2_filter>(text, pattern); });
+#endif
+#if defined(__AVX2__)
+        time("simd_search（AVX2）", [&] { return ss::find<ss::avx2_filter>(text, pattern); });
+#endif
+        time("stream_searcher（64 KiB 一块）", [&] {
+            ss::stream_searcher<> stream(pattern);
+            size_t found = ss::npos;
+            for (size_t pos = 0; pos < text.size(); pos += 1 << 16) {
+                stream.feed(std::string_view(text).substr(pos, 1 << 16),
+                            [&](size_t p) { found = std::min(found, p); });
+            }
+            return found;
+        });
+    }
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 32 << 20);
+    return 0;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file aho_corasick.h
+ * @brief [Aho–Corasick 自动机](https://en.wikipedia.org/wiki/Aho%E2%80%93Corasick_algorithm)：
+ * 一遍扫描文本，找出一组模式的所有出现位置
+ * @details
+ * `KMP算法.cpp`、`Boyer-Moore 字符串搜索算法.cpp`、`Horspool 算法.cpp` 和 `Rabin-Karp 算法.cpp`
+ * 每次只找一个模式，k 个模式就要扫描 k 遍文本。这里的自动机：
+ *
+ * 1. 构建：先像 `数据结构/字典树.cpp` 的 `Trie::insert` 一样把所有模式插入字典树
+ *    （逐字符向下走，缺少的孩子就新建，末尾结点记下模式编号）。字典树换成按下标存放的结点数组、
+ *    稀疏的孩子列表，字母表也不限于小写字母，而是任意字节；然后按 BFS 顺序求失配指针，
+ *    以及指向"最近的、有模式结尾的后缀结点"的输出链接；
+ * 2. 字母表压缩：只有在模式中出现过的字节才有自己的编号，其余字节共用编号 0（从任何状态都回到根）；
+ * 3. 两种紧凑表示，按转移表的大小自动选择：
+ *    - 稠密表：结点数 × 字母表大小不超过 dense_limit 字节时，把失配指针预先展开成完整的 DFA，
+ *      每个输入字节只查一次表。表放不进缓存时每个字节都可能是一次缓存未命中，
+ *      反而比双数组慢，所以默认上限只有 4 MiB；
+ *    - 双数组（double-array trie）：只存字典树本身的转移，`check[base[s] + c] == s` 时
+ *      s 经过字符 c 到达 base[s] + c，否则沿失配指针回退，均摊每字节 \f$O(1)\f$ 次转移；
+ * 4. `stream_matcher` 保存当前状态和已经读过的字节数，文本可以分块送入，跨块的匹配照样报告。
+ *
+ * 匹配报告为 (模式编号, 在整个文本中的起始位置)，按结束位置的顺序给出；空模式永远不会匹配。
+ * 构建 \f$O(L \sigma)\f$，L 为模式总长，σ 为压缩后的字母表大小；扫描 \f$O(n + z)\f$，z 为匹配数。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::sort, std::max
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint8_t, uint32_t
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <utility>      /// 用于 std::pair
+#include <vector>       /// 用于 std::vector
+
+/**
+ * @namespace strings
+ * @brief 字符串算法
+ */
+namespace strings {
+/**
+ * @namespace aho_corasick
+ * @brief Aho–Corasick 多模式匹配
+ */
+namespace aho_corasick {
+constexpr uint32_t kNone = uint32_t(-1);        ///< 空状态/空链表
+constexpr size_t kDefaultDenseLimit = 4 << 20;  ///< 稠密表的默认大小上限（字节）
+
+/**
+ * @brief 一次匹配
+ */
+struct match {
+    size_t pattern;   ///< 模式编号（在构造时的 patterns 中的下标）
+    size_t position;  ///< 在文本中的起始位置
+    bool operator==(const match &other) const {
+        return pattern == other.pattern && position == other.position;
+    }
+};
+
+/**
+ * @brief Aho–Corasick 自动机（构建后只读，可以被多个 stream_matcher 共享）
+ */
+class automaton {
+ public:
+    /**
+     * @param patterns 模式集合，可以有重复
+     * @param dense_limit 稠密转移表的大小上限（字节），超过时使用双数组；为 0 时总是使用双数组
+     */
+    explicit automaton(const std::vector<std::string> &patterns,
+                       size_t dense_limit = kDefaultDenseLimit) {
+        for (const auto &p : patterns) lengths_.push_back(p.size());
+        build_trie(patterns);
+        compute_links();
+        if (dense_limit > 0 && trie_.size() * classes_ * sizeof(uint32_t) <= dense_limit) {
+            build_dense();
+        } else {
+            build_double_array();
+        }
+        std::vector<trie_node>().swap(trie_);
+    }
+
+    /** @brief 模式个数 */
+    size_t pattern_count() const { return lengths_.size(); }
+
+    /** @brief 状态数（双数组表示时包括空闲的槽位） */
+    size_t state_count() const { return fail_.size(); }
+
+    /** @brief 压缩后的字母表大小（含编号 0） */
+    size_t alphabet_size() const { return classes_; }
+
+    /** @brief 是否使用稠密转移表 */
+    bool dense() const { return dense_; }
+
+    /** @brief 自动机占用的字节数 */
+    size_t memory_bytes() const {
+        return sizeof(class_) + (delta_.size() + base_.size() + check_.size() + fail_.size() +
+                                 dict_.size() + output_.size() + next_output_.size()) *
+                                    sizeof(uint32_t) +
+               lengths_.size() * sizeof(size_t);
+    }
+
+    /** @brief 初始状态 */
+    uint32_t root() const { return 0; }
+
+    /**
+     * @brief 状态 s 读入字节 c 之后的状态
+     */
+    uint32_t next(uint32_t s, unsigned char c) const {
+        uint32_t cls = class_[c];
+        if (dense_) {
+            return delta_[size_t(s) * classes_ + cls];
+        }
+        if (cls == 0) {
+            return 0;
+        }
+        for (;;) {
+            uint32_t t = base_[s] + cls;
+            if (t < check_.size() && check_[t] == s) {
+                return t;
+            }
+            if (s == 0) {
+                return 0;
+            }
+            s = fail_[s];
+        }
+    }
+
+    /**
+     * @brief 对所有在状态 s 处结束的模式调用 f(模式编号)
+     */
+    template <typename F>
+    void for_each_output(uint32_t s, F f) const {
+        for (uint32_t v = output_[s] != kNone ? s : dict_[s]; v != kNone; v = dict_[v]) {
+            for (uint32_t p = output_[v]; p != kNone; p = next_output_[p]) f(size_t(p));
+        }
+    }
+
+    /** @brief 模式的长度 */
+    size_t pattern_length(size_t pattern) const { return lengths_[pattern]; }
+
+    /**
+     * @brief 扫描整段文本，对每个匹配调用 on_match(match)
+     */
+    template <typename F>
+    void scan(std::string_view text, F on_match) const {
+        uint32_t s = root();
+        for (size_t i = 0; i < text.size(); i++) {
+            s = next(s, static_cast<unsigned char>(text[i]));
+            if (has_match(s)) {
+                for_each_output(s, [&](size_t p) { on_match(match{p, i + 1 - lengths_[p]}); });
+            }
+        }
+    }
+
+    /**
+     * @brief 找出整段文本中的所有匹配
+     */
+    std::vector<match> find_all(std::string_view text) const {
+        std::vector<match> result;
+        scan(text, [&](const match &m) { result.push_back(m); });
+        return result;
+    }
+
+    /** @brief 状态 s 处是否有模式结束（包括经由输出链接的后缀） */
+    bool has_match(uint32_t s) const { return output_[s] != kNone || dict_[s] != kNone; }
+
+ private:
+    /** @brief 构建期的字典树结点 */
+    struct trie_node {
+        std::vector<std::pair<uint32_t, uint32_t>> children;  ///< (字符编号, 孩子)，按字符编号排序
+        uint32_t output = kNone;                               ///< 在这里结束的第一个模式
+    };
+
+    std::vector<trie_node> trie_;  ///< 只在构建期间使用
+    std::vector<uint32_t> bfs_;    ///< 构建期间的 BFS 顺序
+
+    uint32_t class_[256] = {};
+    size_t classes_ = 1;
+    bool dense_ = false;
+    std::vector<uint32_t> delta_;        ///< 稠密表：delta_[s * classes_ + c]
+    std::vector<uint32_t> base_, check_;  ///< 双数组
+    std::vector<uint32_t> fail_;          ///< 失配指针
+    std::vector<uint32_t> dict_;          ///< 输出链接：最近的有模式结束的真后缀状态
+    std::vector<uint32_t> output_;        ///< 在该状态结束的第一个模式
+    std::vector<uint32_t> next_output_;   ///< 在同一状态结束的下一个（重复的）模式
+    std::vector<size_t> lengths_;
+
+    static uint32_t child(const trie_node &node, uint32_t c) {
+        for (const auto &e : node.children) {
+            if (e.first == c) return e.second;
+        }
+        return kNone;
+    }
+
+    void build_trie(const std::vector<std::string> &patterns) {
+        for (const auto &p : patterns) {
+            for (char ch : p) {
+                auto &cls = class_[static_cast<unsigned char>(ch)];
+                if (cls == 0) cls = uint32_t(classes_++);
+            }
+        }
+        trie_.emplace_back();
+        next_output_.assign(patterns.size(), kNone);
+        for (size_t id = 0; id < patterns.size(); id++) {
+            if (patterns[id].empty()) {
+                continue;
+            }
+            uint32_t cur = 0;
+            for (char ch : patterns[id]) {
+                uint32_t c = class_[static_cast<unsigned char>(ch)];
+                uint32_t next = child(trie_[cur], c);
+                if (next == kNone) {
+                    next = uint32_t(trie_.size());
+                    trie_[cur].children.emplace_back(c, next);
+                    trie_.emplace_back();
+                }
+                cur = next;
+            }
+            // 重复的模式挂在同一个结点的链表上
+            next_output_[id] = trie_[cur].output;
+            trie_[cur].output = uint32_t(id);
+        }
+        for (auto &node : trie_) std::sort(node.children.begin(), node.children.end());
+    }
+
+    /** @brief 按 BFS 顺序求失配指针和输出链接（此时仍按字典树结点编号） */
+    void compute_links() {
+        const size_t n = trie_.size();
+        fail_.assign(n, 0);
+        dict_.assign(n, kNone);
+        bfs_.assign(1, 0);
+        for (size_t head = 0; head < bfs_.size(); head++) {
+            uint32_t u = bfs_[head];
+            for (const auto &e : trie_[u].children) {
+                uint32_t v = e.second;
+                uint32_t f = kNone;
+                if (u != 0) {
+                    for (uint32_t w = fail_[u];; w = fail_[w]) {
+                        f = child(trie_[w], e.first);
+                        if (f != kNone || w == 0) break;
+                    }
+                }
+                fail_[v] = f == kNone ? 0 : f;
+                dict_[v] = trie_[fail_[v]].output != kNone ? fail_[v] : dict_[fail_[v]];
+                bfs_.push_back(v);
+            }
+        }
+        output_.resize(n);
+        for (size_t v = 0; v < n; v++) output_[v] = trie_[v].output;
+    }
+
+    /** @brief 展开成完整的 DFA，结点按 BFS 顺序重新编号，使浅层的热点状态集中在表的前部 */
+    void build_dense() {
+        dense_ = true;
+        const size_t n = trie_.size();
+        std::vector<uint32_t> rank(n);
+        for (size_t i = 0; i < n; i++) rank[bfs_[i]] = uint32_t(i);
+        delta_.assign(n * classes_, 0);
+        // 失配状态更浅，按 BFS 顺序处理时它的行已经完整：先复制，再用字典树的转移覆盖
+        for (size_t i = 0; i < n; i++) {
+            uint32_t u = bfs_[i];
+            uint32_t *row = &delta_[i * classes_];
+            if (i != 0) {
+                const uint32_t *fail_row = &delta_[size_t(rank[fail_[u]]) * classes_];
+                std::copy(fail_row, fail_row + classes_, row);
+            }
+            for (const auto &e : trie_[u].children) row[e.first] = rank[e.second];
+        }
+        renumber(rank, n);
+    }
+
+    /** @brief 把字典树放进双数组，并把失配指针等按新的槽位编号重排 */
+    void build_double_array() {
+        constexpr uint8_t kMaxTries = 64;  // 一个空闲槽位被试过这么多次仍放不下，就不再尝试
+        const size_t n = trie_.size();
+        std::vector<uint32_t> slot(n, kNone);
+        std::vector<uint32_t> base(n, 0);
+
+        // 空闲槽位组成双向循环链表，槽位 0（根）兼作链表头
+        std::vector<uint8_t> used(1, 1), tries(1, 0);
+        std::vector<uint32_t> next_free(1, 0), prev_free(1, 0);
+        auto extend = [&](size_t size) {
+            for (size_t t = used.size(); t < size; t++) {
+                used.push_back(0);
+                tries.push_back(0);
+                next_free.push_back(0);
+                prev_free.push_back(prev_free[0]);
+                next_free[prev_free[0]] = uint32_t(t);
+                prev_free[0] = uint32_t(t);
+            }
+        };
+        auto take = [&](size_t t) {
+            used[t] = 1;
+            next_free[prev_free[t]] = next_free[t];
+            prev_free[next_free[t]] = prev_free[t];
+        };
+
+        slot[0] = 0;
+        for (uint32_t u : bfs_) {
+            const auto &children = trie_[u].children;
+            if (children.empty()) {
+                continue;
+            }
+            // 沿空闲链表找第一个能放下所有孩子的 base（孩子的字符编号至少为 1）
+            const size_t lowest = children.front().first, highest = children.back().first;
+            if (next_free[0] == 0) extend(used.size() + classes_);
+            size_t p = next_free[0], b = 0;
+            for (;;) {
+                // 只考虑 p > lowest 的空闲槽位，这样 b = p - lowest 至少为 1，不会发生无符号回绕
+                bool fits = p > lowest;
+                if (fits) {
+                    b = p - lowest;
+                    extend(b + highest + 1);
+                    for (const auto &e : children) {
+                        if (used[b + e.first]) {
+                            fits = false;
+                            break;
+                        }
+                    }
+                }
+                if (fits) break;
+                size_t next = next_free[p];
+                if (p > lowest && ++tries[p] >= kMaxTries) take(p);
+                if (next == 0) {
+                    next = used.size();
+                    extend(next + classes_);
+                }
+                p = next;
+            }
+            base[u] = uint32_t(b);
+            for (const auto &e : children) {
+                take(b + e.first);
+                slot[e.second] = uint32_t(b + e.first);
+            }
+        }
+        base_.assign(used.size(), 0);
+        check_.assign(used.size(), kNone);
+        for (size_t v = 0; v < n; v++) {
+            base_[slot[v]] = base[v];
+            for (const auto &e : trie_[v].children) check_[slot[e.second]] = slot[v];
+        }
+        renumber(slot, used.size());
+    }
+
+    /** @brief 把失配指针、输出链接和输出按 id[旧编号] = 新编号 重排到 size 个状态 */
+    void renumber(const std::vector<uint32_t> &id, size_t size) {
+        std::vector<uint32_t> fail(size, 0), dict(size, kNone), output(size, kNone);
+        for (size_t v = 0; v < id.size(); v++) {
+            fail[id[v]] = id[fail_[v]];
+            dict[id[v]] = dict_[v] == kNone ? kNone : id[dict_[v]];
+            output[id[v]] = output_[v];
+        }
+        fail_.swap(fail);
+        dict_.swap(dict);
+        output_.swap(output);
+    }
+};
+
+/**
+ * @brief 流式匹配：文本分块送入，匹配位置相对于整个流
+ */
+class stream_matcher {
+ public:
+    explicit stream_matcher(const automaton &ac) : ac_(ac), state_(ac.root()) {}
+
+    /**
+     * @brief 送入下一块文本，对其中结束的每个匹配调用 on_match(match)
+     */
+    template <typename F>
+    void feed(std::string_view chunk, F on_match) {
+        uint32_t s = state_;
+        for (size_t i = 0; i < chunk.size(); i++) {
+            s = ac_.next(s, static_cast<unsigned char>(chunk[i]));
+            if (ac_.has_match(s)) {
+                size_t end = offset_ + i + 1;
+                ac_.for_each_output(
+                    s, [&](size_t p) { on_match(match{p, end - ac_.pattern_length(p)}); });
+            }
+        }
+        state_ = s;
+        offset_ += chunk.size();
+    }
+
+    /** @brief 已经读入的字节数 */
+    size_t offset() const { return offset_; }
+
+    /** @brief 回到流的开头 */
+    void reset() {
+        state_ = ac_.root();
+        offset_ = 0;
+    }
+
+ private:
+    const automaton &ac_;
+    uint32_t state_;
+    size_t offset_ = 0;
+};
+}  // namespace aho_corasick
+}  // namespace strings
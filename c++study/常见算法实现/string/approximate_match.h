@@ -0,0 +1,321 @@
+/**
+ * @file approximate_match.h
+ * @brief 位并行的近似匹配：Shift-Or（精确与 k 个失配）、Myers 位向量编辑距离（多字），
+ * 以及带阈值提前终止的带状动态规划
+ * @details
+ * `动态规划/最小编辑距离.cpp` 和 `动态规划/字符串转换最小编辑次数.cpp` 填满整张 O(nm) 的表，
+ * 在大文本上做模糊查找时太慢。这里把动态规划表的一整列压进机器字，一条指令更新 64 行：
+ *
+ * 1. **Shift-Or**（Baeza-Yates & Gonnet, 1992）：状态向量的第 i 位为 0 表示模式的前 i+1 个字符
+ *    与当前位置结尾的文本匹配，每读一个字符 `D = (D << 1) | B[c]`。
+ *    允许 k 个失配（Hamming 距离）时维护 k+1 个向量，
+ *    `D_j = ((D_j << 1) | B[c]) & (D_{j-1} << 1)`，后一项表示在这里用掉一次失配。
+ *    模式超过 64 个字符时只对前 64 个字符做位并行，命中后再核对剩余部分。
+ * 2. **Myers 位向量算法**（Myers, 1999；多字的分块形式见 Hyyrö, 2003）：
+ *    编辑距离表相邻两行之差只能是 -1、0、+1，用两个位向量 Pv/Mv 表示一列的纵向差，
+ *    每个文本字符 O(⌈m/64⌉) 次字运算。`distance()` 求全局编辑距离，
+ *    `scan()` 在文本中查找编辑距离不超过 k 的所有结束位置（模式的第 0 行全为 0）。
+ *    查找时用 Ukkonen 的截断：只计算到最后一个可能不超过 k 的块，k 较小时每列只算一两个块。
+ * 3. **带状动态规划**：`banded_edit_distance()` 只计算 |i - j| <= k 的对角带，
+ *    一行的最小值超过 k 就提前结束，适合"两个字符串的编辑距离是否不超过 k"这类判断。
+ *
+ * 所有比较都按字节进行。空模式不匹配任何位置（与 `simd_search.h` 一致）。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::swap
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint64_t, uint8_t
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <vector>       /// 用于 std::vector
+
+/**
+ * @namespace strings
+ * @brief 字符串算法
+ */
+namespace strings {
+/**
+ * @namespace approximate
+ * @brief 位并行的近似匹配
+ */
+namespace approximate {
+constexpr size_t kWordBits = 64;  ///< 一个机器字的位数
+
+/**
+ * @brief Hamming 距离意义下的一次匹配
+ */
+struct mismatch_hit {
+    size_t position;    ///< 在文本中的起始位置
+    size_t mismatches;  ///< 失配的字符数
+
+    bool operator==(const mismatch_hit &other) const {
+        return position == other.position && mismatches == other.mismatches;
+    }
+};
+
+/**
+ * @brief 编辑距离意义下的一次匹配
+ */
+struct edit_hit {
+    size_t end;       ///< 匹配的子串在文本中的结束位置（不含）
+    size_t distance;  ///< 该位置结束的子串与模式的最小编辑距离
+
+    bool operator==(const edit_hit &other) const {
+        return end == other.end && distance == other.distance;
+    }
+};
+
+/**
+ * @brief Shift-Or 精确匹配与 k 个失配的匹配
+ * @details 状态向量只有一个字，覆盖模式的前 min(m, 64) 个字符；模式更长时，
+ * 前缀的失配数不会超过整体，所以先用前缀过滤，再逐字符核对剩余部分（超过 k 个失配就停下）。
+ */
+class shift_or {
+ public:
+    explicit shift_or(std::string_view pattern)
+        : pattern_(pattern), bits_(std::min(pattern.size(), kWordBits)) {
+        for (auto &mask : masks_) mask = ~uint64_t(0);
+        for (size_t i = 0; i < bits_; i++) masks_[uint8_t(pattern[i])] &= ~(uint64_t(1) << i);
+    }
+
+    /**
+     * @brief 模式长度
+     */
+    size_t size() const { return pattern_.size(); }
+
+    /**
+     * @brief 对失配数不超过 k 的每个起始位置调用 `on_match(position, mismatches)`，按位置从小到大
+     * @param k 允许的失配数，0 即精确匹配
+     */
+    template <typename Callback>
+    void scan(std::string_view text, size_t k, Callback &&on_match) const {
+        const size_t m = pattern_.size();
+        if (m == 0 || m > text.size()) return;
+        const size_t levels = std::min(k, bits_);
+        const uint64_t last = uint64_t(1) << (bits_ - 1);
+        // d[j] 的第 i 位为 0：前缀的前 i+1 个字符与当前位置结尾的文本至多 j 个失配
+        std::vector<uint64_t> d(levels + 1, ~uint64_t(0));
+        // 只有起点不超过 text.size() - m 的前缀匹配才有意义
+        const size_t stop = text.size() - m + bits_;
+        for (size_t i = 0; i < stop; i++) {
+            const uint64_t b = masks_[uint8_t(text[i])];
+            uint64_t prev = d[0];  // 上一个位置的 D_{j-1}
+            d[0] = (d[0] << 1) | b;
+            for (size_t j = 1; j <= levels; j++) {
+                const uint64_t old = d[j];
+                d[j] = ((old << 1) | b) & (prev << 1);
+                prev = old;
+            }
+            if (i + 1 < bits_ || (d[levels] & last)) continue;
+            size_t mismatches = 0;
+            while (d[mismatches] & last) mismatches++;
+            const size_t position = i + 1 - bits_;
+            for (size_t x = bits_; x < m && mismatches <= k; x++) {
+                mismatches += text[position + x] != pattern_[x];
+            }
+            if (mismatches <= k) on_match(position, mismatches);
+        }
+    }
+
+    /**
+     * @brief 所有精确匹配的起始位置
+     */
+    std::vector<size_t> find_all(std::string_view text) const {
+        std::vector<size_t> result;
+        scan(text, 0, [&](size_t position, size_t) { result.push_back(position); });
+        return result;
+    }
+
+    /**
+     * @brief 所有失配数不超过 k 的匹配
+     */
+    std::vector<mismatch_hit> find_all(std::string_view text, size_t k) const {
+        std::vector<mismatch_hit> result;
+        scan(text, k, [&](size_t position, size_t mismatches) {
+            result.push_back({position, mismatches});
+        });
+        return result;
+    }
+
+ private:
+    std::string pattern_;  ///< 模式
+    size_t bits_;          ///< 状态向量覆盖的前缀长度
+    uint64_t masks_[256];  ///< masks_[c] 的第 i 位为 0 表示 pattern_[i] == c（i < bits_）
+};
+
+/**
+ * @brief Myers 位向量编辑距离（多字分块）
+ * @details 第 b 块表示模式的第 [64b, 64b + 64) 行，块内 Pv/Mv 的第 i 位为 1 表示
+ * 该行比上一行大 1 / 小 1。`score` 记录每块最后一行（最后一块是第 m 行）的值。
+ */
+class myers {
+ public:
+    explicit myers(std::string_view pattern)
+        : m_(pattern.size()),
+          blocks_((pattern.size() + kWordBits - 1) / kWordBits),
+          top_(unsigned((pattern.size() + kWordBits - 1) % kWordBits)) {
+        peq_.assign(256 * blocks_, 0);
+        for (size_t i = 0; i < m_; i++) {
+            peq_[uint8_t(pattern[i]) * blocks_ + i / kWordBits] |= uint64_t(1) << (i % kWordBits);
+        }
+    }
+
+    /**
+     * @brief 模式长度
+     */
+    size_t size() const { return m_; }
+
+    /**
+     * @brief 模式与 text 的编辑距离（插入、删除、替换的代价都是 1）
+     */
+    size_t distance(std::string_view text) const {
+        if (m_ == 0) return text.size();
+        std::vector<uint64_t> pv(blocks_, ~uint64_t(0)), mv(blocks_, 0);
+        size_t score = m_;
+        for (char c : text) {
+            const uint64_t *eq = peq_.data() + uint8_t(c) * blocks_;
+            int h = 1;  // 第 0 行是 j，每列加 1
+            for (size_t b = 0; b < blocks_; b++) h = advance(b, eq[b], h, &pv[b], &mv[b]);
+            score += h;
+        }
+        return score;
+    }
+
+    /**
+     * @brief 对文本中每个与模式的编辑距离不超过 k 的子串结束位置调用 `on_match(end, distance)`，
+     * end 不含，按从小到大的顺序
+     */
+    template <typename Callback>
+    void scan(std::string_view text, size_t k, Callback &&on_match) const {
+        if (m_ == 0) return;
+        if (blocks_ == 1) {  // 模式不超过 64 个字符：不需要分块截断
+            uint64_t pv = ~uint64_t(0), mv = 0;
+            size_t score = m_;
+            for (size_t i = 0; i < text.size(); i++) {
+                score += advance(0, peq_[uint8_t(text[i])], 0, &pv, &mv);
+                if (score <= k) on_match(i + 1, score);
+            }
+            return;
+        }
+        const size_t last = blocks_ - 1;
+        std::vector<uint64_t> pv(blocks_, ~uint64_t(0)), mv(blocks_, 0);
+        std::vector<size_t> score(blocks_);
+        for (size_t b = 0; b < blocks_; b++) score[b] = rows_through(b);
+        // 只计算第 0 块到 active 块，之后的块中所有值都大于 k
+        size_t active = std::min(blocks_, (k + kWordBits) / kWordBits) - 1;
+        for (size_t i = 0; i < text.size(); i++) {
+            const uint64_t *eq = peq_.data() + uint8_t(text[i]) * blocks_;
+            int h = 0;  // 第 0 行全为 0：匹配可以从任意位置开始
+            for (size_t b = 0; b <= active; b++) {
+                h = advance(b, eq[b], h, &pv[b], &mv[b]);
+                score[b] += h;
+            }
+            if (active < last && score[active] - h <= k && ((eq[active + 1] & 1) || h < 0)) {
+                // 上一块最后一行不大于 k，下一块可能出现不超过 k 的值：假设它在上一列是逐行加 1
+                const size_t b = ++active;
+                pv[b] = ~uint64_t(0);
+                mv[b] = 0;
+                score[b] = score[b - 1] - h + rows_in(b);
+                score[b] += advance(b, eq[b], h, &pv[b], &mv[b]);
+            } else {
+                while (active > 0 && score[active] >= k + kWordBits) active--;
+            }
+            if (active == last && score[last] <= k) on_match(i + 1, score[last]);
+        }
+    }
+
+    /**
+     * @brief 所有编辑距离不超过 k 的结束位置
+     */
+    std::vector<edit_hit> find_all(std::string_view text, size_t k) const {
+        std::vector<edit_hit> result;
+        scan(text, k, [&](size_t end, size_t d) { result.push_back({end, d}); });
+        return result;
+    }
+
+ private:
+    /// 第 b 块的行数
+    size_t rows_in(size_t b) const { return b + 1 < blocks_ ? kWordBits : m_ - b * kWordBits; }
+
+    /// 第 0 块到第 b 块的总行数
+    size_t rows_through(size_t b) const { return std::min(m_, (b + 1) * kWordBits); }
+
+    /**
+     * @brief 更新一块（Hyyrö 的分块形式）
+     * @param hin 块上方一行的横向差（-1、0、+1）
+     * @returns 块最后一行的横向差
+     */
+    int advance(size_t b, uint64_t eq, int hin, uint64_t *pv, uint64_t *mv) const {
+        const uint64_t p = *pv, m = *mv;
+        const uint64_t xv = eq | m;
+        if (hin < 0) eq |= 1;
+        const uint64_t xh = (((eq & p) + p) ^ p) | eq;
+        uint64_t ph = m | ~(xh | p);
+        uint64_t mh = p & xh;
+        const unsigned bit = b + 1 < blocks_ ? kWordBits - 1 : top_;
+        const int hout = int((ph >> bit) & 1) - int((mh >> bit) & 1);
+        ph <<= 1;
+        mh <<= 1;
+        if (hin < 0) {
+            mh |= 1;
+        } else if (hin > 0) {
+            ph |= 1;
+        }
+        *pv = mh | ~(xv | ph);
+        *mv = ph & xv;
+        return hout;
+    }
+
+    size_t m_;                  ///< 模式长度
+    size_t blocks_;             ///< 块数
+    unsigned top_;              ///< 第 m 行在最后一块中的位号
+    std::vector<uint64_t> peq_;  ///< peq_[c * blocks_ + b]：第 i 位为 1 表示 pattern[64b + i] == c
+};
+
+/**
+ * @brief 两个字符串的编辑距离（Myers 位向量算法，O(⌈|a|/64⌉ · |b|)）
+ */
+inline size_t edit_distance(std::string_view a, std::string_view b) {
+    if (a.size() > b.size()) std::swap(a, b);  // 较短的作为模式，块数更少
+    return myers(a).distance(b);
+}
+
+/**
+ * @brief 带状动态规划：编辑距离不超过 k 时返回它，否则返回 k + 1
+ * @details 只计算 |i - j| <= k 的对角带，时间 O(k · min(|a|, |b|))；
+ * 某一行带内的最小值已经超过 k 时，之后的行只会更大，直接返回。
+ */
+inline size_t banded_edit_distance(std::string_view a, std::string_view b, size_t k) {
+    if (a.size() > b.size()) std::swap(a, b);
+    const size_t n = a.size(), m = b.size();
+    if (m - n > k) return k + 1;
+    const size_t inf = k + 1;
+    const size_t width = 2 * k + 1;
+    // row[d] 是 (i, j = i + d - k) 处的值，带外和表外的位置为 inf
+    std::vector<size_t> prev(width + 1, inf), cur(width + 1, inf);
+    for (size_t j = 0; j <= std::min(k, m); j++) prev[j + k] = j;
+    for (size_t i = 1; i <= n; i++) {
+        std::fill(cur.begin(), cur.end(), inf);
+        const size_t lo = i > k ? i - k : 0, hi = std::min(m, i + k);
+        size_t row_min = inf;
+        for (size_t j = lo; j <= hi; j++) {
+            const size_t d = j + k - i;
+            size_t v;
+            if (j == 0) {
+                v = i;
+            } else {
+                v = prev[d] + (a[i - 1] != b[j - 1]);        // 替换或相同
+                v = std::min(v, prev[d + 1] + 1);            // 删除 a[i-1]
+                if (d > 0) v = std::min(v, cur[d - 1] + 1);  // 插入 b[j-1]
+            }
+            cur[d] = std::min(v, inf);
+            row_min = std::min(row_min, cur[d]);
+        }
+        if (row_min > k) return inf;
+        prev.swap(cur);
+    }
+    return prev[m + k - n];
+}
+}  // namespace approximate
+}  // namespace strings
@@ -0,0 +1,134 @@
+/**
+ * @file duval.h
+ * @brief [Duval 算法](https://en.wikipedia.org/wiki/Lyndon_word)：字典序最小循环移位与 Lyndon 分解
+ *
+ * @details
+ * Lyndon 字是严格小于自己所有真后缀（等价地，所有非平凡旋转）的非空字符串。
+ * 任何字符串都可以唯一地写成 w1 w2 ... wk，其中每个 wi 都是 Lyndon 字且 w1 >= w2 >= ... >= wk
+ * （Chen–Fox–Lyndon 定理）。Duval 算法从左到右扫描一次就能得到这个分解：
+ * 维护形如 (u)^r u' 的前缀，其中 u 是 Lyndon 字、u' 是 u 的真前缀，
+ * 遇到比对应位置小的字符时输出 r 个 u，时间 O(n)，额外空间 O(1)。
+ *
+ * `lyndon_factorization` 把这个过程做成惰性的区间：每次自增只推进到下一个因子，
+ * 解引用得到指向原文本的 `std::string_view`，不复制任何字符，可以直接作用在内存映射的文件上。
+ *
+ * @note 虽然 Lyndon 字是描述字符串的概念，Duval 算法也可以用于找到任何可比较元素序列的字典序最小循环移位。
+ *
+ * @author [Amine Ghoussaini](https://github.com/aminegh20)
+ */
+#pragma once
+
+#include <cstddef>      /// 用于 std::size_t
+#include <cstdint>      /// 用于 uint8_t
+#include <iterator>     /// 用于 std::forward_iterator_tag
+#include <string_view>  /// 用于 std::string_view
+
+/**
+ * @brief 字符串操作算法
+ * @namespace
+ */
+namespace string {
+/**
+ * @brief 查找序列的字典序最小循环移位
+ * @tparam T 序列的类型
+ * @param s 序列
+ * @returns 序列的字典序最小循环移位的 0 索引位置
+ */
+template <typename T>
+size_t duval(const T& s) {
+    size_t n = s.size();  // 获取序列的长度
+    size_t i = 0, ans = 0;  // 初始化 i 和 ans 为 0
+    while (i < n) {  // 遍历序列
+        ans = i;  // 设置当前最小循环移位的位置
+        size_t j = i + 1, k = i;
+        while (j < (n + n) && s[j % n] >= s[k % n]) {  // 比较序列中的后缀
+            if (s[k % n] < s[j % n]) {  // 如果当前字符小于下一个字符，更新 k
+                k = i;
+            } else {
+                k++;  // 否则，k 向后移动
+            }
+            j++;  // 移动 j
+        }
+        while (i <= k) {  // 更新 i 的值
+            i += j - k;  // 通过 j 和 k 的差值调整 i
+        }
+    }
+    return ans;  // 返回字典序最小的循环移位的索引
+}
+
+/**
+ * @brief 惰性的 Lyndon 分解：`for (std::string_view w : lyndon_factorization(text))`
+ * @details 字符按无符号字节比较，与 `std::string_view` 的比较一致。
+ * 区间只保存文本的视图，文本必须比区间和它的迭代器活得久。
+ */
+class lyndon_factorization {
+ public:
+    /**
+     * @brief 前向迭代器，依次给出各个 Lyndon 因子
+     */
+    class iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        iterator() = default;
+
+        /// 当前因子
+        std::string_view operator*() const { return text_.substr(pos_, period_); }
+
+        /// 当前因子在文本中的起始位置
+        size_t position() const { return pos_; }
+
+        iterator& operator++() {
+            pos_ += period_;
+            if (pos_ >= batch_end_) next_batch();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const iterator& other) const { return pos_ != other.pos_; }
+
+     private:
+        friend class lyndon_factorization;
+
+        iterator(std::string_view text, size_t pos) : text_(text), pos_(pos) {
+            if (pos_ < text_.size()) next_batch();
+        }
+
+        /// 从 pos_ 开始运行一轮 Duval：得到周期 j - k，以及它在 [pos_, batch_end_) 内重复的次数
+        void next_batch() {
+            const size_t n = text_.size();
+            if (pos_ >= n) return;
+            size_t j = pos_ + 1, k = pos_;
+            while (j < n && uint8_t(text_[k]) <= uint8_t(text_[j])) {
+                k = uint8_t(text_[k]) < uint8_t(text_[j]) ? pos_ : k + 1;
+                j++;
+            }
+            period_ = j - k;
+            batch_end_ = pos_ + ((k - pos_) / period_ + 1) * period_;
+        }
+
+        std::string_view text_;  ///< 文本
+        size_t pos_ = 0;         ///< 当前因子的起始位置，等于 text_.size() 时为末尾
+        size_t period_ = 0;      ///< 当前因子的长度
+        size_t batch_end_ = 0;   ///< 这一轮输出的最后一个因子的结束位置
+    };
+
+    explicit lyndon_factorization(std::string_view text) : text_(text) {}
+
+    iterator begin() const { return iterator(text_, 0); }
+    iterator end() const { return iterator(text_, text_.size()); }
+
+ private:
+    std::string_view text_;  ///< 被分解的文本（不持有）
+};
+}  // namespace string
@@ -0,0 +1,76 @@
+/**
+ * @file horspool.h
+ * @brief Horspool 算法，用于查找字符串是否包含子字符串 (https://en.wikipedia.org/wiki/Boyer%E2%80%93Moore%E2%80%93Horspool_algorithm)
+ * @author [Harry Kontakis](https://github.com/ckontakis)
+ */
+#pragma once
+
+#include <array>    /// 用于 std::array
+#include <cstddef>  /// 用于 std::size_t
+#include <cstdint>  /// 用于 uint8_t
+#include <string>   /// 用于 std::string
+
+/**
+ * @namespace strings
+ * @brief 字符串处理算法
+ */
+namespace strings {
+/**
+ * @namespace horspool
+ * @brief [Horspool 算法](https://en.wikipedia.org/wiki/Boyer%E2%80%93Moore%E2%80%93Horspool_algorithm)相关函数
+ */
+namespace horspool {
+/**
+ * 一个函数，用于生成给定模式字符串的移动表（Shift Table），这是 Horspool 算法的一部分。
+ * 移动表按字节值直接索引，不在模式中（或只出现在模式末尾）的字符移动整个模式字符串的长度。
+ * @param prototype 是我们用来构建移动表的子字符串
+ * @return 返回 Horspool 算法的移动表，下标为 uint8_t(字符)
+ */
+inline std::array<std::size_t, 256> findShiftTable(const std::string &prototype) {
+    std::array<std::size_t, 256> shiftTable;
+    shiftTable.fill(prototype.size());  // 默认移动整个模式字符串的长度
+
+    for (std::size_t i = 0; i + 1 < prototype.size();
+         i++) {  // 遍历模式字符串中除最后一个以外的字符，靠后的出现覆盖靠前的
+        shiftTable[uint8_t(prototype[i])] = prototype.size() - i - 1;
+    }
+    return shiftTable;  // 返回生成的移动表
+}
+
+/**
+ * 实现 Horspool 算法，用于在文本中查找子字符串。
+ * @param text 是要搜索的字符串
+ * @param prototype 是要查找的子字符串
+ * @returns 如果文本中包含子字符串，则返回 true；否则返回 false
+ */
+inline bool horspool(const std::string &text, const std::string &prototype) {
+    if (prototype.empty()) {
+        return false;  // 空的模式字符串视为不匹配
+    }
+    const std::array<std::size_t, 256> shiftTable = findShiftTable(prototype);  // 获取模式字符串的移动表
+
+    std::size_t i = prototype.size() - 1;  // 设置文本中当前对比位置的索引
+    while (i < text.size()) {
+        std::size_t j = i, k = 0;
+        bool flag = true;
+
+        for (std::size_t z = prototype.size(); z > 0 && flag;
+             z--) {  // 从后向前逐个检查模式字符串和文本中的字符是否匹配
+            if (text[j] == prototype[z - 1]) {
+                k++;
+                j--;  // 如果字符匹配，继续向前移动
+            } else {
+                flag = false;  // 如果字符不匹配，设置 flag 为 false，跳出循环
+            }
+        }
+
+        if (k == prototype.size()) {  // 如果所有字符都匹配，说明找到了子字符串
+            return true;
+        } else {
+            i += shiftTable[uint8_t(text[i])];  // 根据移动表的值移动
+        }
+    }
+    return false;  // 如果没有找到匹配的子字符串，返回 false
+}
+} // namespace horspool
+} // namespace strings
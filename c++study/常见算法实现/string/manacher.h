@@ -0,0 +1,177 @@
+/**
+ * @file manacher.h
+ * @brief [Manacher 算法](https://en.wikipedia.org/wiki/Longest_palindromic_substring)：
+ * 在 O(n) 时间内求出以每个位置为中心的最长回文半径
+ * @details
+ * 不在字符之间插入分隔符，而是分别计算奇数长度和偶数长度的回文半径：
+ * - `odd[i]`：以 s[i] 为中心的最长奇回文是 s[i - odd[i] + 1, i + odd[i])，至少为 1；
+ * - `even[i]`：以 s[i-1] 与 s[i] 之间为中心的最长偶回文是 s[i - even[i], i + even[i])，可以为 0。
+ *
+ * 以 i 为中心的回文子串恰好有 odd[i] 个（奇）和 even[i] 个（偶），
+ * 所以回文子串总数、以每个位置开始/结束的回文个数、任意子串是否回文都可以直接从两个数组得到。
+ * 算法只读取 `std::string_view`，可以直接作用在内存映射的文件上；
+ * 额外内存是两个 uint32_t 数组，共 8n 字节（插入分隔符的写法需要约 2n 字节的副本和 16n 字节的半径）。
+ * @author [Riti Kumari](https://github.com/riti2409)
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint32_t, uint64_t
+#include <limits>       /// 用于 std::numeric_limits
+#include <stdexcept>    /// 用于 std::invalid_argument
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <utility>      /// 用于 std::move
+#include <vector>       /// 用于 std::vector
+
+/**
+ * @namespace strings
+ * @brief 字符串相关算法
+ */
+namespace strings {
+/**
+ * @namespace manacher
+ * @brief 实现 [Manacher 算法](https://en.wikipedia.org/wiki/Longest_palindromic_substring) 的函数
+ */
+namespace manacher {
+/**
+ * @brief 以每个位置为中心的最长回文半径
+ */
+class palindromes {
+ public:
+    /**
+     * @throws std::invalid_argument 文本超过 2^32 - 1 字节
+     */
+    explicit palindromes(std::string_view text) : text_(text) {
+        if (text.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("文本不能超过 2^32 - 1 字节");
+        }
+        const size_t n = text.size();
+        odd_.resize(n);
+        even_.resize(n);
+        // [l, r) 是目前右端最靠右的回文
+        for (size_t i = 0, l = 0, r = 0; i < n; i++) {
+            size_t k = i < r ? std::min<size_t>(odd_[l + r - 1 - i], r - i) : 1;
+            while (k <= i && i + k < n && text[i - k] == text[i + k]) k++;
+            odd_[i] = uint32_t(k);
+            if (i + k > r) {
+                l = i + 1 - k;
+                r = i + k;
+            }
+        }
+        for (size_t i = 0, l = 0, r = 0; i < n; i++) {
+            size_t k = i < r ? std::min<size_t>(even_[l + r - i], r - i) : 0;
+            while (k < i && i + k < n && text[i - k - 1] == text[i + k]) k++;
+            even_[i] = uint32_t(k);
+            if (i + k > r) {
+                l = i - k;
+                r = i + k;
+            }
+        }
+    }
+
+    /**
+     * @brief 文本长度
+     */
+    size_t size() const { return text_.size(); }
+
+    /**
+     * @brief 奇回文半径：s[i - odd[i] + 1, i + odd[i]) 是以 i 为中心的最长回文
+     */
+    const std::vector<uint32_t> &odd() const { return odd_; }
+
+    /**
+     * @brief 偶回文半径：s[i - even[i], i + even[i]) 是以 i-1 与 i 之间为中心的最长回文
+     */
+    const std::vector<uint32_t> &even() const { return even_; }
+
+    /**
+     * @brief 回文子串的个数（按位置区分，相同内容出现在不同位置算多个）
+     */
+    uint64_t count() const {
+        uint64_t total = 0;
+        for (size_t i = 0; i < odd_.size(); i++) total += uint64_t(odd_[i]) + even_[i];
+        return total;
+    }
+
+    /**
+     * @brief s[pos, pos + len) 是否回文，O(1)
+     */
+    bool is_palindrome(size_t pos, size_t len) const {
+        if (len == 0) return true;
+        const size_t center = pos + len / 2;
+        return len % 2 ? odd_[center] >= (len + 1) / 2 : even_[center] >= len / 2;
+    }
+
+    /**
+     * @brief 最长的回文子串；有多个时取中心最靠左的（奇中心 i 排在 i 与 i+1 之间的偶中心之前）
+     */
+    std::string_view longest() const {
+        size_t best_pos = 0, best_len = 0;
+        for (size_t i = 0; i < odd_.size(); i++) {
+            if (2 * size_t(odd_[i]) - 1 > best_len) {
+                best_len = 2 * size_t(odd_[i]) - 1;
+                best_pos = i + 1 - odd_[i];
+            }
+            if (i + 1 < even_.size() && 2 * size_t(even_[i + 1]) > best_len) {
+                best_len = 2 * size_t(even_[i + 1]);
+                best_pos = i + 1 - even_[i + 1];
+            }
+        }
+        return text_.substr(best_pos, best_len);
+    }
+
+    /**
+     * @brief 以每个位置开始的回文子串个数
+     */
+    std::vector<uint64_t> starts_per_position() const {
+        // 中心 i 的奇回文从 i - odd[i] + 1 到 i 开始，偶回文从 i - even[i] 到 i - 1 开始：差分后求前缀和
+        std::vector<uint64_t> diff(text_.size() + 1, 0);
+        for (size_t i = 0; i < odd_.size(); i++) {
+            diff[i + 1 - odd_[i]]++;
+            diff[i + 1]--;
+            diff[i - even_[i]]++;
+            diff[i]--;
+        }
+        return prefix_sums(std::move(diff));
+    }
+
+    /**
+     * @brief 以每个位置结束（含）的回文子串个数
+     */
+    std::vector<uint64_t> ends_per_position() const {
+        // 中心 i 的奇回文在 i 到 i + odd[i] - 1 结束，偶回文在 i 到 i + even[i] - 1 结束
+        std::vector<uint64_t> diff(text_.size() + 1, 0);
+        for (size_t i = 0; i < odd_.size(); i++) {
+            diff[i]++;
+            diff[i + odd_[i]]--;
+            diff[i]++;
+            diff[i + even_[i]]--;
+        }
+        return prefix_sums(std::move(diff));
+    }
+
+ private:
+    /// 差分数组求前缀和（无符号数的减法按模 2^64 回绕，求和后结果正确），丢掉末尾的哨兵
+    static std::vector<uint64_t> prefix_sums(std::vector<uint64_t> diff) {
+        for (size_t i = 1; i < diff.size(); i++) diff[i] += diff[i - 1];
+        diff.pop_back();
+        return diff;
+    }
+
+    std::string_view text_;       ///< 文本（不持有）
+    std::vector<uint32_t> odd_;   ///< 奇回文半径
+    std::vector<uint32_t> even_;  ///< 偶回文半径
+};
+
+/**
+ * @brief 实现 Manacher 算法
+ * @param prototype 输入字符串，在该字符串中查找回文子串
+ * @returns 返回最长的回文子串
+ */
+inline std::string manacher(std::string_view prototype) {
+    return std::string(palindromes(prototype).longest());
+}
+}  // namespace manacher
+}  // namespace strings
@@ -0,0 +1,373 @@
+/**
+ * @file rolling_hash.h
+ * @brief 模 2^61-1 的多项式滚动哈希：O(1) 子串哈希，以及等长多模式的
+ * [Rabin–Karp](https://en.wikipedia.org/wiki/Rabin%E2%80%93Karp_algorithm) 查找
+ * @details
+ * `Rabin-Karp 算法.cpp` 的哈希是以 5 为底、在 `int64_t` 上累加的和（长模式会溢出），
+ * 移动窗口时要做除法和 `pow`，冲突很多，每次哈希相等都要逐字节比较，而且只返回第一个匹配。本文件：
+ *
+ * 1. **模数 2^61-1**（梅森素数）：两个 61 位数的 128 位乘积可以用移位和加法取模，不需要除法。
+ *    字符串 s 的哈希是 \f$\sum_i (s_i + 1) \cdot b^{m-1-i} \bmod (2^{61}-1)\f$，
+ *    两个不同的等长字符串在随机底数下冲突的概率不超过 \f$m / (2^{61}-1)\f$。
+ * 2. **前缀哈希 + 幂表**：`hasher` 预先计算所有前缀的哈希和底数的幂，
+ *    任意子串的哈希 `h[pos+len] - h[pos] * b^len` 都可以 O(1) 求出，两段哈希也可以 O(1) 拼接。
+ * 3. **等长多模式查找**：`multi_pattern_matcher` 把所有模式的哈希放进
+ *    `search/batch_search.h` 的静态哈希索引 `hash_index`，扫描文本时窗口哈希滚动更新。
+ *    大多数窗口不是任何模式，所以先查一个每个哈希值占 8 位的位图（模式不多时能放进 L1），
+ *    通过的窗口每攒够 `search::batch::kGroupSize` 个再做一次批量（预取）查找。
+ *    只有不同的模式恰好哈希相同时才逐字节比较；默认信任哈希，需要时可以打开逐字节验证。
+ *
+ * 典型用途是近似重复文档的去重：把已有文档的所有 k-gram（shingle）作为模式，
+ * 扫描新文档时统计与每个已有文档共有的 k-gram 数。
+ *
+ * 底数默认是固定的 `kDefaultBase`，这样不同的对象、不同的运行之间哈希值可以直接比较；
+ * 输入可能被人为构造时应该用 `random_base()`。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::sort, std::min
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint64_t, uint32_t
+#include <cstring>      /// 用于 std::memcmp
+#include <random>       /// 用于 std::random_device, std::mt19937_64
+#include <stdexcept>    /// 用于 std::invalid_argument
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <utility>      /// 用于 std::pair
+#include <vector>       /// 用于 std::vector
+
+#include "../search/batch_search.h"
+
+/**
+ * @namespace strings
+ * @brief 字符串算法
+ */
+namespace strings {
+/**
+ * @namespace rolling_hash
+ * @brief 模 2^61-1 的多项式滚动哈希
+ */
+namespace rolling_hash {
+constexpr uint64_t kMod = (uint64_t(1) << 61) - 1;  ///< 模数 2^61-1
+constexpr uint64_t kDefaultBase = 0x1F0E8F6C2A7D9B3ull % kMod;  ///< 默认底数
+
+/**
+ * @brief 把小于 2^62 的 x 化简到 [0, kMod)
+ */
+inline uint64_t reduce(uint64_t x) {
+    x = (x & kMod) + (x >> 61);
+    return x >= kMod ? x - kMod : x;
+}
+
+/**
+ * @brief (a * b) mod (2^61-1)，要求 a, b < 2^61-1
+ */
+inline uint64_t mul(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    // p = hi * 2^61 + lo，而 2^61 ≡ 1，且 p < kMod^2 保证 hi + lo < 2 * kMod
+    unsigned __int128 p = (unsigned __int128)a * b;
+    uint64_t x = (uint64_t(p) & kMod) + uint64_t(p >> 61);
+    return x >= kMod ? x - kMod : x;
+#else
+    // 没有 128 位整数时把 a, b 拆成高 30 位和低 31 位，2^62 ≡ 2 (mod 2^61-1)
+    const uint64_t mask30 = (uint64_t(1) << 30) - 1, mask31 = (uint64_t(1) << 31) - 1;
+    uint64_t au = a >> 31, ad = a & mask31, bu = b >> 31, bd = b & mask31;
+    uint64_t mid = ad * bu + au * bd;
+    uint64_t x = au * bu * 2 + (mid >> 30) + ((mid & mask30) << 31) + ad * bd;
+    return reduce((x & kMod) + (x >> 61));
+#endif
+}
+
+/**
+ * @brief (a + b) mod (2^61-1)
+ */
+inline uint64_t add(uint64_t a, uint64_t b) {
+    uint64_t x = a + b;
+    return x >= kMod ? x - kMod : x;
+}
+
+/**
+ * @brief (a - b) mod (2^61-1)
+ */
+inline uint64_t sub(uint64_t a, uint64_t b) { return a >= b ? a - b : a + kMod - b; }
+
+/**
+ * @brief 字符对应的系数，加 1 使 '\0' 也有贡献
+ */
+inline uint64_t digit(char c) { return uint64_t(uint8_t(c)) + 1; }
+
+/**
+ * @brief 随机底数，取自 [2^32, kMod - 1)
+ */
+inline uint64_t random_base() {
+    std::mt19937_64 rng((uint64_t(std::random_device()()) << 32) ^ std::random_device()());
+    return (uint64_t(1) << 32) + rng() % (kMod - 1 - (uint64_t(1) << 32));
+}
+
+/**
+ * @brief base^e mod (2^61-1)
+ */
+inline uint64_t power(uint64_t base, uint64_t e) {
+    uint64_t result = 1;
+    for (; e > 0; e >>= 1) {
+        if (e & 1) result = mul(result, base);
+        base = mul(base, base);
+    }
+    return result;
+}
+
+/**
+ * @brief 整个字符串的哈希
+ */
+inline uint64_t hash(std::string_view s, uint64_t base = kDefaultBase) {
+    uint64_t h = 0;
+    for (char c : s) h = add(mul(h, base), digit(c));
+    return h;
+}
+
+/**
+ * @brief 长度为 m 的滑动窗口的哈希
+ * @details 窗口右移一位：h' = h * b + 移入的字符 - 移出的字符 * b^m。
+ * 最后一项只有 256 种取值，预先算好它的相反数。窗口哈希是一条串行的依赖链，
+ * 所以链上的值只做一次折叠（保持在 [0, 2^61 + 8) 内、不完全化简），
+ * 完全化简放在链外，只用于返回值。
+ */
+class roller {
+ public:
+    /**
+     * @param m 窗口长度
+     * @param h 第一个窗口的哈希
+     */
+    roller(size_t m, uint64_t base, uint64_t h) : base_(base), h_(h) {
+        const uint64_t top = power(base, m);
+        for (int c = 0; c < 256; c++) out_[c] = kMod - mul(digit(char(c)), top);
+    }
+
+    /**
+     * @brief 移出字符 out、移入字符 in，返回新窗口的哈希
+     */
+    uint64_t roll(char out, char in) {
+#if defined(__SIZEOF_INT128__)
+        // h_ < 2^61 + 8 时 hi、lo 都小于 2^61 + 8，加上两个不超过 kMod 的数也不会溢出
+        unsigned __int128 p = (unsigned __int128)h_ * base_;
+        uint64_t x = (uint64_t(p) & kMod) + uint64_t(p >> 61) + digit(in) + out_[uint8_t(out)];
+        h_ = (x & kMod) + (x >> 61);
+        return h_ >= kMod ? h_ - kMod : h_;
+#else
+        h_ = reduce(mul(h_, base_) + digit(in) + out_[uint8_t(out)]);
+        return h_;
+#endif
+    }
+
+ private:
+    uint64_t base_;      ///< 底数
+    uint64_t h_;         ///< 当前窗口的哈希（可能没有完全化简）
+    uint64_t out_[256];  ///< out_[c] = -(c + 1) * b^m mod (2^61-1)，取值在 (0, kMod]
+};
+
+/**
+ * @brief 长度为 m 的每个窗口的哈希，out[i] = hash(text.substr(i, m))
+ */
+inline std::vector<uint64_t> window_hashes(std::string_view text, size_t m,
+                                           uint64_t base = kDefaultBase) {
+    if (m == 0 || m > text.size()) return {};
+    std::vector<uint64_t> out(text.size() - m + 1);
+    out[0] = hash(text.substr(0, m), base);
+    roller r(m, base, out[0]);
+    for (size_t i = m; i < text.size(); i++) out[i - m + 1] = r.roll(text[i - m], text[i]);
+    return out;
+}
+
+/**
+ * @brief 文本的前缀哈希与幂表，O(1) 求任意子串的哈希
+ */
+class hasher {
+ public:
+    explicit hasher(std::string_view text, uint64_t base = kDefaultBase)
+        : base_(base), prefix_(text.size() + 1), power_(text.size() + 1) {
+        prefix_[0] = 0;
+        power_[0] = 1;
+        for (size_t i = 0; i < text.size(); i++) {
+            prefix_[i + 1] = add(mul(prefix_[i], base), digit(text[i]));
+            power_[i + 1] = mul(power_[i], base);
+        }
+    }
+
+    /**
+     * @brief 文本长度
+     */
+    size_t size() const { return prefix_.size() - 1; }
+
+    /**
+     * @brief 底数
+     */
+    uint64_t base() const { return base_; }
+
+    /**
+     * @brief base^k（k 不超过文本长度）
+     */
+    uint64_t pow(size_t k) const { return power_[k]; }
+
+    /**
+     * @brief 子串 text[pos, pos + len) 的哈希，与 `hash(text.substr(pos, len), base())` 相同
+     */
+    uint64_t substring(size_t pos, size_t len) const {
+        return sub(prefix_[pos + len], mul(prefix_[pos], power_[len]));
+    }
+
+    /**
+     * @brief 字符串 a + b 的哈希
+     * @param ha a 的哈希
+     * @param hb b 的哈希
+     * @param len_b b 的长度（不超过文本长度）
+     */
+    uint64_t concat(uint64_t ha, uint64_t hb, size_t len_b) const {
+        return add(mul(ha, power_[len_b]), hb);
+    }
+
+ private:
+    uint64_t base_;                 ///< 底数
+    std::vector<uint64_t> prefix_;  ///< prefix_[i] 是前 i 个字符的哈希
+    std::vector<uint64_t> power_;   ///< power_[i] = base^i
+};
+
+/**
+ * @brief 一次匹配：模式编号与在文本中的起始位置
+ */
+struct match {
+    size_t pattern;   ///< 模式在构造时的下标
+    size_t position;  ///< 在文本中的起始位置
+
+    bool operator==(const match &other) const {
+        return pattern == other.pattern && position == other.position;
+    }
+};
+
+/**
+ * @brief 等长多模式的 Rabin–Karp 查找
+ * @details 互不相同的哈希值放进 `hash_index`，第 g 个哈希值对应的模式编号是
+ * `ids_[group_[g] .. group_[g + 1])`。内容相同的模式落在同一组，每个都会被报告。
+ */
+class multi_pattern_matcher {
+ public:
+    /**
+     * @param patterns 模式，必须非空且长度相同
+     * @param verify 为 true 时每次哈希命中都逐字节比较，否则只在组内有不同内容的模式时比较
+     * @throws std::invalid_argument 没有模式、模式为空或长度不同
+     */
+    explicit multi_pattern_matcher(const std::vector<std::string> &patterns,
+                                   uint64_t base = kDefaultBase, bool verify = false)
+        : base_(base), verify_(verify), patterns_(patterns), index_(std::vector<uint64_t>()) {
+        if (patterns.empty()) throw std::invalid_argument("没有模式");
+        m_ = patterns[0].size();
+        if (m_ == 0) throw std::invalid_argument("模式不能为空");
+        std::vector<std::pair<uint64_t, uint32_t>> keyed(patterns.size());
+        for (size_t i = 0; i < patterns.size(); i++) {
+            if (patterns[i].size() != m_) throw std::invalid_argument("模式的长度必须相同");
+            keyed[i] = {hash(patterns[i], base_), uint32_t(i)};
+        }
+        std::sort(keyed.begin(), keyed.end());
+
+        std::vector<uint64_t> distinct;
+        for (size_t i = 0; i < keyed.size(); i++) {
+            if (i == 0 || keyed[i].first != keyed[i - 1].first) {
+                distinct.push_back(keyed[i].first);
+                group_.push_back(uint32_t(i));
+                mixed_.push_back(0);
+            } else if (patterns[keyed[i].second] != patterns[keyed[i - 1].second]) {
+                mixed_.back() = 1;  // 真正的哈希冲突
+            }
+            ids_.push_back(keyed[i].second);
+        }
+        group_.push_back(uint32_t(keyed.size()));
+        index_ = search::batch::hash_index<uint64_t>(distinct);
+
+        filter_bits_ = 6;
+        while ((size_t(1) << filter_bits_) < distinct.size() * kFilterBitsPerKey) filter_bits_++;
+        filter_.assign((size_t(1) << filter_bits_) / 64, 0);
+        for (uint64_t key : distinct) {
+            size_t bit = filter_bit(key);
+            filter_[bit / 64] |= uint64_t(1) << (bit % 64);
+        }
+    }
+
+    size_t pattern_length() const { return m_; }              ///< 模式长度
+    size_t pattern_count() const { return patterns_.size(); }  ///< 模式个数
+
+    /**
+     * @brief 扫描文本，对每个匹配按起始位置从小到大调用 `on_match(const match &)`
+     */
+    template <typename Callback>
+    void scan(std::string_view text, Callback &&on_match) const {
+        if (m_ > text.size()) return;
+        constexpr size_t G = search::batch::kGroupSize;
+        const size_t windows = text.size() - m_ + 1;
+        uint64_t h = hash(text.substr(0, m_), base_);
+        roller r(m_, base_, h);
+        // 通过位图过滤的窗口攒够一组再批量查找，保持按位置从小到大报告
+        uint64_t hashes[G];
+        size_t positions[G], found[G];
+        size_t pending = 0;
+        auto flush = [&] {
+            index_.find_batch(hashes, pending, found);
+            for (size_t k = 0; k < pending; k++) {
+                if (found[k] != search::batch::npos) report(text, positions[k], found[k], on_match);
+            }
+            pending = 0;
+        };
+        for (size_t i = 0; i < windows; i++) {
+            if (i > 0) h = r.roll(text[i - 1], text[i + m_ - 1]);
+            if (maybe_contains(h)) {
+                hashes[pending] = h;
+                positions[pending] = i;
+                if (++pending == G) flush();
+            }
+        }
+        flush();
+    }
+
+    /**
+     * @brief 所有匹配，按起始位置、再按模式编号从小到大
+     */
+    std::vector<match> find_all(std::string_view text) const {
+        std::vector<match> result;
+        scan(text, [&](const match &m) { result.push_back(m); });
+        return result;
+    }
+
+ private:
+    /// 位图中每个不同哈希值占的位数，约 1/kFilterBitsPerKey 的不匹配窗口能通过位图
+    static constexpr size_t kFilterBitsPerKey = 8;
+
+    size_t filter_bit(uint64_t h) const {
+        return size_t((h * 0x9E3779B97F4A7C15ull) >> (64 - filter_bits_));
+    }
+
+    bool maybe_contains(uint64_t h) const {
+        size_t bit = filter_bit(h);
+        return (filter_[bit / 64] >> (bit % 64)) & 1;
+    }
+
+    template <typename Callback>
+    void report(std::string_view text, size_t pos, size_t g, Callback &on_match) const {
+        const bool compare = verify_ || mixed_[g];
+        for (uint32_t k = group_[g]; k < group_[g + 1]; k++) {
+            const size_t id = ids_[k];
+            if (compare && std::memcmp(text.data() + pos, patterns_[id].data(), m_) != 0) continue;
+            on_match(match{id, pos});
+        }
+    }
+
+    uint64_t base_;                              ///< 底数
+    bool verify_;                                ///< 是否总是逐字节验证
+    size_t m_ = 0;                               ///< 模式长度
+    std::vector<std::string> patterns_;          ///< 模式
+    std::vector<uint32_t> group_;                ///< 每个哈希值对应的模式在 ids_ 中的起点
+    std::vector<uint32_t> ids_;                  ///< 按哈希值排序的模式编号
+    std::vector<uint8_t> mixed_;                 ///< 组内是否有内容不同的模式
+    search::batch::hash_index<uint64_t> index_;  ///< 哈希值 -> 组号
+    std::vector<uint64_t> filter_;               ///< 哈希值的位图，先用它排除绝大多数窗口
+    unsigned filter_bits_ = 6;                   ///< 位图大小为 2^filter_bits_ 位
+};
+}  // namespace rolling_hash
+}  // namespace strings
@@ -0,0 +1,285 @@
+/**
+ * @file simd_search.h
+ * @brief 基于首尾字节过滤的 SIMD 子串查找（参考 [SIMD-friendly algorithms for substring
+ * searching](http://0x80.pl/articles/simd-strfind.html) 的 "generic SIMD" 方法），以及流式查找
+ * @details
+ * `KMP算法.cpp`、`Horspool 算法.cpp` 和 `Boyer-Moore 字符串搜索算法.cpp` 每次只比较一个字节，
+ * 而且每一步都要查表、做数据相关的分支。本文件换一种思路：先用向量指令一次检查一整块候选位置，
+ * 只有通过过滤的少数位置才逐字节验证。
+ *
+ * 1. **首尾字节过滤**：把模式的第一个字节 `p[0]` 和最后一个字节 `p[m-1]` 各广播成一个向量，
+ *    从位置 i 和 i+m-1 各载入一块文本，两次按字节比较的结果相与，得到一个位掩码，
+ *    第 j 位为 1 表示位置 i+j 的首尾字节都对得上。只比较首字节的话，常见字母的误报率太高；
+ *    同时比较首尾两个字节，随机文本上的误报率就只剩约 1/65536。
+ * 2. **验证**：逐个取出掩码中的候选位置（`ctz`），用 `memcmp` 比较中间的 m-2 个字节。
+ * 3. **三种过滤器**：`avx2_filter` 一次 32 字节，`sse2_filter` 一次 16 字节，
+ *    `swar_filter` 是不依赖指令集的标量回退，把 8 个字节装进一个 `uint64_t` 做按字节的相等判断。
+ *    `default_filter` 是编译选项（`-mavx2` 等）允许的最宽的那个；各个函数也可以显式指定过滤器。
+ * 4. **流式查找**：`stream_searcher` 逐块接收文本，保存上一块末尾的 m-1 个字节，
+ *    因此跨越块边界的匹配也能找到，并且每个匹配只报告一次。
+ *
+ * 与 `aho_corasick.h` 一样，空模式不匹配任何位置；找到的出现位置可以互相重叠。
+ */
+#pragma once
+
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint64_t
+#include <cstring>      /// 用于 std::memcmp, std::memcpy
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <utility>      /// 用于 std::move
+#include <vector>       /// 用于 std::vector
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>  /// 用于 SIMD 指令
+#endif
+
+/**
+ * @namespace strings
+ * @brief 字符串算法
+ */
+namespace strings {
+/**
+ * @namespace simd_search
+ * @brief 首尾字节过滤的 SIMD 子串查找
+ */
+namespace simd_search {
+/// 没有找到时的返回值
+constexpr size_t npos = size_t(-1);
+
+/**
+ * @brief 标量回退：把 8 个字节当作一个 64 位整数并行比较（SWAR）
+ * @details 对 x = 文本 ^ 广播值，`((x & 0x7F..) + 0x7F..) | x` 的某字节最高位为 0
+ * 当且仅当该字节为 0（低 7 位相加不会向相邻字节进位，所以没有误报）。
+ * 掩码中每个字节只用最高位，因此 `stride` 为 8。
+ */
+struct swar_filter {
+    static constexpr size_t width = 8;     ///< 一次检查的候选位置个数
+    static constexpr unsigned stride = 8;  ///< 掩码中相邻两个候选位置相差的位数
+
+    swar_filter(char first, char last) : first_(broadcast(first)), last_(broadcast(last)) {}
+
+    /**
+     * @brief 位置 a[j] == first 且 b[j] == last 的候选掩码（j < width）
+     */
+    uint64_t candidates(const char *a, const char *b) const {
+        return equal_bytes(load(a), first_) & equal_bytes(load(b), last_);
+    }
+
+ private:
+    static constexpr uint64_t kLow = 0x7F7F7F7F7F7F7F7Full;
+    static constexpr uint64_t kHigh = 0x8080808080808080ull;
+
+    static uint64_t broadcast(char c) { return uint64_t(uint8_t(c)) * 0x0101010101010101ull; }
+
+    /// 按小端序载入，使第 j 个字节总是落在掩码的第 j 个字节
+    static uint64_t load(const char *p) {
+        uint64_t w;
+        std::memcpy(&w, p, sizeof(w));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        w = __builtin_bswap64(w);
+#endif
+        return w;
+    }
+
+    static uint64_t equal_bytes(uint64_t w, uint64_t pattern) {
+        uint64_t x = w ^ pattern;
+        return ~(((x & kLow) + kLow) | x) & kHigh;
+    }
+
+    uint64_t first_, last_;
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief SSE2 过滤器：一次 16 个候选位置
+ */
+struct sse2_filter {
+    static constexpr size_t width = 16;    ///< 一次检查的候选位置个数
+    static constexpr unsigned stride = 1;  ///< 掩码中相邻两个候选位置相差的位数
+
+    sse2_filter(char first, char last) : first_(_mm_set1_epi8(first)), last_(_mm_set1_epi8(last)) {}
+
+    /**
+     * @brief 位置 a[j] == first 且 b[j] == last 的候选掩码（j < width）
+     */
+    uint64_t candidates(const char *a, const char *b) const {
+        __m128i x = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)a), first_);
+        __m128i y = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)b), last_);
+        return uint64_t(unsigned(_mm_movemask_epi8(_mm_and_si128(x, y))));
+    }
+
+ private:
+    __m128i first_, last_;
+};
+#endif
+
+#if defined(__AVX2__)
+/**
+ * @brief AVX2 过滤器：一次 32 个候选位置
+ */
+struct avx2_filter {
+    static constexpr size_t width = 32;    ///< 一次检查的候选位置个数
+    static constexpr unsigned stride = 1;  ///< 掩码中相邻两个候选位置相差的位数
+
+    avx2_filter(char first, char last)
+        : first_(_mm256_set1_epi8(first)), last_(_mm256_set1_epi8(last)) {}
+
+    /**
+     * @brief 位置 a[j] == first 且 b[j] == last 的候选掩码（j < width）
+     */
+    uint64_t candidates(const char *a, const char *b) const {
+        __m256i x = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)a), first_);
+        __m256i y = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)b), last_);
+        return uint64_t(unsigned(_mm256_movemask_epi8(_mm256_and_si256(x, y))));
+    }
+
+ private:
+    __m256i first_, last_;
+};
+#endif
+
+/// 编译选项允许的最宽的过滤器
+#if defined(__AVX2__)
+using default_filter = avx2_filter;
+#elif defined(__SSE2__)
+using default_filter = sse2_filter;
+#else
+using default_filter = swar_filter;
+#endif
+
+/**
+ * @brief 在 s[0..n) 中按位置从小到大找出模式 p[0..m) 的所有出现
+ * @tparam Filter 过滤器（`swar_filter`、`sse2_filter` 或 `avx2_filter`）
+ * @param on_match 回调 `bool(size_t position)`，返回 false 时停止查找
+ * @returns 回调要求停止时返回 false，否则返回 true
+ */
+template <typename Filter = default_filter, typename OnMatch>
+bool scan(const char *s, size_t n, const char *p, size_t m, OnMatch &&on_match) {
+    if (m == 0 || m > n) return true;
+    const size_t last = n - m;  // 最后一个可能的起始位置
+    size_t i = 0;
+    if (last + 1 >= Filter::width) {
+        const Filter filter(p[0], p[m - 1]);
+        // 两次载入分别读到 s[i + width) 和 s[i + m - 1 + width)，都不越界
+        for (; i + Filter::width <= last + 1; i += Filter::width) {
+            uint64_t mask = filter.candidates(s + i, s + i + m - 1);
+            while (mask != 0) {
+                size_t pos = i + size_t(__builtin_ctzll(mask)) / Filter::stride;
+                mask &= mask - 1;
+                if (m <= 2 || std::memcmp(s + pos + 1, p + 1, m - 2) == 0) {
+                    if (!on_match(pos)) return false;
+                }
+            }
+        }
+    }
+    // 剩下不足一块的起始位置逐个检查
+    for (; i <= last; i++) {
+        if (s[i] == p[0] && s[i + m - 1] == p[m - 1] &&
+            (m <= 2 || std::memcmp(s + i + 1, p + 1, m - 2) == 0)) {
+            if (!on_match(i)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 从 from 开始查找模式第一次出现的位置
+ * @returns 出现位置，没有找到（或模式为空）时返回 `npos`
+ */
+template <typename Filter = default_filter>
+size_t find(std::string_view text, std::string_view pattern, size_t from = 0) {
+    if (from > text.size()) return npos;
+    size_t found = npos;
+    scan<Filter>(text.data() + from, text.size() - from, pattern.data(), pattern.size(),
+                 [&](size_t pos) {
+                     found = from + pos;
+                     return false;
+                 });
+    return found;
+}
+
+/**
+ * @brief 模式的所有（可以重叠的）出现位置，按从小到大的顺序
+ */
+template <typename Filter = default_filter>
+std::vector<size_t> find_all(std::string_view text, std::string_view pattern) {
+    std::vector<size_t> result;
+    scan<Filter>(text.data(), text.size(), pattern.data(), pattern.size(), [&](size_t pos) {
+        result.push_back(pos);
+        return true;
+    });
+    return result;
+}
+
+/**
+ * @brief 流式子串查找：文本分成任意大小的块依次送入
+ * @details 以 m 表示模式长度。每次 `feed` 先在「上一块末尾的 m-1 个字节 + 本块开头的 m-1 个字节」
+ * 中查找起点落在前者的匹配，再在本块内部查找，最后保留末尾的 m-1 个字节。
+ * 起点在保留区之前的匹配都已经完整出现过，所以不会重复报告。
+ * @tparam Filter 过滤器
+ */
+template <typename Filter = default_filter>
+class stream_searcher {
+ public:
+    explicit stream_searcher(std::string pattern) : pattern_(std::move(pattern)) {}
+
+    /**
+     * @brief 送入下一块文本
+     * @param on_match 回调 `void(size_t position)`，position 是匹配在整个流中的起始位置，
+     * 按从小到大的顺序报告
+     */
+    template <typename Callback>
+    void feed(std::string_view chunk, Callback &&on_match) {
+        const size_t m = pattern_.size();
+        if (m == 0) {
+            offset_ += chunk.size();
+            return;
+        }
+        // 起点在上一块的匹配
+        if (!tail_.empty()) {
+            const size_t carried = tail_.size();
+            joint_.assign(tail_);
+            joint_.append(chunk.substr(0, m - 1));
+            scan<Filter>(joint_.data(), joint_.size(), pattern_.data(), m, [&](size_t pos) {
+                if (pos >= carried) return false;
+                on_match(offset_ - carried + pos);
+                return true;
+            });
+        }
+        // 完全落在本块中的匹配
+        scan<Filter>(chunk.data(), chunk.size(), pattern_.data(), m, [&](size_t pos) {
+            on_match(offset_ + pos);
+            return true;
+        });
+        // 保留整个流最后的 m-1 个字节
+        if (chunk.size() >= m - 1) {
+            tail_.assign(chunk.substr(chunk.size() - (m - 1)));
+        } else {
+            tail_.append(chunk);
+            if (tail_.size() > m - 1) tail_.erase(0, tail_.size() - (m - 1));
+        }
+        offset_ += chunk.size();
+    }
+
+    /**
+     * @brief 已经送入的字节数
+     */
+    size_t offset() const { return offset_; }
+
+    /**
+     * @brief 清空状态，从一个新的流开始
+     */
+    void reset() {
+        tail_.clear();
+        offset_ = 0;
+    }
+
+ private:
+    std::string pattern_;  ///< 模式
+    std::string tail_;     ///< 流中最后的至多 m-1 个字节
+    std::string joint_;    ///< 跨块查找用的缓冲区，复用以避免每块都申请内存
+    size_t offset_ = 0;    ///< 已经送入的字节数
+};
+}  // namespace simd_search
+}  // namespace strings
@@ -0,0 +1,324 @@
+/**
+ * @file suffix_array.h
+ * @brief [后缀数组](https://en.wikipedia.org/wiki/Suffix_array)：SA-IS 线性时间构建、
+ * Kasai LCP 数组，以及基于它们的子串计数/定位、任意两个后缀的最长公共前缀和最长重复子串
+ * @details
+ * `Z函数.cpp`、`kmp.h` 和 `simd_search.h` 每查一个模式都要把整个文本重新扫描一遍，
+ * 在固定的语料上查询上百万个模式时，总代价是 O(查询数 × 文本长度)。
+ * 后缀数组把文本的所有后缀按字典序排好，之后每个查询只需要在上面二分：
+ *
+ * 1. **SA-IS**（Nong, Zhang & Chan, 2009）：把后缀分为 S 型（比后一个后缀小）和 L 型，
+ *    只对 LMS 子串（S 型紧跟在 L 型之后的位置开始）排序并命名，必要时递归，
+ *    再由排好序的 LMS 后缀经两遍诱导排序得到全部后缀的顺序，总时间 O(n)。
+ * 2. **Kasai**：按文本顺序计算相邻后缀的最长公共前缀，利用 lcp(rank[i+1]) >= lcp(rank[i]) - 1，
+ *    总时间 O(n)。`lcp[r]` 是 SA 中第 r 个和第 r+1 个后缀的最长公共前缀。
+ * 3. **计数/定位**：模式的所有出现对应 SA 中连续的一段，用两次二分求出，
+ *    二分时记住模式与左右端点已经匹配的长度，比较从两者的较小值开始（Manber–Myers），
+ *    单次查询 O(m log n)，通常接近 O(m + log n)。
+ * 4. **任意两个后缀的最长公共前缀**：等于 LCP 数组上一段区间的最小值。
+ *    LCP 数组按 `kLcpBlock` 个一块，块内最小值用 `范围查询/sparse_table.h` 的 `range_min` 做 O(1) 查询，
+ *    两端不满一块的部分直接扫描；这样 Sparse Table 只占 O(n/kLcpBlock · log n) 的内存。
+ * 5. **最长重复子串**：至少出现 k 次的最长子串，等于 LCP 数组上长度为 k-1 的滑动窗口最小值的最大值。
+ *
+ * 下标用 `int32_t` 存储，文本长度不能超过 2^31 - 1。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::fill, std::min, std::sort
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 int32_t, uint8_t
+#include <deque>        /// 用于 std::deque
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <utility>      /// 用于 std::move, std::pair
+#include <vector>       /// 用于 std::vector
+
+#include "../范围查询/sparse_table.h"
+
+/**
+ * @namespace strings
+ * @brief 字符串算法
+ */
+namespace strings {
+/**
+ * @namespace suffix_array
+ * @brief 后缀数组与 LCP 数组
+ */
+namespace suffix_array {
+/// LCP 区间最小值查询中每块的大小
+constexpr size_t kLcpBlock = 32;
+
+/**
+ * @brief SA-IS：对取值在 [0, upper] 的整数序列 s 构建后缀数组
+ * @details 不需要在末尾添加哨兵：越过末尾的后缀视为最小，最后一个位置总是 L 型。
+ * @returns sa，sa[r] 是字典序第 r 小的后缀的起始位置
+ */
+inline std::vector<int32_t> sa_is(const std::vector<int32_t> &s, int32_t upper) {
+    const int32_t n = int32_t(s.size());
+    if (n == 0) return {};
+    if (n == 1) return {0};
+    if (n == 2) return s[0] < s[1] ? std::vector<int32_t>{0, 1} : std::vector<int32_t>{1, 0};
+
+    // ls[i] 为 1 表示后缀 i 是 S 型
+    std::vector<uint8_t> ls(n, 0);
+    for (int32_t i = n - 2; i >= 0; i--) {
+        ls[i] = s[i] == s[i + 1] ? ls[i + 1] : s[i] < s[i + 1];
+    }
+    // 每个字符的桶：L 型后缀从 sum_l[c] 开始，S 型后缀从 sum_s[c] 开始
+    std::vector<int32_t> sum_l(upper + 1, 0), sum_s(upper + 1, 0);
+    for (int32_t i = 0; i < n; i++) {
+        if (!ls[i]) {
+            sum_s[s[i]]++;
+        } else {
+            sum_l[s[i] + 1]++;
+        }
+    }
+    for (int32_t c = 0; c <= upper; c++) {
+        sum_s[c] += sum_l[c];
+        if (c < upper) sum_l[c + 1] += sum_s[c];
+    }
+
+    std::vector<int32_t> sa(n);
+    std::vector<int32_t> buf(upper + 1);
+    // 诱导排序：按给定顺序放入 LMS 后缀，从左到右放 L 型，再从右到左放 S 型
+    auto induce = [&](const std::vector<int32_t> &lms) {
+        std::fill(sa.begin(), sa.end(), -1);
+        std::copy(sum_s.begin(), sum_s.end(), buf.begin());
+        for (int32_t d : lms) sa[buf[s[d]]++] = d;
+        std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+        sa[buf[s[n - 1]]++] = n - 1;
+        for (int32_t i = 0; i < n; i++) {
+            int32_t v = sa[i];
+            if (v >= 1 && !ls[v - 1]) sa[buf[s[v - 1]]++] = v - 1;
+        }
+        std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+        for (int32_t i = n - 1; i >= 0; i--) {
+            int32_t v = sa[i];
+            if (v >= 1 && ls[v - 1]) sa[--buf[s[v - 1] + 1]] = v - 1;
+        }
+    };
+
+    // LMS 位置及其编号
+    std::vector<int32_t> lms_index(n, -1), lms;
+    for (int32_t i = 1; i < n; i++) {
+        if (!ls[i - 1] && ls[i]) {
+            lms_index[i] = int32_t(lms.size());
+            lms.push_back(i);
+        }
+    }
+    const int32_t m = int32_t(lms.size());
+    induce(lms);
+    if (m == 0) return sa;
+
+    // 诱导排序后 LMS 子串已经有序，相邻两个相同的子串取相同的名字
+    std::vector<int32_t> sorted_lms;
+    sorted_lms.reserve(m);
+    for (int32_t v : sa) {
+        if (lms_index[v] != -1) sorted_lms.push_back(v);
+    }
+    std::vector<int32_t> reduced(m);
+    int32_t name = 0;
+    reduced[lms_index[sorted_lms[0]]] = 0;
+    for (int32_t i = 1; i < m; i++) {
+        int32_t l = sorted_lms[i - 1], r = sorted_lms[i];
+        int32_t end_l = lms_index[l] + 1 < m ? lms[lms_index[l] + 1] : n;
+        int32_t end_r = lms_index[r] + 1 < m ? lms[lms_index[r] + 1] : n;
+        bool same = end_l - l == end_r - r;
+        if (same) {
+            while (l < end_l && s[l] == s[r]) {
+                l++;
+                r++;
+            }
+            same = l < n && s[l] == s[r];
+        }
+        if (!same) name++;
+        reduced[lms_index[sorted_lms[i]]] = name;
+    }
+
+    // 名字互不相同时递归的结果就是直接排序，否则递归求 LMS 后缀的顺序
+    std::vector<int32_t> reduced_sa = sa_is(reduced, name);
+    for (int32_t i = 0; i < m; i++) sorted_lms[i] = lms[reduced_sa[i]];
+    induce(sorted_lms);
+    return sa;
+}
+
+/**
+ * @brief 对字节串构建后缀数组（按 unsigned char 比较）
+ */
+inline std::vector<int32_t> build(std::string_view text) {
+    std::vector<int32_t> s(text.size());
+    for (size_t i = 0; i < text.size(); i++) s[i] = uint8_t(text[i]);
+    return sa_is(s, 255);
+}
+
+/**
+ * @brief Kasai 算法计算 LCP 数组
+ * @param rank sa 的逆排列
+ * @returns 长度为 n-1 的数组，lcp[r] 是后缀 sa[r] 与 sa[r+1] 的最长公共前缀长度
+ */
+inline std::vector<int32_t> kasai(std::string_view text, const std::vector<int32_t> &sa,
+                                  const std::vector<int32_t> &rank) {
+    const size_t n = text.size();
+    std::vector<int32_t> lcp(n > 0 ? n - 1 : 0);
+    size_t h = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (h > 0) h--;
+        if (rank[i] == int32_t(n) - 1) {
+            h = 0;
+            continue;
+        }
+        size_t j = size_t(sa[rank[i] + 1]);
+        while (i + h < n && j + h < n && text[i + h] == text[j + h]) h++;
+        lcp[rank[i]] = int32_t(h);
+    }
+    return lcp;
+}
+
+/**
+ * @brief 建立在固定文本上的后缀数组索引
+ */
+class index {
+ public:
+    explicit index(std::string text) : text_(std::move(text)) {
+        sa_ = build(text_);
+        rank_.resize(sa_.size());
+        for (size_t r = 0; r < sa_.size(); r++) rank_[sa_[r]] = int32_t(r);
+        lcp_ = kasai(text_, sa_, rank_);
+        std::vector<int32_t> block_min;
+        for (size_t b = 0; b < lcp_.size(); b += kLcpBlock) {
+            size_t e = std::min(lcp_.size(), b + kLcpBlock);
+            block_min.push_back(*std::min_element(lcp_.begin() + b, lcp_.begin() + e));
+        }
+        block_rmq_ = range_queries::sparse_table::range_min<int32_t>(std::move(block_min));
+    }
+
+    /**
+     * @brief 文本长度
+     */
+    size_t size() const { return text_.size(); }
+
+    const std::string &text() const { return text_; }      ///< 文本
+    const std::vector<int32_t> &sa() const { return sa_; }  ///< 后缀数组
+    const std::vector<int32_t> &rank() const { return rank_; }  ///< 后缀数组的逆排列
+    const std::vector<int32_t> &lcp() const { return lcp_; }    ///< LCP 数组
+
+    /**
+     * @brief 以 pattern 为前缀的后缀在 SA 中的区间 [first, second)
+     */
+    std::pair<size_t, size_t> equal_range(std::string_view pattern) const {
+        return {bound(pattern, false), bound(pattern, true)};
+    }
+
+    /**
+     * @brief 模式的出现次数（可以重叠）；空模式返回文本长度
+     */
+    size_t count(std::string_view pattern) const {
+        auto range = equal_range(pattern);
+        return range.second - range.first;
+    }
+
+    /**
+     * @brief 模式的所有出现位置，按从小到大的顺序
+     */
+    std::vector<size_t> locate(std::string_view pattern) const {
+        auto range = equal_range(pattern);
+        std::vector<size_t> result(sa_.begin() + range.first, sa_.begin() + range.second);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    /**
+     * @brief 从 i 和 j 开始的两个后缀的最长公共前缀长度
+     */
+    size_t longest_common_prefix(size_t i, size_t j) const {
+        if (i == j) return text_.size() - i;
+        size_t a = size_t(rank_[i]), b = size_t(rank_[j]);
+        if (a > b) std::swap(a, b);
+        return size_t(lcp_min(a, b - 1));
+    }
+
+    /**
+     * @brief 至少出现 times 次（可以重叠）的最长子串
+     * @returns {起始位置, 长度}；没有这样的子串时长度为 0
+     */
+    std::pair<size_t, size_t> longest_repeated_substring(size_t times = 2) const {
+        if (times <= 1) return {0, text_.size()};
+        if (times > text_.size()) return {0, 0};
+        // 窗口 lcp[r .. r + times - 2] 的最小值是 sa[r .. r + times - 1] 这 times 个后缀的公共前缀
+        const size_t w = times - 1;
+        std::deque<size_t> window;  // 下标递增、lcp 值递增的单调队列
+        std::pair<size_t, size_t> best = {0, 0};
+        for (size_t r = 0; r < lcp_.size(); r++) {
+            while (!window.empty() && lcp_[window.back()] >= lcp_[r]) window.pop_back();
+            window.push_back(r);
+            if (window.front() + w <= r) window.pop_front();
+            if (r + 1 >= w && size_t(lcp_[window.front()]) > best.second) {
+                best = {size_t(sa_[r + 1 - w]), size_t(lcp_[window.front()])};
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief 占用的内存（字节）
+     */
+    size_t memory_bytes() const {
+        return text_.capacity() +
+               (sa_.capacity() + rank_.capacity() + lcp_.capacity()) * sizeof(int32_t) +
+               block_rmq_.memory_bytes();
+    }
+
+ private:
+    /**
+     * @brief 第一个（upper 为 true 时：第一个大于）以 pattern 为前缀或大于 pattern 的后缀在 SA 中的位置
+     * @details 二分区间 (lo, hi) 中所有后缀与 pattern 至少有 min(llcp, rlcp) 个字符相同，比较从那里开始。
+     */
+    size_t bound(std::string_view pattern, bool upper) const {
+        const size_t n = text_.size(), m = pattern.size();
+        size_t lo = 0, hi = n + 1;  // 实际区间是 (lo - 1, hi - 1)，避免用 -1
+        size_t llcp = 0, rlcp = 0;
+        while (hi - lo > 1) {
+            const size_t mid = lo + (hi - lo) / 2;
+            const size_t pos = size_t(sa_[mid - 1]);
+            size_t l = std::min(llcp, rlcp);
+            while (l < m && pos + l < n && text_[pos + l] == pattern[l]) l++;
+            bool less;  // 后缀 < pattern（upper 时：后缀 <= pattern，只看前 m 个字符）
+            if (l == m) {
+                less = upper;
+            } else if (pos + l == n) {
+                less = true;
+            } else {
+                less = uint8_t(text_[pos + l]) < uint8_t(pattern[l]);
+            }
+            if (less) {
+                lo = mid;
+                llcp = l;
+            } else {
+                hi = mid;
+                rlcp = l;
+            }
+        }
+        return hi - 1;
+    }
+
+    /**
+     * @brief lcp[a..b] 的最小值（两端都包含）
+     */
+    int32_t lcp_min(size_t a, size_t b) const {
+        const size_t ba = a / kLcpBlock, bb = b / kLcpBlock;
+        if (bb - ba <= 1) return *std::min_element(lcp_.begin() + a, lcp_.begin() + b + 1);
+        int32_t result = block_rmq_.query(ba + 1, bb - 1);
+        result = std::min(result, *std::min_element(lcp_.begin() + a,
+                                                    lcp_.begin() + (ba + 1) * kLcpBlock));
+        return std::min(result, *std::min_element(lcp_.begin() + bb * kLcpBlock,
+                                                  lcp_.begin() + b + 1));
+    }
+
+    std::string text_;                 ///< 文本
+    std::vector<int32_t> sa_;          ///< 后缀数组
+    std::vector<int32_t> rank_;        ///< 后缀数组的逆排列
+    std::vector<int32_t> lcp_;         ///< LCP 数组
+    range_queries::sparse_table::range_min<int32_t> block_rmq_;  ///< LCP 每块最小值的 Sparse Table
+};
+}  // namespace suffix_array
+}  // namespace strings
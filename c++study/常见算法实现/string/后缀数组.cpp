@@ -0,0 +1,217 @@
+/**
+ * @file
+ * @brief 后缀数组（SA-IS + Kasai LCP）的测试与基准测试
+ * @details 数据结构本身见 `suffix_array.h`。
+ *
+ * 用法：`./a.out [文本字节数] [查询数]`，默认 8 MiB 文本、100 万个查询。
+ * 文本模拟 DNA 序列：ACGT 随机序列中反复插入一些较长片段的（带突变的）拷贝。
+ * 基准测试比较在后缀数组上计数与每次都重新扫描全文（`std::string::find`、`simd_search.h`）。
+ */
+#include <algorithm>  /// 用于 std::sort, std::min
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+#include "./simd_search.h"
+#include "./suffix_array.h"
+
+namespace sa = strings::suffix_array;
+
+/**
+ * @brief 逐个比较字符的最长公共前缀
+ */
+static size_t naive_lcp(const std::string &s, size_t i, size_t j) {
+    size_t h = 0;
+    while (i + h < s.size() && j + h < s.size() && s[i + h] == s[j + h]) h++;
+    return h;
+}
+
+/**
+ * @brief 与直接排序所有后缀、暴力查找、暴力求最长重复子串的结果比较
+ */
+static void check(const std::string &text, std::mt19937_64 &rng) {
+    const size_t n = text.size();
+    sa::index index(text);
+
+    // 后缀数组与 LCP 数组
+    std::vector<int32_t> expected(n);
+    for (size_t i = 0; i < n; i++) expected[i] = int32_t(i);
+    std::sort(expected.begin(), expected.end(), [&](int32_t a, int32_t b) {
+        return std::string_view(text).substr(a) < std::string_view(text).substr(b);
+    });
+    assert(index.sa() == expected);
+    for (size_t r = 0; r + 1 < n; r++) {
+        assert(size_t(index.lcp()[r]) == naive_lcp(text, expected[r], expected[r + 1]));
+    }
+
+    // 任意两个后缀的最长公共前缀（跨越多个 LCP 块）
+    for (int q = 0; q < 200 && n > 0; q++) {
+        size_t i = rng() % n, j = rng() % n;
+        assert(index.longest_common_prefix(i, j) == naive_lcp(text, i, j));
+    }
+
+    // 计数与定位：文本中的子串、随机模式、空模式（每个后缀都以空串为前缀，共 n 次）
+    for (int q = 0; q < 50; q++) {
+        std::string pattern;
+        if (n > 0 && q % 2 == 0) {
+            size_t pos = rng() % n;
+            pattern = text.substr(pos, 1 + rng() % 8);
+        } else {
+            for (size_t k = rng() % 5; k > 0; k--) pattern += text.empty() ? 'a' : text[rng() % n];
+        }
+        std::vector<size_t> positions;
+        for (size_t pos = 0; pos < n && pos + pattern.size() <= n; pos++) {
+            if (text.compare(pos, pattern.size(), pattern) == 0) positions.push_back(pos);
+        }
+        assert(index.locate(pattern) == positions);
+        assert(index.count(pattern) == positions.size());
+    }
+
+    // 至少出现 times 次的最长子串
+    for (size_t times : {1, 2, 3, 5}) {
+        size_t best = 0;
+        for (size_t len = 1; len <= n; len++) {
+            bool found = false;
+            for (size_t pos = 0; pos + len <= n && !found; pos++) {
+                found = index.count(std::string_view(text).substr(pos, len)) >= times;
+            }
+            if (!found) break;
+            best = len;
+        }
+        auto lrs = index.longest_repeated_substring(times);
+        assert(lrs.second == best);
+        assert(lrs.first + lrs.second <= n);
+        assert(lrs.second == 0 ||
+               index.count(std::string_view(text).substr(lrs.first, lrs.second)) >= times);
+    }
+}
+
+/**
+ * @brief 随机字符串
+ */
+static std::string random_string(size_t n, const std::string &alphabet, std::mt19937_64 &rng) {
+    std::string s(n, ' ');
+    for (auto &ch : s) ch = alphabet[rng() % alphabet.size()];
+    return s;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(17);
+
+    // 第1个测试：经典例子与边界情况
+    sa::index banana("banana");
+    assert((banana.sa() == std::vector<int32_t>{5, 3, 1, 0, 4, 2}));
+    assert((banana.lcp() == std::vector<int32_t>{1, 3, 0, 0, 2}));
+    assert(banana.count("ana") == 2);
+    assert((banana.locate("a") == std::vector<size_t>{1, 3, 5}));
+    assert(banana.count("nab") == 0);
+    assert(banana.count("") == 6);
+    assert((banana.longest_repeated_substring() == std::pair<size_t, size_t>{3, 3}));
+    for (std::string s : {"", "a", "ab", "ba", "aa", "mississippi", "abracadabra"}) check(s, rng);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：高度重复的文本（SA-IS 需要多层递归）与任意字节
+    check(std::string(300, 'a'), rng);
+    std::string fib_a = "a", fib_b = "b";
+    while (fib_b.size() < 400) {
+        std::string next = fib_b + fib_a;
+        fib_a = fib_b;
+        fib_b = next;
+    }
+    check(fib_b, rng);
+    std::string bytes;
+    for (int i = 0; i < 300; i++) bytes += char(rng() % 2 ? 0 : 0x80 + rng() % 3);
+    check(bytes, rng);
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：小字母表上的随机文本
+    for (int round = 0; round < 200; round++) {
+        check(random_string(rng() % 300, round % 2 ? "ab" : "abcd", rng), rng);
+    }
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 构建索引、批量计数，并与每个模式都重新扫描全文比较
+ */
+static void benchmark(size_t text_bytes, size_t num_queries) {
+    std::mt19937_64 rng(71);
+    const std::string dna = "ACGT";
+    std::string text = random_string(text_bytes, dna, rng);
+    // 插入重复片段：每个片段有少量突变
+    for (int k = 0; k < 200; k++) {
+        std::string segment = random_string(200 + rng() % 2000, dna, rng);
+        for (int copy = 0; copy < 5; copy++) {
+            size_t pos = rng() % (text_bytes - segment.size());
+            text.replace(pos, segment.size(), segment);
+            segment[rng() % segment.size()] = dna[rng() % 4];
+        }
+    }
+    std::vector<std::string> queries(num_queries);
+    for (auto &q : queries) q = text.substr(rng() % (text_bytes - 32), 8 + rng() % 25);
+    const double mib = double(text_bytes) / (1 << 20);
+
+    std::cout << "\n基准测试（" << mib << " MiB 文本，" << num_queries << " 个查询）\n";
+    auto t0 = std::chrono::steady_clock::now();
+    sa::index index(text);
+    auto t1 = std::chrono::steady_clock::now();
+    std::cout << "构建（SA-IS + Kasai + Sparse Table）: "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms，内存 "
+              << double(index.memory_bytes()) / (1 << 20) << " MiB\n";
+
+    auto lrs = index.longest_repeated_substring();
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "最长重复子串: 位置 " << lrs.first << "，长度 " << lrs.second << "（"
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms）\n";
+
+    size_t total = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (const auto &q : queries) total += index.count(q);
+    t1 = std::chrono::steady_clock::now();
+    double per_query = std::chrono::duration<double, std::nano>(t1 - t0).count() / num_queries;
+    std::cout << "后缀数组计数: " << per_query << " ns/查询（共 " << total << " 次出现）\n";
+
+    // 重新扫描全文的方法太慢，只测前几个查询，再按查询数外推
+    const size_t sample = std::min<size_t>(20, num_queries);
+    auto rescan = [&](const char *name, auto count) {
+        size_t found = 0;
+        auto s0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < sample; i++) {
+            size_t c = count(queries[i]);
+            assert(c == index.count(queries[i]));
+            found += c;
+        }
+        auto s1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(s1 - s0).count() / sample;
+        std::cout << name << ": " << ns << " ns/查询（" << num_queries << " 个查询估计 "
+                  << ns * num_queries / 1e9 << " s）\n";
+        return found;
+    };
+    rescan("std::string::find 逐个扫描", [&](const std::string &q) {
+        size_t c = 0;
+        for (size_t pos = text.find(q); pos != std::string::npos; pos = text.find(q, pos + 1)) c++;
+        return c;
+    });
+    rescan("simd_search::find_all 逐个扫描", [&](const std::string &q) {
+        return strings::simd_search::find_all(text, q).size();
+    });
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8 << 20,
+              argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000);
+    return 0;
+}
@@ -0,0 +1,275 @@
+/**
+ * @file
+ * @brief 模 2^61-1 滚动哈希与等长多模式 Rabin–Karp 的测试和基准测试
+ * @details 算法本身见 `rolling_hash.h`。
+ *
+ * 用法：`./a.out [文本字节数] [文档数]`，默认 16 MiB 文本、2000 篇文档。
+ * 基准测试包括：子串哈希查询；1 万和 100 万个等长模式的多模式查找（与 `aho_corasick.h` 比较）；
+ * 近似重复文档的去重（每篇 4 KiB，一半是另一篇做了少量修改的拷贝）。
+ */
+#include <algorithm>      /// 用于 std::find, std::sort
+#include <cassert>        /// 用于 assert
+#include <chrono>         /// 用于基准测试计时
+#include <cstdlib>        /// 用于 std::strtoull
+#include <iostream>       /// 用于输入输出操作
+#include <random>         /// 用于 std::mt19937_64
+#include <stdexcept>      /// 用于 std::invalid_argument
+#include <string>         /// 用于 std::string
+#include <unordered_map>  /// 用于 std::unordered_map
+#include <vector>         /// 用于 std::vector
+
+#include "./aho_corasick.h"
+#include "./rolling_hash.h"
+
+namespace rh = strings::rolling_hash;
+
+/**
+ * @brief 不用乘法的 (a * b) mod (2^61-1)：逐位加倍
+ */
+static uint64_t slow_mul(uint64_t a, uint64_t b) {
+    uint64_t result = 0;
+    for (; b > 0; b >>= 1) {
+        if (b & 1) result = rh::add(result, a);
+        a = rh::add(a, a);
+    }
+    return result;
+}
+
+/**
+ * @brief 逐个模式暴力查找，按 (起始位置, 模式编号) 排序
+ */
+static std::vector<rh::match> brute_force(const std::vector<std::string> &patterns,
+                                          const std::string &text) {
+    std::vector<rh::match> result;
+    for (size_t id = 0; id < patterns.size(); id++) {
+        for (size_t pos = text.find(patterns[id]); pos != std::string::npos;
+             pos = text.find(patterns[id], pos + 1)) {
+            result.push_back({id, pos});
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const rh::match &a, const rh::match &b) {
+        return a.position != b.position ? a.position < b.position : a.pattern < b.pattern;
+    });
+    return result;
+}
+
+/**
+ * @brief 随机字符串
+ */
+static std::string random_string(size_t n, const std::string &alphabet, std::mt19937_64 &rng) {
+    std::string s(n, ' ');
+    for (auto &ch : s) ch = alphabet[rng() % alphabet.size()];
+    return s;
+}
+
+/**
+ * @brief 在 doc 中随机修改 edits 个字符
+ */
+static std::string mutate(std::string doc, size_t edits, std::mt19937_64 &rng) {
+    for (size_t e = 0; e < edits; e++) doc[rng() % doc.size()] = char('a' + rng() % 26);
+    return doc;
+}
+
+/**
+ * @brief 对每篇新文档，找出与它共有的 k-gram 占比至少为 threshold 的已有文档
+ * @details 已有文档的所有 k-gram 作为模式（模式编号 / 每篇的 k-gram 数 = 文档编号），
+ * 扫描新文档时统计每篇已有文档命中的窗口数。
+ * @returns result[i] 是与第 i 篇新文档近似重复的已有文档编号（从小到大）
+ */
+static std::vector<std::vector<size_t>> near_duplicates(const std::vector<std::string> &corpus,
+                                                        const std::vector<std::string> &incoming,
+                                                        size_t k, double threshold) {
+    const size_t grams = corpus[0].size() - k + 1;
+    std::vector<std::string> shingles;
+    shingles.reserve(corpus.size() * grams);
+    for (const auto &doc : corpus) {
+        for (size_t i = 0; i < grams; i++) shingles.push_back(doc.substr(i, k));
+    }
+    rh::multi_pattern_matcher matcher(shingles);
+
+    std::vector<std::vector<size_t>> result(incoming.size());
+    std::unordered_map<size_t, size_t> hits;
+    for (size_t d = 0; d < incoming.size(); d++) {
+        hits.clear();
+        // 同一个窗口命中同一篇文档的多个 k-gram 时只算一次
+        size_t last_pos = size_t(-1), last_doc = size_t(-1);
+        matcher.scan(incoming[d], [&](const rh::match &m) {
+            size_t doc = m.pattern / grams;
+            if (m.position == last_pos && doc == last_doc) return;
+            last_pos = m.position;
+            last_doc = doc;
+            hits[doc]++;
+        });
+        for (const auto &entry : hits) {
+            if (double(entry.second) >= threshold * grams) result[d].push_back(entry.first);
+        }
+        std::sort(result[d].begin(), result[d].end());
+    }
+    return result;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(18);
+
+    // 第1个测试：模乘与逐位加倍的结果一致（包括接近模数的值）
+    for (int i = 0; i < 10000; i++) {
+        uint64_t a = rng() % rh::kMod, b = rng() % rh::kMod;
+        if (i % 10 == 0) a = rh::kMod - 1 - rng() % 3;
+        assert(rh::mul(a, b) == slow_mul(a, b));
+    }
+    assert(rh::mul(rh::kMod - 1, rh::kMod - 1) == 1);  // (-1) * (-1) = 1
+    assert(rh::power(rh::kDefaultBase, rh::kMod - 1) == 1);  // 费马小定理
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：子串哈希、拼接与滑动窗口哈希都与直接计算一致
+    for (uint64_t base : {rh::kDefaultBase, rh::random_base()}) {
+        std::string text = random_string(500, "ab", rng);
+        text[7] = '\0';
+        text[8] = char(0xFF);
+        rh::hasher h(text, base);
+        for (int q = 0; q < 2000; q++) {
+            size_t pos = rng() % (text.size() + 1);
+            size_t len = rng() % (text.size() - pos + 1);
+            assert(h.substring(pos, len) == rh::hash(std::string_view(text).substr(pos, len), base));
+            size_t cut = len == 0 ? 0 : rng() % len;
+            assert(h.concat(h.substring(pos, cut), h.substring(pos + cut, len - cut), len - cut) ==
+                   h.substring(pos, len));
+        }
+        for (size_t m : {1, 2, 17, 500}) {
+            std::vector<uint64_t> windows = rh::window_hashes(text, m, base);
+            assert(windows.size() == text.size() - m + 1);
+            for (size_t i = 0; i < windows.size(); i++) assert(windows[i] == h.substring(i, m));
+        }
+    }
+    assert(rh::window_hashes("abc", 4).empty());
+    // '\0' 也有贡献："\0a" 与 "a" 的哈希不同
+    assert(rh::hash(std::string("\0a", 2)) != rh::hash("a"));
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：多模式查找与暴力结果一致；重复模式、真正的哈希冲突（底数为 1 时哈希与字符顺序无关）
+    for (int round = 0; round < 100; round++) {
+        std::string text = random_string(rng() % 400, "abc", rng);
+        size_t m = 1 + rng() % 6;
+        std::vector<std::string> patterns;
+        for (size_t i = 0, count = 1 + rng() % 20; i < count; i++) {
+            patterns.push_back(text.size() >= m && rng() % 2
+                                   ? text.substr(rng() % (text.size() - m + 1), m)
+                                   : random_string(m, "abc", rng));
+        }
+        patterns.push_back(patterns[0]);
+        std::vector<rh::match> expected = brute_force(patterns, text);
+        assert(rh::multi_pattern_matcher(patterns).find_all(text) == expected);
+        assert(rh::multi_pattern_matcher(patterns, 1, true).find_all(text) == expected);
+        // 不验证时，与模式哈希相同的其它窗口也会被报告，但真正的匹配一个都不会少
+        std::vector<rh::match> unverified = rh::multi_pattern_matcher(patterns, 1).find_all(text);
+        for (const auto &x : expected) {
+            assert(std::find(unverified.begin(), unverified.end(), x) != unverified.end());
+        }
+    }
+    bool thrown = false;
+    try {
+        rh::multi_pattern_matcher({"ab", "abc"});
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：近似重复文档的去重
+    const std::string letters = "abcdefghijklmnopqrstuvwxyz";
+    std::vector<std::string> corpus, incoming;
+    for (int i = 0; i < 20; i++) corpus.push_back(random_string(1000, letters, rng));
+    incoming.push_back(mutate(corpus[3], 3, rng));     // 与第 3 篇近似重复
+    incoming.push_back(corpus[11]);                    // 与第 11 篇完全相同
+    incoming.push_back(random_string(1000, letters, rng));  // 新文档
+    incoming.push_back(mutate(corpus[5], 300, rng));   // 改动太多，不算重复
+    auto dups = near_duplicates(corpus, incoming, 16, 0.8);
+    assert((dups == std::vector<std::vector<size_t>>{{3}, {11}, {}, {}}));
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 多模式查找、子串哈希与去重的基准测试
+ */
+static void benchmark(size_t text_bytes, size_t num_docs) {
+    std::mt19937_64 rng(81);
+    const std::string letters = "abcdefghijklmnopqrstuvwxyz";
+    std::string text = random_string(text_bytes, letters, rng);
+    const double mib = double(text_bytes) / (1 << 20);
+    auto seconds = [](auto t0, auto t1) { return std::chrono::duration<double>(t1 - t0).count(); };
+
+    std::cout << "\n子串哈希（" << mib << " MiB 文本）\n";
+    auto t0 = std::chrono::steady_clock::now();
+    rh::hasher h(text);
+    auto t1 = std::chrono::steady_clock::now();
+    uint64_t checksum = 0;
+    const size_t queries = 10000000;
+    for (size_t q = 0; q < queries; q++) {
+        size_t pos = rng() % (text_bytes - 64);
+        checksum ^= h.substring(pos, 1 + (q & 63));
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "预处理: " << seconds(t0, t1) * 1e3 << " ms，查询: "
+              << seconds(t1, t2) * 1e9 / queries << " ns/查询（校验和 " << (checksum & 0xFF)
+              << "）\n";
+
+    for (size_t num_patterns : {size_t(10000), size_t(1000000)}) {
+        std::vector<std::string> patterns(num_patterns);
+        for (auto &p : patterns) p = text.substr(rng() % (text_bytes - 16), 16);
+        std::cout << "\n" << num_patterns << " 个长度为 16 的模式（单位 MiB/s）\n";
+
+        t0 = std::chrono::steady_clock::now();
+        rh::multi_pattern_matcher matcher(patterns);
+        t1 = std::chrono::steady_clock::now();
+        size_t count = 0;
+        matcher.scan(text, [&](const rh::match &) { count++; });
+        t2 = std::chrono::steady_clock::now();
+        std::cout << "滚动哈希: 构建 " << seconds(t0, t1) * 1e3 << " ms，扫描 "
+                  << mib / seconds(t1, t2) << "，匹配 " << count << "\n";
+
+        t0 = std::chrono::steady_clock::now();
+        strings::aho_corasick::automaton ac(patterns);
+        t1 = std::chrono::steady_clock::now();
+        size_t ac_count = 0;
+        ac.scan(text, [&](const strings::aho_corasick::match &) { ac_count++; });
+        t2 = std::chrono::steady_clock::now();
+        assert(ac_count == count);
+        std::cout << "Aho–Corasick: 构建 " << seconds(t0, t1) * 1e3 << " ms，扫描 "
+                  << mib / seconds(t1, t2) << "，内存 " << double(ac.memory_bytes()) / (1 << 20)
+                  << " MiB\n";
+    }
+
+    // 去重：已有 num_docs 篇文档，新来 num_docs 篇，其中一半是已有文档做了少量修改的拷贝
+    std::vector<std::string> corpus(num_docs), incoming(num_docs);
+    for (auto &doc : corpus) doc = random_string(4096, letters, rng);
+    for (size_t i = 0; i < num_docs; i++) {
+        incoming[i] = i % 2 ? mutate(corpus[rng() % num_docs], 5, rng)
+                            : random_string(4096, letters, rng);
+    }
+    t0 = std::chrono::steady_clock::now();
+    auto dups = near_duplicates(corpus, incoming, 32, 0.5);
+    t1 = std::chrono::steady_clock::now();
+    size_t flagged = 0;
+    for (size_t i = 0; i < num_docs; i++) {
+        assert(dups[i].empty() == (i % 2 == 0));
+        flagged += !dups[i].empty();
+    }
+    std::cout << "\n去重（" << num_docs << " 篇已有文档，" << num_docs
+              << " 篇新文档，32-gram）: " << seconds(t0, t1) * 1e3 << " ms，找出 " << flagged
+              << " 篇近似重复\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16 << 20,
+              argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000);
+    return 0;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file
+ * @brief 位并行近似匹配（Shift-Or、Myers 位向量、带状动态规划）的测试与基准测试
+ * @details 算法本身见 `approximate_match.h`。
+ *
+ * 用法：`./a.out [文本字节数]`，默认 4 MiB 文本。
+ * 基准测试与 `动态规划/最小编辑距离.cpp` 那样逐格填表的 O(nm) 动态规划比较。
+ */
+#include <algorithm>  /// 用于 std::min
+#include <cassert>    /// 用于 assert
+#include <chrono>     /// 用于基准测试计时
+#include <cstdlib>    /// 用于 std::strtoull
+#include <iostream>   /// 用于输入输出操作
+#include <random>     /// 用于 std::mt19937_64
+#include <string>     /// 用于 std::string
+#include <vector>     /// 用于 std::vector
+
+#include "./approximate_match.h"
+
+namespace ap = strings::approximate;
+
+/**
+ * @brief 逐格填表的编辑距离，作为对照
+ */
+static size_t naive_distance(const std::string &a, const std::string &b) {
+    std::vector<size_t> col(a.size() + 1);
+    for (size_t i = 0; i <= a.size(); i++) col[i] = i;
+    for (size_t j = 1; j <= b.size(); j++) {
+        size_t diag = col[0];
+        col[0] = j;
+        for (size_t i = 1; i <= a.size(); i++) {
+            size_t up = col[i];
+            col[i] = std::min({col[i] + 1, col[i - 1] + 1, diag + (a[i - 1] != b[j - 1])});
+            diag = up;
+        }
+    }
+    return col[a.size()];
+}
+
+/**
+ * @brief 逐格填表的近似查找（第 0 行全为 0），作为对照
+ */
+static std::vector<ap::edit_hit> naive_search(const std::string &text, const std::string &pattern,
+                                              size_t k) {
+    std::vector<ap::edit_hit> result;
+    if (pattern.empty()) return result;
+    const size_t m = pattern.size();
+    std::vector<size_t> col(m + 1);
+    for (size_t i = 0; i <= m; i++) col[i] = i;
+    for (size_t j = 1; j <= text.size(); j++) {
+        size_t diag = col[0];
+        for (size_t i = 1; i <= m; i++) {
+            size_t up = col[i];
+            col[i] = std::min({col[i] + 1, col[i - 1] + 1, diag + (pattern[i - 1] != text[j - 1])});
+            diag = up;
+        }
+        if (col[m] <= k) result.push_back({j, col[m]});
+    }
+    return result;
+}
+
+/**
+ * @brief 逐个窗口数失配
+ */
+static std::vector<ap::mismatch_hit> naive_mismatches(const std::string &text,
+                                                      const std::string &pattern, size_t k) {
+    std::vector<ap::mismatch_hit> result;
+    if (pattern.empty()) return result;
+    for (size_t pos = 0; pos + pattern.size() <= text.size(); pos++) {
+        size_t miss = 0;
+        for (size_t i = 0; i < pattern.size(); i++) miss += text[pos + i] != pattern[i];
+        if (miss <= k) result.push_back({pos, miss});
+    }
+    return result;
+}
+
+/**
+ * @brief 随机字符串
+ */
+static std::string random_string(size_t n, const std::string &alphabet, std::mt19937_64 &rng) {
+    std::string s(n, ' ');
+    for (auto &ch : s) ch = alphabet[rng() % alphabet.size()];
+    return s;
+}
+
+/**
+ * @brief 对 s 做 edits 次随机的插入、删除或替换
+ */
+static std::string mutate(std::string s, size_t edits, const std::string &alphabet,
+                          std::mt19937_64 &rng) {
+    for (size_t e = 0; e < edits; e++) {
+        size_t pos = s.empty() ? 0 : rng() % (s.size() + 1);
+        char ch = alphabet[rng() % alphabet.size()];
+        switch (rng() % 3) {
+            case 0:
+                s.insert(s.begin() + pos, ch);
+                break;
+            case 1:
+                if (pos < s.size()) s.erase(pos, 1);
+                break;
+            default:
+                if (pos < s.size()) s[pos] = ch;
+        }
+    }
+    return s;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(19);
+
+    // 第1个测试：经典例子与边界情况
+    assert(ap::edit_distance("kitten", "sitting") == 3);
+    assert(ap::edit_distance("", "abc") == 3);
+    assert(ap::edit_distance("abc", "") == 3);
+    assert(ap::edit_distance("", "") == 0);
+    assert(ap::banded_edit_distance("kitten", "sitting", 3) == 3);
+    assert(ap::banded_edit_distance("kitten", "sitting", 2) == 3);
+    assert(ap::banded_edit_distance("abc", "abcdefg", 3) == 4);
+    assert((ap::shift_or("ana").find_all("banana") == std::vector<size_t>{1, 3}));
+    assert(ap::shift_or("").find_all("banana").empty());
+    assert(ap::shift_or("bananas").find_all("banana").empty());
+    assert((ap::shift_or("abc").find_all("abdxbc", 1) ==
+            std::vector<ap::mismatch_hit>{{0, 1}, {3, 1}}));
+    assert((ap::myers("abc").find_all("xxabxxbcx", 1) ==
+            std::vector<ap::edit_hit>{{4, 1}, {5, 1}, {8, 1}}));
+    assert(ap::myers("").find_all("abc", 3).empty());
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：编辑距离与逐格填表比较（长度跨越 64 的整数倍，覆盖多字）
+    for (int round = 0; round < 400; round++) {
+        const std::string alphabet = round % 2 ? "ab" : "acgt";
+        std::string a = random_string(rng() % 200, alphabet, rng);
+        std::string b = round % 3 ? mutate(a, rng() % 20, alphabet, rng)
+                                  : random_string(rng() % 200, alphabet, rng);
+        size_t expected = naive_distance(a, b);
+        assert(ap::edit_distance(a, b) == expected);
+        assert(ap::myers(a).distance(b) == expected);
+        for (size_t k : {0, 1, 3, 10, 50}) {
+            assert(ap::banded_edit_distance(a, b, k) == std::min(expected, k + 1));
+        }
+    }
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：近似查找与 k 个失配的查找，与暴力比较
+    for (int round = 0; round < 300; round++) {
+        const std::string alphabet = round % 2 ? "ab" : "acgt";
+        std::string pattern = random_string(1 + rng() % 300, alphabet, rng);
+        std::string text = random_string(rng() % 700, alphabet, rng);
+        // 在文本中埋入几份变形后的模式
+        for (int copy = 0; copy < 3 && text.size() > pattern.size(); copy++) {
+            std::string noisy = mutate(pattern, rng() % 6, alphabet, rng);
+            text.replace(rng() % (text.size() - pattern.size()), noisy.size(), noisy);
+        }
+        for (size_t k : {0, 1, 2, 5, 40, 70}) {
+            assert(ap::myers(pattern).find_all(text, k) == naive_search(text, pattern, k));
+            assert(ap::shift_or(pattern).find_all(text, k) == naive_mismatches(text, pattern, k));
+        }
+        std::vector<size_t> exact;
+        for (auto hit : naive_mismatches(text, pattern, 0)) exact.push_back(hit.position);
+        assert(ap::shift_or(pattern).find_all(text) == exact);
+    }
+    std::cout << "第3个测试: 通过！\n";
+}
+
+/**
+ * @brief 计时辅助：返回毫秒
+ */
+template <typename F>
+static double time_ms(F &&f) {
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+/**
+ * @brief 在 DNA 文本中查找埋入的变形模式，并比较成对编辑距离
+ */
+static void benchmark(size_t text_bytes) {
+    std::mt19937_64 rng(91);
+    const std::string dna = "ACGT";
+    std::string text = random_string(text_bytes, dna, rng);
+    const double mib = double(text_bytes) / (1 << 20);
+    std::cout << "\n基准测试（" << mib << " MiB DNA 文本）\n";
+
+    for (size_t m : {32, 200, 1000}) {
+        std::string pattern = random_string(m, dna, rng);
+        for (int copy = 0; copy < 50; copy++) {
+            std::string noisy = mutate(pattern, rng() % 4, dna, rng);
+            text.replace(rng() % (text_bytes - noisy.size()), noisy.size(), noisy);
+        }
+        const size_t k = m / 20 + 1;
+        size_t exact = 0, hamming = 0, edit = 0;
+        double t_exact = time_ms([&] { exact = ap::shift_or(pattern).find_all(text).size(); });
+        double t_hamming =
+            time_ms([&] { hamming = ap::shift_or(pattern).find_all(text, k).size(); });
+        double t_myers = time_ms([&] { edit = ap::myers(pattern).find_all(text, k).size(); });
+        // 逐格填表太慢，只测文本的一段再外推
+        std::string prefix = text.substr(0, std::min<size_t>(text_bytes, (64 << 20) / m));
+        double t_naive = time_ms([&] { naive_search(prefix, pattern, k); }) * text_bytes /
+                         prefix.size();
+        std::cout << "m = " << m << ", k = " << k << ": Shift-Or 精确 " << t_exact << " ms（" << exact
+                  << " 处），Shift-Or k 失配 " << t_hamming << " ms（" << hamming
+                  << " 处），Myers " << t_myers << " ms（" << edit << " 个结束位置），逐格填表约 "
+                  << t_naive << " ms\n";
+    }
+
+    // 成对编辑距离：大多数对相差很远，阈值 k 下带状动态规划可以很早结束
+    const size_t pairs = 20000, len = 300, k = 10;
+    std::vector<std::pair<std::string, std::string>> inputs(pairs);
+    for (size_t i = 0; i < pairs; i++) {
+        inputs[i].first = random_string(len, dna, rng);
+        inputs[i].second = i % 10 ? random_string(len, dna, rng)
+                                  : mutate(inputs[i].first, rng() % (2 * k), dna, rng);
+    }
+    size_t close_banded = 0, close_myers = 0, close_naive = 0;
+    double t_banded = time_ms([&] {
+        for (auto &p : inputs) close_banded += ap::banded_edit_distance(p.first, p.second, k) <= k;
+    });
+    double t_myers = time_ms([&] {
+        for (auto &p : inputs) close_myers += ap::edit_distance(p.first, p.second) <= k;
+    });
+    double t_naive = time_ms([&] {
+        for (size_t i = 0; i < pairs; i += 10) {
+            close_naive += naive_distance(inputs[i].first, inputs[i].second) <= k;
+        }
+    }) * 10;
+    assert(close_banded == close_myers);
+    std::cout << pairs << " 对长度 " << len << " 的字符串，编辑距离是否不超过 " << k
+              << "（共 " << close_banded << " 对）: 带状动态规划 " << t_banded << " ms，Myers "
+              << t_myers << " ms，逐格填表约 " << t_naive << " ms\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4 << 20);
+    return 0;
+}
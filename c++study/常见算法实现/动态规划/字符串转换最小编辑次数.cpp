@@ -4,6 +4,7 @@
  * b. 删除
  * c. 替换
  * 以上所有操作的成本相同。
+ * 位并行的编辑距离与带阈值的带状动态规划见 `string/approximate_match.h`。
  */
 
 #include <iostream>
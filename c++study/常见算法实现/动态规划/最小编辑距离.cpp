@@ -18,6 +18,7 @@
  *    对于替换：递归 m-1 和 n-1
  *
  * @author [Nirjas Jakilim](github.com/nirzak)
+ * \note 在大文本上做模糊查找时，位并行的 Myers 算法、Shift-Or 与带状动态规划见 `string/approximate_match.h`。
  */
 
 #include <cassert>     /// 用于 assert
@@ -0,0 +1,532 @@
+/**
+ * @file concurrent_hash_map.h
+ * @brief 分片加锁写、无锁读的并发哈希表，带基于纪元的内存回收与节点池
+ * @details
+ * `创建hash表.cpp` 中的 `hash_chain` 只能单线程使用，每个元素都是一个 `std::shared_ptr<Node>`。
+ * 缓存层需要很多读线程和少量写线程共用一张表，这里的实现：
+ *
+ * - **分片（条带）锁**：按哈希值的高位把键分到若干分片，每个分片有自己的互斥锁、桶数组和节点池，
+ *   写操作只锁一个分片，不同分片的写互不阻塞。
+ * - **无锁读**：读者不加锁，只用 acquire 读沿链表查找。节点发布之后不再修改：
+ *   更新值时换上一个新节点，删除时把前驱的 next 跳过它，所以读者任何时候看到的都是某个时刻完整的链表。
+ * - **扩容不复制节点**：按 [relativistic 哈希表](https://www.usenix.org/legacy/event/atc11/tech/final_files/Triplett.pdf)
+ *   的做法，新桶先指向旧链表中第一个属于它的节点，发布新桶数组后再分几轮“拆拉链”，
+ *   每轮在每条旧链表上只改一个 next，两轮之间等读者离开。扩容时节点数不变。
+ * - **基于纪元的回收**（EBR）：被摘下的节点不能马上释放，因为读者可能正在访问。
+ *   `epoch_reclaimer` 维护全局纪元 e，读者进入时在纪元奇偶对应的计数器上加一，离开时减一。
+ *   纪元从 e 推进到 e+1 之前要求纪元 e-1 的读者都已离开，于是纪元 e-1 中摘下的节点可以释放。
+ *   每次摘下节点都尝试推进纪元，待释放的节点不会远多于正在读的读者能看到的节点。
+ *   读者计数分散在多个缓存行上，按线程号散列，避免所有读者争用同一个计数器。
+ * - **节点池**：每个分片按块分配节点，回收的节点放回所属分片的空闲链表，
+ *   插入时不必每次调用 `operator new`。回收线程与写线程之间用一个无锁栈交接空闲节点。
+ *
+ * 读操作通过 `find()` 拷贝出值，或者通过 `visit()` 在读保护内直接访问值而不拷贝。
+ * 键和值都需要可拷贝。
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::min
+#include <atomic>      /// 用于 std::atomic
+#include <cstddef>     /// 用于 size_t
+#include <cstdint>     /// 用于 uint32_t, uint64_t
+#include <functional>  /// 用于 std::hash, std::equal_to
+#include <memory>      /// 用于 std::unique_ptr
+#include <mutex>       /// 用于 std::mutex, std::lock_guard
+#include <new>         /// 用于 placement new
+#include <optional>    /// 用于 std::optional
+#include <stdexcept>   /// 用于 std::invalid_argument
+#include <thread>      /// 用于 std::this_thread::get_id, std::this_thread::yield
+#include <utility>     /// 用于 std::move, std::swap
+#include <vector>      /// 用于 std::vector
+
+#include "./fast_hash.h"
+
+/**
+ * @namespace concurrent_hash
+ * @brief 并发哈希表
+ */
+namespace concurrent_hash {
+constexpr size_t kCacheLine = 64;  ///< 缓存行大小，用于隔开被不同线程写的计数器
+
+/**
+ * @brief 基于纪元的延迟释放
+ * @details 读者用 `pin()` 得到的守卫对象包住对共享节点的访问；写者摘下节点后调用 `retire()`，
+ * 节点在所有可能看到它的读者离开后才被释放。
+ */
+class epoch_reclaimer {
+ public:
+    using dispose_fn = void (*)(void *context, void *ptr);  ///< 释放函数
+
+    static constexpr size_t kReaderSlots = 64;  ///< 读者计数器的个数
+
+    /**
+     * @brief 读保护：存在期间，读者看到的对象不会被释放
+     */
+    class guard {
+     public:
+        explicit guard(const epoch_reclaimer *r) {
+            // 先读纪元再登记，登记后纪元没变才算进入：否则推进纪元的线程可能已经检查过这个计数器
+            auto &slot = r->slots_[slot_index()];
+            for (;;) {
+                const uint64_t e = r->epoch_.load();
+                std::atomic<uint64_t> *counter = &slot.readers[e & 1];
+                counter->fetch_add(1);
+                if (r->epoch_.load() == e) {
+                    counter_ = counter;
+                    return;
+                }
+                counter->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        ~guard() { counter_->fetch_sub(1, std::memory_order_release); }
+
+        guard(const guard &) = delete;
+        guard &operator=(const guard &) = delete;
+
+     private:
+        std::atomic<uint64_t> *counter_;  ///< 登记的计数器
+    };
+
+    epoch_reclaimer() = default;
+    epoch_reclaimer(const epoch_reclaimer &) = delete;
+    epoch_reclaimer &operator=(const epoch_reclaimer &) = delete;
+
+    /// 释放所有还没释放的对象（调用方保证此时没有读者）
+    ~epoch_reclaimer() { drain(); }
+
+    guard pin() const { return guard(this); }
+
+    /**
+     * @brief 登记一个已经摘下、读者再也无法从表中到达的对象，并尝试推进纪元
+     */
+    void retire(void *ptr, dispose_fn dispose, void *context) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back({ptr, dispose, context});
+        try_advance();
+    }
+
+    /**
+     * @brief 尝试推进纪元并释放可以释放的对象
+     * @returns 是否推进了纪元
+     */
+    bool collect() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return try_advance();
+    }
+
+    /**
+     * @brief 等到调用之前进入的读者都已离开（纪元推进两次）
+     * @details 调用线程自己不能持有读保护，否则永远等不到
+     */
+    void synchronize() {
+        const uint64_t target = epoch_.load() + 2;
+        while (epoch_.load() < target) {
+            if (!collect()) std::this_thread::yield();
+        }
+    }
+
+    /// 释放全部对象，不检查读者
+    void drain() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dispose(&waiting_);
+        dispose(&pending_);
+    }
+
+    /// 尚未释放的对象个数
+    size_t pending() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_.size() + waiting_.size();
+    }
+
+ private:
+    struct retired {
+        void *ptr;
+        dispose_fn dispose;
+        void *context;
+    };
+
+    struct alignas(kCacheLine) reader_slot {
+        std::atomic<uint64_t> readers[2] = {{0}, {0}};  ///< 按纪元奇偶分开的读者数
+    };
+
+    /// 当前线程使用的计数器
+    static size_t slot_index() {
+        static thread_local const size_t index =
+            std::hash<std::thread::id>{}(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ULL >> 58;
+        return index % kReaderSlots;
+    }
+
+    /**
+     * @brief 纪元 e -> e+1：要求纪元 e-1 的读者都已离开（与 e+1 同奇偶）。
+     * 此时 waiting_（纪元 e-1 中摘下）已没有读者能访问，可以释放；pending_（纪元 e 中摘下）接着等待。
+     */
+    bool try_advance() {
+        const uint64_t e = epoch_.load();
+        // 顺序一致的读：与读者“登记后再读纪元”配对，读到 0 时该读者之后一定会看到新纪元
+        for (const auto &slot : slots_) {
+            if (slot.readers[(e + 1) & 1].load() != 0) return false;
+        }
+        dispose(&waiting_);
+        waiting_.swap(pending_);
+        epoch_.store(e + 1);
+        return true;
+    }
+
+    static void dispose(std::vector<retired> *list) {
+        for (const auto &r : *list) r.dispose(r.context, r.ptr);
+        list->clear();
+    }
+
+    mutable reader_slot slots_[kReaderSlots];  ///< 读者计数器
+    std::atomic<uint64_t> epoch_{1};           ///< 全局纪元
+    mutable std::mutex mutex_;                 ///< 保护两个待释放列表
+    std::vector<retired> pending_;             ///< 当前纪元中摘下的对象
+    std::vector<retired> waiting_;             ///< 上一个纪元中摘下的对象
+};
+
+/**
+ * @brief 固定大小对象的池：一个线程分配（持有分片锁的写者），任意线程归还
+ */
+template <size_t Size, size_t Align>
+class node_pool {
+ public:
+    node_pool() = default;
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+
+    void *allocate() {
+        if (!free_) {
+            free_ = returned_.exchange(nullptr, std::memory_order_acquire);
+            if (!free_) grow();
+        }
+        link *l = free_;
+        free_ = l->next;
+        return l;
+    }
+
+    void release(void *ptr) {
+        link *l = static_cast<link *>(ptr);
+        l->next = returned_.load(std::memory_order_relaxed);
+        while (!returned_.compare_exchange_weak(l->next, l, std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    /// 已经从系统分配的槽数
+    size_t capacity() const { return capacity_; }
+
+ private:
+    struct link {
+        link *next;
+    };
+
+    union alignas(Align) slot {
+        link l;
+        unsigned char storage[Size];
+    };
+
+    /// 新分配一块，块大小逐次翻倍（最多 4096 个槽）
+    void grow() {
+        const size_t n = chunks_.empty() ? 16 : std::min<size_t>(capacity_, 4096);
+        chunks_.emplace_back(new slot[n]);
+        slot *chunk = chunks_.back().get();
+        for (size_t i = 0; i < n; i++) chunk[i].l.next = i + 1 < n ? &chunk[i + 1].l : free_;
+        free_ = &chunk[0].l;
+        capacity_ += n;
+    }
+
+    link *free_ = nullptr;                        ///< 分配者私有的空闲链表
+    std::atomic<link *> returned_{nullptr};       ///< 其它线程归还的槽
+    std::vector<std::unique_ptr<slot[]>> chunks_;  ///< 所有块
+    size_t capacity_ = 0;                         ///< 槽数
+};
+
+/**
+ * @brief 并发哈希表
+ * @tparam K 键
+ * @tparam V 值
+ * @tparam Hash 哈希函数，默认见 `fast_hash.h`
+ * @tparam KeyEqual 键的相等比较
+ */
+template <typename K, typename V, typename Hash = fast_hash::hasher<K>,
+          typename KeyEqual = std::equal_to<K>>
+class concurrent_map {
+    struct node {
+        const K key;
+        V value;
+        const size_t hash;
+        const uint32_t shard;  ///< 所属分片（回收时放回该分片的池）
+        std::atomic<node *> next{nullptr};
+
+        node(const K &k, const V &v, size_t h, uint32_t s) : key(k), value(v), hash(h), shard(s) {}
+    };
+
+    struct bucket_array {
+        explicit bucket_array(size_t n) : mask(n - 1), heads(new std::atomic<node *>[n]) {
+            for (size_t i = 0; i < n; i++) heads[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        size_t mask;                                  ///< 桶数减一（桶数是 2 的幂）
+        std::unique_ptr<std::atomic<node *>[]> heads;  ///< 每个桶的链表头
+    };
+
+    struct alignas(kCacheLine) shard {
+        std::mutex mutex;                          ///< 写者锁
+        std::atomic<bucket_array *> buckets{nullptr};  ///< 当前桶数组（读者无锁读取）
+        std::atomic<size_t> size{0};               ///< 元素个数
+        node_pool<sizeof(node), alignof(node)> pool;  ///< 节点池
+    };
+
+ public:
+    static constexpr size_t kMaxLoad = 2;  ///< 平均链长超过它时分片的桶数翻倍
+
+    /**
+     * @param shards 分片数，向上取到 2 的幂
+     * @param expected_size 预计的元素个数，用来决定初始桶数，避免早期的多次扩容
+     * @throws std::invalid_argument 分片数为 0 或超过 65536
+     */
+    explicit concurrent_map(size_t shards = 64, size_t expected_size = 0) {
+        if (shards == 0 || shards > 65536) {
+            throw std::invalid_argument("分片数必须在 [1, 65536] 内");
+        }
+        shard_count_ = 1;
+        while (shard_count_ < shards) shard_count_ *= 2;
+        shards_.reset(new shard[shard_count_]);
+        size_t buckets = 8;
+        while (buckets * kMaxLoad * shard_count_ < expected_size) buckets *= 2;
+        for (size_t i = 0; i < shard_count_; i++) {
+            shards_[i].buckets.store(new bucket_array(buckets), std::memory_order_relaxed);
+        }
+    }
+
+    concurrent_map(const concurrent_map &) = delete;
+    concurrent_map &operator=(const concurrent_map &) = delete;
+
+    ~concurrent_map() {
+        reclaimer_.drain();
+        for (size_t i = 0; i < shard_count_; i++) {
+            bucket_array *b = shards_[i].buckets.load(std::memory_order_relaxed);
+            for (size_t j = 0; j <= b->mask; j++) {
+                node *n = b->heads[j].load(std::memory_order_relaxed);
+                while (n) {
+                    node *next = n->next.load(std::memory_order_relaxed);
+                    n->~node();
+                    n = next;
+                }
+            }
+            delete b;
+        }
+    }
+
+    /**
+     * @brief 无锁查找，拷贝出值
+     */
+    std::optional<V> find(const K &key) const {
+        std::optional<V> result;
+        visit(key, [&](const V &value) { result = value; });
+        return result;
+    }
+
+    bool contains(const K &key) const {
+        return visit(key, [](const V &) {});
+    }
+
+    /**
+     * @brief 无锁查找，找到时在读保护内调用 `f(const V &)`，不拷贝值
+     * @details `f` 里不能修改这张表：扩容要等所有读者离开，包括调用 `f` 的线程自己
+     * @returns 是否找到
+     */
+    template <typename F>
+    bool visit(const K &key, F &&f) const {
+        const size_t h = hash_of(key);
+        auto guard = reclaimer_.pin();
+        const bucket_array *b = shard_of(h).buckets.load(std::memory_order_acquire);
+        for (const node *n = b->heads[h & b->mask].load(std::memory_order_acquire); n;
+             n = n->next.load(std::memory_order_acquire)) {
+            if (n->hash == h && equal_(n->key, key)) {
+                f(n->value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 键不存在时插入
+     * @returns 是否插入
+     */
+    bool insert(const K &key, const V &value) { return upsert(key, value, false); }
+
+    /**
+     * @brief 插入或覆盖（覆盖时换上新节点，正在读旧值的读者不受影响）
+     * @returns 是否插入了新键
+     */
+    bool insert_or_assign(const K &key, const V &value) { return upsert(key, value, true); }
+
+    /**
+     * @returns 是否删除了键
+     */
+    bool erase(const K &key) {
+        const size_t h = hash_of(key);
+        shard &s = shard_of(h);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        bucket_array *b = s.buckets.load(std::memory_order_relaxed);
+        std::atomic<node *> *link = &b->heads[h & b->mask];
+        for (node *n = link->load(std::memory_order_relaxed); n;
+             link = &n->next, n = link->load(std::memory_order_relaxed)) {
+            if (n->hash == h && equal_(n->key, key)) {
+                // 跳过 n；n->next 保持不变，正站在 n 上的读者还能继续往后走
+                link->store(n->next.load(std::memory_order_relaxed), std::memory_order_release);
+                s.size.fetch_sub(1, std::memory_order_relaxed);
+                retire(n);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// 元素个数（并发修改时是近似值）
+    size_t size() const {
+        size_t total = 0;
+        for (size_t i = 0; i < shard_count_; i++) {
+            total += shards_[i].size.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_t shard_count() const { return shard_count_; }
+
+    /// 尝试推进纪元、释放已摘下的节点（写操作会自动调用，空闲时也可以手动调用）
+    bool collect() { return reclaimer_.collect(); }
+
+    /// 等待释放的节点与桶数组个数
+    size_t pending_reclaim() const { return reclaimer_.pending(); }
+
+    /// 节点池已分配的槽数
+    size_t pooled_nodes() const {
+        size_t total = 0;
+        for (size_t i = 0; i < shard_count_; i++) {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].pool.capacity();
+        }
+        return total;
+    }
+
+ private:
+    /// 混合用户哈希：高 16 位选分片，低位选桶
+    size_t hash_of(const K &key) const {
+        uint64_t h = uint64_t(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+        return size_t(h ^ (h >> 29));
+    }
+
+    shard &shard_of(size_t h) const { return shards_[(uint64_t(h) >> 48) & (shard_count_ - 1)]; }
+
+    bool upsert(const K &key, const V &value, bool assign) {
+        const size_t h = hash_of(key);
+        shard &s = shard_of(h);
+        const uint32_t index = uint32_t(&s - shards_.get());
+        std::lock_guard<std::mutex> lock(s.mutex);
+        bucket_array *b = s.buckets.load(std::memory_order_relaxed);
+        std::atomic<node *> &head = b->heads[h & b->mask];
+        std::atomic<node *> *link = &head;
+        for (node *n = link->load(std::memory_order_relaxed); n;
+             link = &n->next, n = link->load(std::memory_order_relaxed)) {
+            if (n->hash == h && equal_(n->key, key)) {
+                if (!assign) return false;
+                node *fresh = make_node(&s, key, value, h, index);
+                fresh->next.store(n->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                link->store(fresh, std::memory_order_release);
+                retire(n);
+                return false;
+            }
+        }
+        node *fresh = make_node(&s, key, value, h, index);
+        fresh->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(fresh, std::memory_order_release);
+        if (s.size.fetch_add(1, std::memory_order_relaxed) + 1 > (b->mask + 1) * kMaxLoad) {
+            grow(&s);
+        }
+        return true;
+    }
+
+    node *make_node(shard *s, const K &key, const V &value, size_t h, uint32_t index) {
+        void *mem = s->pool.allocate();
+        try {
+            return new (mem) node(key, value, h, index);
+        } catch (...) {
+            s->pool.release(mem);
+            throw;
+        }
+    }
+
+    /**
+     * @brief 桶数翻倍（持有分片锁）
+     * @details 旧桶 i 的链表在新数组中拆成桶 i 和 i + m（m 为旧桶数）。节点不复制，只改 next：
+     *
+     * 1. 新桶 j 指向旧链表 j & (m - 1) 中第一个属于 j 的节点。此时两个新桶共用同一条“拉链”，
+     *    读者按哈希值比较，会跳过夹在中间的另一个桶的节点；发布新数组后等旧数组上的读者离开；
+     * 2. 每一轮在每条拉链上找到当前一段同桶节点的末尾，让它的 next 跳过紧随其后的另一个桶的一段。
+     *    刚走进被跳过那段的读者还要靠那段末尾的 next 回到自己的桶，所以同一条链表的两次修改之间
+     *    要等一个宽限期。
+     */
+    void grow(shard *s) {
+        bucket_array *old = s->buckets.load(std::memory_order_relaxed);
+        auto *fresh = new bucket_array((old->mask + 1) * 2);
+        std::vector<node *> cursor(old->mask + 1);  // 每条拉链上还没拆开的位置
+        for (size_t i = 0; i <= old->mask; i++) {
+            cursor[i] = old->heads[i].load(std::memory_order_relaxed);
+            for (node *n = cursor[i]; n; n = n->next.load(std::memory_order_relaxed)) {
+                std::atomic<node *> &head = fresh->heads[n->hash & fresh->mask];
+                if (!head.load(std::memory_order_relaxed)) head.store(n, std::memory_order_relaxed);
+            }
+        }
+        s->buckets.store(fresh, std::memory_order_release);
+        reclaimer_.synchronize();
+        delete old;
+
+        for (bool zipped = true; zipped;) {
+            zipped = false;
+            for (node *&p : cursor) {
+                if (!p) continue;
+                const size_t bucket = p->hash & fresh->mask;
+                node *last = p;  // 同桶一段的末尾
+                node *other;     // 紧随其后的另一个桶的一段
+                while ((other = last->next.load(std::memory_order_relaxed)) &&
+                       (other->hash & fresh->mask) == bucket) {
+                    last = other;
+                }
+                if (!other) {
+                    p = nullptr;
+                    continue;
+                }
+                node *back = other;  // 之后第一个回到 bucket 的节点
+                while (back && (back->hash & fresh->mask) != bucket) {
+                    back = back->next.load(std::memory_order_relaxed);
+                }
+                last->next.store(back, std::memory_order_release);
+                // 被跳过的那段之后还有 bucket 的节点时，它的末尾下一轮再处理
+                p = back ? other : nullptr;
+                zipped |= p != nullptr;
+            }
+            if (zipped) reclaimer_.synchronize();
+        }
+    }
+
+    void retire(node *n) {
+        reclaimer_.retire(n, [](void *context, void *p) {
+            auto *map = static_cast<concurrent_map *>(context);
+            node *victim = static_cast<node *>(p);
+            const uint32_t index = victim->shard;
+            victim->~node();
+            map->shards_[index].pool.release(victim);
+        }, this);
+    }
+
+    std::unique_ptr<shard[]> shards_;     ///< 分片
+    size_t shard_count_ = 0;              ///< 分片数（2 的幂）
+    mutable epoch_reclaimer reclaimer_;   ///< 延迟释放
+    Hash hash_;                           ///< 哈希函数
+    KeyEqual equal_;                      ///< 键的相等比较
+};
+}  // namespace concurrent_hash
@@ -0,0 +1,233 @@
+/**
+ * @file fast_hash.h
+ * @brief 高吞吐量的非加密 64 位哈希族（[wyhash](https://github.com/wangyi-fudan/wyhash) 风格），带种子与批量接口
+ * @details
+ * 核心操作是 `mix(a, b)`：把两个 64 位数相乘得到 128 位积，再把高低两半异或。
+ * 一次乘法就能让每个输入位影响几乎所有输出位，所以：
+ * - 整数键 `hash_u64(x, seed)`：两次乘法（另有一次与键无关的种子预处理）；
+ * - 字节串 `hash_bytes(p, n, seed)`：不超过 16 字节时用两次重叠的读取覆盖整个输入，不需要逐字节循环；
+ *   更长的输入每 48 字节用三条独立的乘法链，最后合并。
+ *
+ * 不同的 `seed` 给出（近似）独立的哈希函数，布隆过滤器、双重哈希等需要多个哈希函数时可以直接用种子区分。
+ * 批量接口 `hash_many()` 只是便利接口：各个键之间本来就没有依赖，乱序执行已经能让逐个调用的循环同时计算多个键，
+ * 编译器也会把种子的预处理提到循环外，所以它并不比逐个调用更快（交错展开也测不出差别，瓶颈是乘法的吞吐量）。
+ *
+ * `hasher<T>` 是可以直接作为哈希表模板参数的函数对象：整数、枚举、指针用 `hash_u64`，
+ * 字符串用 `hash_bytes`（透明，可以用 `std::string_view` 查找 `std::string` 键），
+ * 其它类型先用 `std::hash<T>` 再混合一次。
+ *
+ * @note 这不是加密哈希，不能抵抗刻意构造的碰撞；多字节读取按机器字节序，结果在大端与小端机器上不同。
+ */
+#pragma once
+
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint64_t, uintptr_t
+#include <cstring>      /// 用于 std::memcpy
+#include <functional>   /// 用于 std::hash
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+#include <type_traits>  /// 用于 std::enable_if_t, std::is_integral_v
+
+/**
+ * @namespace fast_hash
+ * @brief 非加密的快速哈希
+ */
+namespace fast_hash {
+/// 四个奇数常量：每个字节的 popcount 都是 4，用来打破输入中的 0 与规律
+inline constexpr uint64_t kSecret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                        0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+namespace detail {
+/// 没有 128 位整数类型时的乘法：四个 32x32 位的部分积
+inline void multiply_portable(uint64_t &a, uint64_t &b) {
+    const uint64_t ha = a >> 32, hb = b >> 32, la = uint32_t(a), lb = uint32_t(b);
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const uint64_t t = rl + (rm0 << 32);
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl);
+    const uint64_t lo = t + (rm1 << 32);
+    hi += lo < t;
+    a = lo;
+    b = hi;
+}
+}  // namespace detail
+
+/**
+ * @brief 128 位乘积的高低两半：a 为低 64 位，b 为高 64 位
+ */
+inline void multiply(uint64_t &a, uint64_t &b) {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    a = uint64_t(r);
+    b = uint64_t(r >> 64);
+#else
+    detail::multiply_portable(a, b);
+#endif
+}
+
+/**
+ * @brief 混合：128 位乘积的高低两半异或
+ */
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    multiply(a, b);
+    return a ^ b;
+}
+
+namespace detail {
+inline uint64_t read8(const uint8_t *p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline uint64_t read4(const uint8_t *p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+/// 1~3 字节：首、中、尾三个字节拼在一起（长度不同的输入由最后一步异或的长度区分）
+inline uint64_t read3(const uint8_t *p, size_t n) {
+    return uint64_t(p[0]) << 16 | uint64_t(p[n >> 1]) << 8 | p[n - 1];
+}
+
+/// 种子的预处理（与键无关）
+inline uint64_t prepare_seed(uint64_t seed) { return seed ^ mix(seed ^ kSecret[0], kSecret[1]); }
+
+/// 已经预处理过种子的字节串哈希
+inline uint64_t hash_prepared(const void *data, size_t n, uint64_t seed) {
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint64_t a, b;
+    if (n <= 16) {
+        if (n >= 4) {
+            // 4~16 字节：首尾各两次 4 字节读取（可能重叠），覆盖全部输入
+            const size_t offset = (n >> 3) << 2;
+            a = read4(p) << 32 | read4(p + offset);
+            b = read4(p + n - 4) << 32 | read4(p + n - 4 - offset);
+        } else if (n > 0) {
+            a = read3(p, n);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = n;
+        if (i > 48) {
+            // 三条独立的乘法链，互不等待
+            uint64_t seed1 = seed, seed2 = seed;
+            do {
+                seed = mix(read8(p) ^ kSecret[1], read8(p + 8) ^ seed);
+                seed1 = mix(read8(p + 16) ^ kSecret[2], read8(p + 24) ^ seed1);
+                seed2 = mix(read8(p + 32) ^ kSecret[3], read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = mix(read8(p) ^ kSecret[1], read8(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // 最后 16 字节（可能与已处理的部分重叠）
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+    a ^= kSecret[1];
+    b ^= seed;
+    multiply(a, b);
+    return mix(a ^ kSecret[0] ^ n, b ^ kSecret[1]);
+}
+}  // namespace detail
+
+/**
+ * @brief 字节串的 64 位哈希
+ * @param seed 种子，不同的种子给出不同的哈希函数
+ */
+inline uint64_t hash_bytes(const void *data, size_t n, uint64_t seed = 0) {
+    return detail::hash_prepared(data, n, detail::prepare_seed(seed));
+}
+
+inline uint64_t hash_bytes(std::string_view s, uint64_t seed = 0) {
+    return hash_bytes(s.data(), s.size(), seed);
+}
+
+/**
+ * @brief 64 位整数的哈希（两次乘法）
+ * @details 种子与 `hash_bytes` 一样先预处理，再把最低位置 1：乘以奇数是模 2^64 的双射，
+ * 所以任何种子下不同的键都不会因为 b 为 0 而得到同一个值。
+ * @param seed 种子，不同的种子给出不同的哈希函数
+ */
+inline uint64_t hash_u64(uint64_t x, uint64_t seed = 0) {
+    uint64_t a = x ^ kSecret[0], b = (detail::prepare_seed(seed) ^ kSecret[1]) | 1;
+    multiply(a, b);
+    return mix(a ^ kSecret[0], b ^ kSecret[1]);
+}
+
+/**
+ * @brief 批量哈希整数：out[i] = hash_u64(keys[i], seed)
+ */
+inline void hash_many(const uint64_t *keys, size_t count, uint64_t *out, uint64_t seed = 0) {
+    for (size_t i = 0; i < count; i++) out[i] = hash_u64(keys[i], seed);
+}
+
+/**
+ * @brief 批量哈希字节串：out[i] = hash_bytes(keys[i], seed)
+ */
+inline void hash_many(const std::string_view *keys, size_t count, uint64_t *out, uint64_t seed = 0) {
+    const uint64_t prepared = detail::prepare_seed(seed);
+    for (size_t i = 0; i < count; i++) out[i] = detail::hash_prepared(keys[i].data(), keys[i].size(), prepared);
+}
+
+/**
+ * @brief 字符串哈希函数对象，透明：`std::string`、`std::string_view`、字符串字面量得到相同的哈希值
+ */
+struct string_hasher {
+    using is_transparent = void;
+
+    explicit string_hasher(uint64_t seed = 0) : seed(seed) {}
+
+    size_t operator()(std::string_view s) const { return size_t(hash_bytes(s, seed)); }
+
+    uint64_t seed;  ///< 种子
+};
+
+/**
+ * @brief 哈希函数对象：其它类型先用 `std::hash<T>`，再用 `hash_u64` 混合
+ */
+template <typename T, typename = void>
+struct hasher {
+    explicit hasher(uint64_t seed = 0) : seed(seed) {}
+
+    size_t operator()(const T &x) const { return size_t(hash_u64(uint64_t(std::hash<T>{}(x)), seed)); }
+
+    uint64_t seed;  ///< 种子
+};
+
+/**
+ * @brief 整数、枚举、指针
+ */
+template <typename T>
+struct hasher<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>>> {
+    explicit hasher(uint64_t seed = 0) : seed(seed) {}
+
+    size_t operator()(T x) const {
+        if constexpr (std::is_pointer_v<T>) {
+            return size_t(hash_u64(uint64_t(reinterpret_cast<uintptr_t>(x)), seed));
+        } else {
+            return size_t(hash_u64(uint64_t(x), seed));
+        }
+    }
+
+    uint64_t seed;  ///< 种子
+};
+
+template <>
+struct hasher<std::string> : string_hasher {
+    using string_hasher::string_hasher;
+};
+
+template <>
+struct hasher<std::string_view> : string_hasher {
+    using string_hasher::string_hasher;
+};
+}  // namespace fast_hash
@@ -0,0 +1,121 @@
+/**
+ * @file file_hash.h
+ * @brief 对整个文件做流式哈希：POSIX 上用 mmap 映射后直接把映射区交给哈希上下文，否则用 fread 分块读取
+ * @details
+ * 上下文只需要提供 `update(const void *, size_t)` 与 `finalize()`，例如 `hashing::md5::context`、
+ * `hashing::sha1::context`、`hashing::sha256::context`。两种读取方式都不会把文件整个读进内存：
+ * mmap 的页由内核按需换入（并用 `MADV_SEQUENTIAL` 提示预读、及时丢弃），fread 只用一个固定大小的缓冲区。
+ *
+ * 只有大小已知的普通文件才能映射：管道、字符设备等不是普通文件，`/proc` 下的文件虽然是普通文件，
+ * `st_size` 却是 0，按它映射只会得到空输入的摘要。`hash_file()` 对这些文件改用 fread 一直读到文件结束
+ * （真正的空文件用 fread 读也是空输入，结果相同）。
+ */
+#pragma once
+
+#include <cstddef>    /// 用于 size_t
+#include <cstdio>     /// 用于 std::FILE, std::fopen, std::fread
+#include <memory>     /// 用于 std::unique_ptr
+#include <stdexcept>  /// 用于 std::runtime_error
+#include <string>     /// 用于 std::string
+#include <utility>    /// 用于 std::move
+#include <vector>     /// 用于 std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>     /// 用于 open
+#include <sys/mman.h>  /// 用于 mmap
+#include <sys/stat.h>  /// 用于 fstat
+#include <unistd.h>    /// 用于 close
+#define FILE_HASH_HAS_MMAP 1
+#endif
+
+/**
+ * @namespace hashing
+ * @brief 哈希算法
+ */
+namespace hashing {
+#ifdef FILE_HASH_HAS_MMAP
+/**
+ * @brief 只读映射整个文件
+ * @throws std::runtime_error 无法打开、不是普通文件或映射失败
+ */
+class mapped_file {
+ public:
+    explicit mapped_file(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("无法打开文件: " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("无法获取文件大小: " + path);
+        }
+        if (!S_ISREG(st.st_mode)) {
+            ::close(fd);
+            throw std::runtime_error("不是普通文件，无法映射: " + path);
+        }
+        size_ = size_t(st.st_size);
+        if (size_ > 0) {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("mmap 失败: " + path);
+            }
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const unsigned char *>(p);
+        }
+        ::close(fd);
+    }
+    ~mapped_file() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<unsigned char *>(data_), size_);
+        }
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    const unsigned char *data() const { return data_; }
+    size_t size() const { return size_; }
+
+ private:
+    const unsigned char *data_ = nullptr;
+    size_t size_ = 0;
+};
+#endif
+
+/**
+ * @brief 用 fread 分块读取文件并哈希
+ * @param chunk 每次读取的字节数
+ * @throws std::runtime_error 无法打开或读取文件
+ */
+template <typename Context>
+auto hash_file_fread(const std::string &path, Context ctx = Context(), size_t chunk = size_t(1) << 20) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> f(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!f) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+    std::vector<unsigned char> buffer(chunk);
+    size_t n;
+    while ((n = std::fread(buffer.data(), 1, buffer.size(), f.get())) > 0) ctx.update(buffer.data(), n);
+    if (std::ferror(f.get())) {
+        throw std::runtime_error("读取文件失败: " + path);
+    }
+    return ctx.finalize();
+}
+
+/**
+ * @brief 哈希整个文件：普通文件用 mmap 直接哈希映射区，其它文件（或没有 mmap 时）退回 fread
+ * @throws std::runtime_error 无法打开或读取文件
+ */
+template <typename Context>
+auto hash_file(const std::string &path, Context ctx = Context()) {
+#ifdef FILE_HASH_HAS_MMAP
+    struct stat st {};
+    if (::stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        mapped_file file(path);
+        return ctx.update(file.data(), file.size()).finalize();
+    }
+#endif
+    return hash_file_fread(path, std::move(ctx));
+}
+}  // namespace hashing
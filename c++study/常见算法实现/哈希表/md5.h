@@ -0,0 +1,294 @@
+/**
+ * @file md5.h
+ * @author [tGautot](https://github.com/tGautot)
+ * @brief 简单的C++实现 [MD5哈希算法](https://en.wikipedia.org/wiki/MD5)
+ * @details
+ * [MD5算法](https://en.wikipedia.org/wiki/MD5) 是一个哈希算法，
+ * 由 [Ronal Rivest](https://en.wikipedia.org/wiki/Ron_Rivest) 于1991年设计。
+ *
+ * MD5是使用最广泛的哈希算法之一。一些使用案例包括：
+ *  1. 提供下载软件的校验和
+ *  2. 存储加盐密码
+ *
+ * 然而，MD5在很长一段时间内被认为在加密上存在弱点，但它仍然被广泛使用。
+ * 这一弱点在2012年被 [Flame恶意软件](https://en.wikipedia.org/wiki/Flame_(malware)) 利用。
+ *
+ * ### 算法
+ * 首先，所有值都应以[小端序](https://en.wikipedia.org/wiki/Endianness)存储。
+ * 这在将字节字符串的一部分用作整数时尤为重要。
+ *
+ * 算法的第一步是对消息进行填充，使其长度成为64（字节）的倍数。
+ * 这通过首先添加0x80（10000000），然后添加零，直到最后8字节需要填充，
+ * 最后再添加输入的64位大小。
+ *
+ * 完成后，算法将这个填充消息分解为64字节的块。
+ * 每个块用于一个“轮次”，一轮将块分成16个4字节的块。
+ * 在这些轮次中，算法将更新其128位状态（由4个整数：A、B、C、D表示）。
+ * 有关这些操作的更多详细信息，请参见[维基百科文章](https://en.wikipedia.org/wiki/MD5#Algorithm)。
+ * MD5给出的签名是所有轮次完成后的128位状态。
+ *
+ * ### 流式计算
+ * `context` 可以分多次输入任意长度的数据：完整的 64 字节块直接从调用方的缓冲区（或 mmap 映射的文件）
+ * 读取，只有不足一块的尾部会暂存，填充只作用在最后一两个块上，所以额外内存是常数。
+ * `hash_bs` 也通过它计算，不再把整个输入复制到填充后的 `std::vector`。
+ */
+#pragma once
+
+#include <array>        /// 用于std::array
+#include <cstddef>      /// 用于std::size_t
+#include <cstdint>      /// 用于uint8_t, uint32_t, uint64_t
+#include <cstring>      /// 用于std::memcpy
+#include <string>       /// 用于字符串
+#include <string_view>  /// 用于std::string_view
+
+/**
+ * @namespace hashing
+ * @brief 哈希算法
+ */
+namespace hashing {
+/**
+ * @namespace MD5
+ * @brief [MD5](https://en.wikipedia.org/wiki/MD5) 算法实现的函数
+ */
+namespace md5 {
+/**
+ * @brief 旋转32位无符号整数的位
+ * @param n 需要旋转的整数
+ * @param rotate 旋转的位数
+ * @return uint32_t 旋转后的整数
+ */
+inline uint32_t leftRotate32bits(uint32_t n, std::size_t rotate) {
+    return (n << rotate) | (n >> (32 - rotate));
+}
+
+/**
+ * @brief 检查整数是以大端序存储还是小端序
+ * @note 来自 [this](https://stackoverflow.com/a/1001373) StackOverflow帖子
+ * @return true 如果检测到整数为大端序
+ * @return false 如果检测到整数为小端序
+ */
+inline bool isBigEndian() {
+    union {
+        uint32_t i;
+        std::array<char, 4> c;
+    } bint = {0x01020304};
+
+    return bint.c[0] == 1;
+}
+
+/**
+ * @brief 将32位整数转换为小端序（如有必要）
+ * @param n 需要转换的小端序数（uint32_t）
+ * @return uint32_t 小端序的n
+ */
+inline uint32_t toLittleEndian32(uint32_t n) {
+    if (!isBigEndian()) {
+        return ((n << 24) & 0xFF000000) | ((n << 8) & 0x00FF0000) |
+               ((n >> 8) & 0x0000FF00) | ((n >> 24) & 0x000000FF);
+    }
+    // 机器使用小端序，无需更改
+    return n;
+}
+
+/**
+ * @brief 将64位整数转换为小端序（如有必要）
+ * @param n 需要转换的小端序数（uint64_t）
+ * @return uint64_t 小端序的n
+ */
+inline uint64_t toLittleEndian64(uint64_t n) {
+    if (!isBigEndian()) {
+        return ((n << 56) & 0xFF00000000000000) |
+               ((n << 40) & 0x00FF000000000000) |
+               ((n << 24) & 0x0000FF0000000000) |
+               ((n << 8) & 0x000000FF00000000) |
+               ((n >> 8) & 0x00000000FF000000) |
+               ((n >> 24) & 0x0000000000FF0000) |
+               ((n >> 40) & 0x000000000000FF00) |
+               ((n >> 56) & 0x00000000000000FF);
+    }
+    // 机器使用小端序，无需更改
+    return n;
+}
+
+/**
+ * @brief 将128位MD5签名转换为32个字符的十六进制字符串
+ * @param sig MD5签名（期望为16字节）
+ * @return std::string 十六进制签名
+ */
+inline std::string sig2hex(void* sig) {
+    const char* hexChars = "0123456789abcdef";
+    auto* intsig = static_cast<uint8_t*>(sig);
+    std::string hex = "";
+    for (uint8_t i = 0; i < 16; i++) {
+        hex.push_back(hexChars[(intsig[i] >> 4) & 0xF]);
+        hex.push_back(hexChars[(intsig[i]) & 0xF]);
+    }
+    return hex;
+}
+
+/// s是每轮左旋转时使用的移位值
+inline constexpr std::array<uint32_t, 64> shifts = {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5, 9,  14, 20, 5, 9,  14, 20, 5, 9,  14, 20, 5, 9,  14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+
+/**
+ * @brief K的值是伪随机的，用于“盐”每一轮
+ * 这些值可以通过以下Python代码获得
+ * @code{.py}
+ * from math import floor, sin
+ *
+ * for i in range(64):
+ *     print(floor(2**32 * abs(sin(i+1))))
+ * @endcode
+ */
+inline constexpr std::array<uint32_t, 64> K = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a,
+    0xa8304613, 0xfd469501, 0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821, 0xf61e2562, 0xc040b340,
+    0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8,
+    0x676f02d9, 0x8d2a4c8a, 0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70, 0x289b7ec6, 0xeaa127fa,
+    0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92,
+    0xffeff47d, 0x85845dd1, 0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+
+/// 128位签名
+using digest = std::array<uint8_t, 16>;
+
+/**
+ * @brief 依次处理 data 开始的 blocks 个 64 字节块
+ * @param hash 128位状态（A、B、C、D）
+ */
+inline void compress(std::array<uint32_t, 4>& hash, const uint8_t* data, std::size_t blocks) {
+    for (; blocks > 0; blocks--, data += 64) {
+        // 按小端序读取16个4字节的字，与机器的字节序无关
+        uint32_t block[16];
+        for (int i = 0; i < 16; i++) {
+            block[i] = uint32_t(data[4 * i]) | uint32_t(data[4 * i + 1]) << 8 |
+                       uint32_t(data[4 * i + 2]) << 16 | uint32_t(data[4 * i + 3]) << 24;
+        }
+
+        uint32_t A = hash[0];
+        uint32_t B = hash[1];
+        uint32_t C = hash[2];
+        uint32_t D = hash[3];
+
+        // 进行64轮处理，每16轮换一个F函数与消息字的顺序
+        for (std::size_t j = 0; j < 16; ++j) {
+            uint32_t F = ((B & C) | (~B & D)) + A + K[j] + block[j];
+            A = D, D = C, C = B, B += leftRotate32bits(F, shifts[j]);
+        }
+        for (std::size_t j = 16; j < 32; ++j) {
+            uint32_t F = ((D & B) | (~D & C)) + A + K[j] + block[(5 * j + 1) % 16];
+            A = D, D = C, C = B, B += leftRotate32bits(F, shifts[j]);
+        }
+        for (std::size_t j = 32; j < 48; ++j) {
+            uint32_t F = (B ^ C ^ D) + A + K[j] + block[(3 * j + 5) % 16];
+            A = D, D = C, C = B, B += leftRotate32bits(F, shifts[j]);
+        }
+        for (std::size_t j = 48; j < 64; ++j) {
+            uint32_t F = (C ^ (B | ~D)) + A + K[j] + block[(7 * j) % 16];
+            A = D, D = C, C = B, B += leftRotate32bits(F, shifts[j]);
+        }
+
+        // 更新hash
+        hash[0] += A;
+        hash[1] += B;
+        hash[2] += C;
+        hash[3] += D;
+    }
+}
+
+/**
+ * @class context
+ * @brief 流式MD5：可以多次 `update()`，最后 `finalize()` 得到签名
+ */
+class context {
+ public:
+    context() { reset(); }
+
+    /// 回到初始状态
+    void reset() {
+        hash_ = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476};
+        buffered_ = 0;
+        length_ = 0;
+    }
+
+    /// 追加 size 字节的数据：完整的块直接从 data 处理，不复制
+    context& update(const void* data, std::size_t size) {
+        auto* p = static_cast<const uint8_t*>(data);
+        length_ += size;
+        if (size == 0) return *this;
+        if (buffered_ > 0) {
+            const std::size_t take = size < 64 - buffered_ ? size : 64 - buffered_;
+            std::memcpy(buffer_ + buffered_, p, take);
+            buffered_ += take;
+            p += take;
+            size -= take;
+            if (buffered_ < 64) return *this;
+            compress(hash_, buffer_, 1);
+            buffered_ = 0;
+        }
+        compress(hash_, p, size / 64);
+        p += size / 64 * 64;
+        size %= 64;
+        std::memcpy(buffer_, p, size);
+        buffered_ = size;
+        return *this;
+    }
+
+    context& update(std::string_view data) { return update(data.data(), data.size()); }
+
+    /**
+     * @brief 填充最后的块（0x80、零、小端序的64位长度）并返回签名；之后上下文回到初始状态
+     */
+    digest finalize() {
+        const uint64_t bits = length_ * 8;
+        buffer_[buffered_++] = 0x80;
+        if (buffered_ > 56) {
+            std::memset(buffer_ + buffered_, 0, 64 - buffered_);
+            compress(hash_, buffer_, 1);
+            buffered_ = 0;
+        }
+        std::memset(buffer_ + buffered_, 0, 56 - buffered_);
+        for (int i = 0; i < 8; i++) buffer_[56 + i] = uint8_t(bits >> (8 * i));
+        compress(hash_, buffer_, 1);
+        digest out;
+        for (int i = 0; i < 16; i++) out[i] = uint8_t(hash_[i / 4] >> (8 * (i % 4)));
+        reset();
+        return out;
+    }
+
+ private:
+    std::array<uint32_t, 4> hash_;  ///< 128位状态
+    uint8_t buffer_[64];            ///< 不足一块的输入
+    std::size_t buffered_;          ///< buffer_ 中的字节数
+    uint64_t length_;               ///< 已经输入的字节数
+};
+
+/**
+ * @brief MD5算法本身，接受字节字符串
+ * @param input_bs 需要哈希的字节字符串
+ * @param input_size 输入的大小（以字节为单位）
+ * @return void* 指向128位签名的指针（用 new[] 分配，由调用方释放）
+ */
+inline void* hash_bs(const void* input_bs, uint64_t input_size) {
+    const digest sig = context().update(input_bs, std::size_t(input_size)).finalize();
+    return std::memcpy(new uint8_t[16], sig.data(), 16);  // 返回128位（16字节）
+}
+
+/**
+ * @brief 将给定字符串转换为其MD5哈希值
+ * @param input 需要哈希的输入字符串
+ * @return std::string 字符串的MD5哈希值
+ */
+inline std::string hash(const std::string& input) {
+    digest sig = context().update(input).finalize();
+    return sig2hex(sig.data());
+}
+}  // namespace md5
+}  // namespace hashing
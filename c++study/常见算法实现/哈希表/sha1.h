@@ -0,0 +1,203 @@
+/**
+ * @file sha1.h
+ * @author [tGautot](https://github.com/tGautot)
+ * @brief 简单的C++实现[SHA-1哈希算法](https://en.wikipedia.org/wiki/SHA-1)
+ *
+ * @details
+ * [SHA-1](https://en.wikipedia.org/wiki/SHA-1)是一种加密哈希函数，
+ * 由[NSA](https://en.wikipedia.org/wiki/National_Security_Agency)于1995年开发。
+ * 自2010年起，SHA-1不再被认为是安全的。
+ *
+ * ### 算法
+ * 算法的第一步是对消息进行填充，使其长度成为64的倍数（字节）。首先添加0x80（10000000），
+ * 然后填充零，直到最后8个字节必须填充，最后添加输入的64位大小。
+ *
+ * 一旦完成，该算法将填充的消息分成64字节的块。每个块用于一个*轮次*，轮次将块分解为16个4字节的块。
+ * 这16个块随后通过XOR运算扩展到80个块（具体细节请参见代码）。
+ * 算法将使用之前构建的块的特殊函数计算的部分哈希来更新其160位状态（这里用5个32位整数表示）。
+ * 有关这些操作的更多细节，请参阅[维基百科文章](https://en.wikipedia.org/wiki/SHA-1#SHA-1_pseudocode)。
+ *
+ * ### 流式计算
+ * `context` 可以分多次输入任意长度的数据：完整的 64 字节块直接从调用方的缓冲区（或 mmap 映射的文件）
+ * 读取，只有不足一块的尾部会暂存，填充只作用在最后一两个块上，所以额外内存是常数。
+ * `hash_bs` 也通过它计算，不再把整个输入复制到填充后的 `std::vector`。
+ */
+#pragma once
+
+#include <array>        /// 用于std::array
+#include <cstddef>      /// 用于std::size_t
+#include <cstdint>      /// 用于uint8_t, uint32_t, uint64_t
+#include <cstring>      /// 用于std::memcpy
+#include <string>       /// 用于字符串
+#include <string_view>  /// 用于std::string_view
+
+/**
+ * @namespace hashing
+ * @brief 哈希算法
+ */
+namespace hashing {
+/**
+ * @namespace SHA-1
+ * @brief 实现[SHA-1](https://en.wikipedia.org/wiki/SHA-1)算法的函数
+ */
+namespace sha1 {
+/**
+ * @brief 旋转32位无符号整数的位
+ * @param n 要旋转的整数
+ * @param rotate 旋转的位数
+ * @return uint32_t 旋转后的整数
+ */
+inline uint32_t leftRotate32bits(uint32_t n, std::size_t rotate) {
+    return (n << rotate) | (n >> (32 - rotate));
+}
+
+/**
+ * @brief 将160位SHA-1签名转换为40字符的十六进制字符串
+ * @param sig SHA-1签名（预期为20字节）
+ * @return std::string 十六进制签名
+ */
+inline std::string sig2hex(void* sig) {
+    const char* hexChars = "0123456789abcdef";
+    auto* intsig = static_cast<uint8_t*>(sig);
+    std::string hex = "";
+    for (uint8_t i = 0; i < 20; i++) {
+        hex.push_back(hexChars[(intsig[i] >> 4) & 0xF]);
+        hex.push_back(hexChars[(intsig[i]) & 0xF]);
+    }
+    return hex;
+}
+
+/// 160位签名
+using digest = std::array<uint8_t, 20>;
+
+/**
+ * @brief 依次处理 data 开始的 blocks 个 64 字节块
+ * @param h 160位状态
+ * @details 消息扩展只保留最近16个字的环形缓冲区，与扩展到80个字等价
+ */
+inline void compress(std::array<uint32_t, 5>& h, const uint8_t* data, std::size_t blocks) {
+    for (; blocks > 0; blocks--, data += 64) {
+        // 从块中按大端序构建16个32位字
+        uint32_t w[16];
+        for (int i = 0; i < 16; i++) {
+            w[i] = uint32_t(data[4 * i]) << 24 | uint32_t(data[4 * i + 1]) << 16 |
+                   uint32_t(data[4 * i + 2]) << 8 | uint32_t(data[4 * i + 3]);
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+
+        // 主“哈希”循环：每20轮换一个F函数与常数g；第16轮起就地扩展消息字
+        auto round = [&](std::size_t i, uint32_t F, uint32_t g) {
+            if (i >= 16) {
+                w[i & 15] = leftRotate32bits(
+                    w[(i - 3) & 15] ^ w[(i - 8) & 15] ^ w[(i - 14) & 15] ^ w[i & 15], 1);
+            }
+            // 更新累加器
+            uint32_t temp = leftRotate32bits(a, 5) + F + e + g + w[i & 15];
+            e = d;
+            d = c;
+            c = leftRotate32bits(b, 30);
+            b = a;
+            a = temp;
+        };
+        for (std::size_t i = 0; i < 20; i++) round(i, (b & c) | ((~b) & d), 0x5A827999);
+        for (std::size_t i = 20; i < 40; i++) round(i, b ^ c ^ d, 0x6ED9EBA1);
+        for (std::size_t i = 40; i < 60; i++) round(i, (b & c) | (b & d) | (c & d), 0x8F1BBCDC);
+        for (std::size_t i = 60; i < 80; i++) round(i, b ^ c ^ d, 0xCA62C1D6);
+        // 用这个块的哈希更新状态
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+}
+
+/**
+ * @class context
+ * @brief 流式SHA-1：可以多次 `update()`，最后 `finalize()` 得到签名
+ */
+class context {
+ public:
+    context() { reset(); }
+
+    /// 回到初始状态
+    void reset() {
+        h_ = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+        buffered_ = 0;
+        length_ = 0;
+    }
+
+    /// 追加 size 字节的数据：完整的块直接从 data 处理，不复制
+    context& update(const void* data, std::size_t size) {
+        auto* p = static_cast<const uint8_t*>(data);
+        length_ += size;
+        if (size == 0) return *this;
+        if (buffered_ > 0) {
+            const std::size_t take = size < 64 - buffered_ ? size : 64 - buffered_;
+            std::memcpy(buffer_ + buffered_, p, take);
+            buffered_ += take;
+            p += take;
+            size -= take;
+            if (buffered_ < 64) return *this;
+            compress(h_, buffer_, 1);
+            buffered_ = 0;
+        }
+        compress(h_, p, size / 64);
+        p += size / 64 * 64;
+        size %= 64;
+        std::memcpy(buffer_, p, size);
+        buffered_ = size;
+        return *this;
+    }
+
+    context& update(std::string_view data) { return update(data.data(), data.size()); }
+
+    /**
+     * @brief 填充最后的块（0x80、零、大端序的64位长度）并返回签名；之后上下文回到初始状态
+     */
+    digest finalize() {
+        const uint64_t bits = length_ * 8;
+        buffer_[buffered_++] = 0x80;
+        if (buffered_ > 56) {
+            std::memset(buffer_ + buffered_, 0, 64 - buffered_);
+            compress(h_, buffer_, 1);
+            buffered_ = 0;
+        }
+        std::memset(buffer_ + buffered_, 0, 56 - buffered_);
+        for (int i = 0; i < 8; i++) buffer_[56 + i] = uint8_t(bits >> (56 - 8 * i));
+        compress(h_, buffer_, 1);
+        digest out;
+        for (int i = 0; i < 20; i++) out[i] = uint8_t(h_[i / 4] >> (24 - 8 * (i % 4)));
+        reset();
+        return out;
+    }
+
+ private:
+    std::array<uint32_t, 5> h_;  ///< 160位状态
+    uint8_t buffer_[64];         ///< 不足一块的输入
+    std::size_t buffered_;       ///< buffer_ 中的字节数
+    uint64_t length_;            ///< 已经输入的字节数
+};
+
+/**
+ * @brief SHA-1算法本身，接收字节字符串
+ * @param input_bs 要哈希的字节字符串
+ * @param input_size 输入的大小（以字节为单位）
+ * @return void* 指向160位签名的指针（用 new[] 分配，由调用方释放）
+ */
+inline void* hash_bs(const void* input_bs, uint64_t input_size) {
+    const digest sig = context().update(input_bs, std::size_t(input_size)).finalize();
+    return std::memcpy(new uint8_t[20], sig.data(), 20);
+}
+
+/**
+ * @brief 将字符串转换为字节字符串并调用主算法
+ * @param message 要哈希的普通字符消息
+ * @return void* 指向SHA-1签名的指针
+ */
+inline void* hash(const std::string& message) {
+    return hash_bs(message.data(), message.size());
+}
+}  // namespace sha1
+}  // namespace hashing
@@ -0,0 +1,696 @@
+/**
+ * @file sha256.h
+ * @author [Md. Anisul Haque](https://github.com/mdanisulh)
+ * @brief 简单的 C++ 实现 [SHA-256 哈希算法]
+ * (https://en.wikipedia.org/wiki/SHA-2)，以及流式、SHA-NI 与 AVX2 八路并行的实现
+ *
+ * @details
+ * [SHA-2](https://en.wikipedia.org/wiki/SHA-2) 是一组由
+ * [NSA](https://en.wikipedia.org/wiki/National_Security_Agency) 设计的
+ * 加密哈希函数，首次发布于 2001 年。SHA-256 是 SHA-2 家族的一部分。
+ * SHA-256 广泛用于软件包的认证和安全密码哈希。
+ *
+ * 除了逐字节取填充字符的原始实现（`Hash`、`create_message_schedule_array`），这里还提供：
+ * - `context`：`update()` / `finalize()` 流式接口。完整的 64 字节块直接从调用方的缓冲区压缩，
+ *   只有不足一块的尾部会复制到 64 字节的内部缓冲区，填充只发生在最后一两个块上；
+ * - `compress()`：运行时检测 CPU，支持 [SHA-NI](https://en.wikipedia.org/wiki/Intel_SHA_extensions)
+ *   时使用 `sha256rnds2` 等指令，否则使用可移植的标量实现；
+ * - `hash_many()`：一次哈希多条独立的消息，适合大量小对象的内容寻址。
+ *   AVX2 实现把 8 条消息放在 256 位寄存器的 8 个 32 位通道里同时压缩（多缓冲区），
+ *   用于支持 AVX2 但没有 SHA-NI 的 CPU。
+ *
+ * SHA-NI 与 AVX2 代码用 `__attribute__((target(...)))` 编译，不需要 `-msha` / `-mavx2`，
+ * 在不支持的 CPU 上不会被调用；非 x86 或非 GCC/Clang 编译器上只有可移植实现。
+ */
+#pragma once
+
+#include <algorithm>    /// 用于 std::min, std::max
+#include <array>        /// 用于 std::array
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 uint8_t, uint32_t 和 uint64_t 数据类型
+#include <cstring>      /// 用于 std::memcpy
+#include <iomanip>      /// 用于 std::setfill 和 std::setw
+#include <sstream>      /// 用于 std::stringstream
+#include <stdexcept>    /// 用于 std::out_of_range
+#include <string>       /// 用于 std::string
+#include <string_view>  /// 用于 std::string_view
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA256_X86_DISPATCH 1
+#include <cpuid.h>      /// 用于 __get_cpuid, __get_cpuid_count
+#include <immintrin.h>  /// 用于 SHA-NI 与 AVX2 内置函数
+#else
+#define SHA256_X86_DISPATCH 0
+#endif
+
+/**
+ * @namespace hashing
+ * @brief 哈希算法
+ */
+namespace hashing {
+/**
+ * @namespace SHA-256
+ * @brief 实现 [SHA-256](https://en.wikipedia.org/wiki/SHA-2) 算法的函数
+ */
+namespace sha256 {
+/// 前 64 个质数（2..311）的立方根的小数部分的前 32 位：轮常量
+inline constexpr std::array<uint32_t, 64> round_constants = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1,
+    0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786,
+    0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147,
+    0x06CA6351, 0x14292967, 0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B,
+    0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A,
+    0x5B9CCA4F, 0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
+
+/// 前 8 个质数（2..19）的平方根的小数部分的前 32 位：初始哈希值
+inline constexpr std::array<uint32_t, 8> initial_state = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+/// 32 字节的摘要
+using digest = std::array<uint8_t, 32>;
+
+/**
+ * @class Hash
+ * @brief 包含哈希数组及其更新和转换为十六进制字符串的函数
+ */
+class Hash {
+    // 使用前 8 个质数（2..19）的平方根的小数部分的前 32 位初始化哈希值数组
+    std::array<uint32_t, 8> hash = initial_state;
+
+ public:
+    void update(const std::array<uint32_t, 64> &blocks);
+    std::string to_string() const;
+};
+
+/**
+ * @brief 右旋转 32 位无符号整数的位
+ * @param n 要旋转的整数
+ * @param rotate 旋转的位数
+ * @return uint32_t 旋转后的整数
+ */
+inline uint32_t right_rotate(uint32_t n, size_t rotate) {
+    return (n >> rotate) | (n << (32 - rotate));
+}
+
+/**
+ * @brief 更新哈希数组
+ * @param blocks 消息调度数组
+ * @return void
+ */
+inline void Hash::update(const std::array<uint32_t, 64> &blocks) {
+    // 初始化工作变量
+    auto a = hash[0];
+    auto b = hash[1];
+    auto c = hash[2];
+    auto d = hash[3];
+    auto e = hash[4];
+    auto f = hash[5];
+    auto g = hash[6];
+    auto h = hash[7];
+
+    // 压缩函数主循环
+    for (size_t block_num = 0; block_num < 64; ++block_num) {
+        const auto s1 =
+            right_rotate(e, 6) ^ right_rotate(e, 11) ^ right_rotate(e, 25);
+        const auto ch = (e & f) ^ (~e & g);
+        const auto temp1 =
+            h + s1 + ch + round_constants[block_num] + blocks[block_num];
+        const auto s0 =
+            right_rotate(a, 2) ^ right_rotate(a, 13) ^ right_rotate(a, 22);
+        const auto maj = (a & b) ^ (a & c) ^ (b & c);
+        const auto temp2 = s0 + maj;
+
+        // 更新工作变量
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    // 更新哈希值
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+}
+
+/**
+ * @brief 将哈希值转换为十六进制字符串
+ * @return std::string 最终哈希值
+ */
+inline std::string Hash::to_string() const {
+    std::stringstream ss;
+    for (size_t i = 0; i < 8; ++i) {
+        ss << std::hex << std::setfill('0') << std::setw(8) << hash[i];
+    }
+    return ss.str();
+}
+
+/**
+ * @brief 计算填充输入的大小
+ * @param input 输入字符串
+ * @return size_t 填充后的输入大小
+ */
+inline std::size_t compute_padded_size(const std::size_t input_size) {
+    if (input_size % 64 < 56) {
+        return input_size + 64 - (input_size % 64);
+    }
+    return input_size + 128 - (input_size % 64);
+}
+
+/**
+ * @brief 返回 in_value 中 byte_num 位置的字节
+ * @param in_value 输入值
+ * @param byte_num 要返回的字节的位置
+ * @return uint8_t 位置为 byte_num 的字节
+ */
+template <typename T>
+uint8_t extract_byte(const T in_value, const std::size_t byte_num) {
+    if (sizeof(in_value) <= byte_num) {
+        throw std::out_of_range("Byte at index byte_num does not exist");
+    }
+    return (in_value >> (byte_num * 8)) & 0xFF;
+}
+
+/**
+ * @brief 返回填充后输入位置 pos 的字符
+ * @param input 输入字符串
+ * @param pos 要返回的字符的位置
+ * @return char 填充字符串中索引 pos 的字符
+ */
+inline char get_char(const std::string &input, std::size_t pos) {
+    const auto input_size = input.length();
+    if (pos < input_size) {
+        return input[pos];
+    }
+    if (pos == input_size) {
+        return '\x80';  // 填充位
+    }
+    const auto padded_input_size = compute_padded_size(input_size);
+    if (pos < padded_input_size - 8) {
+        return '\x00';  // 填充零
+    }
+    if (padded_input_size <= pos) {
+        throw std::out_of_range("pos is out of range");
+    }
+    return static_cast<char>(
+        extract_byte<size_t>(input_size * 8, padded_input_size - pos - 1));
+}
+
+/**
+ * @brief 创建消息调度数组
+ * @param input 输入字符串
+ * @param byte_num 块的第一个字节的位置
+ * @return std::array<uint32_t, 64> 消息调度数组
+ */
+inline std::array<uint32_t, 64> create_message_schedule_array(const std::string &input,
+                                                              const size_t byte_num) {
+    std::array<uint32_t, 64> blocks{};
+
+    // 将块复制到消息调度数组的前 16 个字
+    for (size_t block_num = 0; block_num < 16; ++block_num) {
+        blocks[block_num] =
+            (static_cast<uint8_t>(get_char(input, byte_num + block_num * 4))
+             << 24) |
+            (static_cast<uint8_t>(get_char(input, byte_num + block_num * 4 + 1))
+             << 16) |
+            (static_cast<uint8_t>(get_char(input, byte_num + block_num * 4 + 2))
+             << 8) |
+            static_cast<uint8_t>(get_char(input, byte_num + block_num * 4 + 3));
+    }
+
+    // 将前 16 个字扩展到消息调度数组的剩余 48 个字
+    for (size_t block_num = 16; block_num < 64; ++block_num) {
+        const auto s0 = right_rotate(blocks[block_num - 15], 7) ^
+                        right_rotate(blocks[block_num - 15], 18) ^
+                        (blocks[block_num - 15] >> 3);
+        const auto s1 = right_rotate(blocks[block_num - 2], 17) ^
+                        right_rotate(blocks[block_num - 2], 19) ^
+                        (blocks[block_num - 2] >> 10);
+        blocks[block_num] =
+            blocks[block_num - 16] + s0 + blocks[block_num - 7] + s1;
+    }
+
+    return blocks;
+}
+
+/**
+ * @brief 压缩函数的实现
+ */
+enum class implementation {
+    portable,  ///< 标量实现
+    sha_ni,    ///< Intel SHA 扩展
+    avx2_x8,   ///< AVX2，8 条消息并行（只用于 `hash_many`）
+};
+
+/**
+ * @brief 实现的名字，用于输出
+ */
+inline const char *name(implementation impl) {
+    switch (impl) {
+        case implementation::sha_ni:
+            return "SHA-NI";
+        case implementation::avx2_x8:
+            return "AVX2 x8";
+        default:
+            return "portable";
+    }
+}
+
+namespace detail {
+inline uint32_t load_be32(const uint8_t *p) {
+    return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | uint32_t(p[3]);
+}
+
+inline void store_be32(uint8_t *p, uint32_t v) {
+    p[0] = uint8_t(v >> 24);
+    p[1] = uint8_t(v >> 16);
+    p[2] = uint8_t(v >> 8);
+    p[3] = uint8_t(v);
+}
+
+/**
+ * @brief 可移植实现：依次压缩 data 开始的 blocks 个 64 字节块
+ * @details 消息调度只保留最近 16 个字的环形缓冲区，与 `Hash::update` 的 64 字数组等价
+ */
+inline void compress_portable(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    for (; blocks > 0; blocks--, data += 64) {
+        uint32_t w[16];
+        for (size_t i = 0; i < 16; i++) w[i] = load_be32(data + 4 * i);
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t t = 0; t < 64; t++) {
+            if (t >= 16) {
+                const uint32_t w15 = w[(t - 15) & 15], w2 = w[(t - 2) & 15];
+                const uint32_t s0 = right_rotate(w15, 7) ^ right_rotate(w15, 18) ^ (w15 >> 3);
+                const uint32_t s1 = right_rotate(w2, 17) ^ right_rotate(w2, 19) ^ (w2 >> 10);
+                w[t & 15] += s0 + w[(t - 7) & 15] + s1;
+            }
+            const uint32_t s1 = right_rotate(e, 6) ^ right_rotate(e, 11) ^ right_rotate(e, 25);
+            const uint32_t temp1 = h + s1 + ((e & f) ^ (~e & g)) + round_constants[t] + w[t & 15];
+            const uint32_t s0 = right_rotate(a, 2) ^ right_rotate(a, 13) ^ right_rotate(a, 22);
+            const uint32_t temp2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#if SHA256_X86_DISPATCH
+/**
+ * @brief SHA-NI 实现
+ * @details 状态按 sha256rnds2 的要求排成 ABEF 与 CDGH 两个寄存器；每组 4 轮先算出 W[4g..4g+3]：
+ * W = msg2(msg1(W[g-4], W[g-3]) + alignr(W[g-1], W[g-2]), W[g-1])，再加上轮常量做两次 rnds2
+ */
+__attribute__((target("sha,sse4.1,ssse3"))) inline void compress_sha_ni(uint32_t state[8],
+                                                                        const uint8_t *data,
+                                                                        size_t blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0xB1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)), 0x1B);
+    __m128i abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xF0);
+
+    for (; blocks > 0; blocks--, data += 64) {
+        const __m128i abef_save = abef, cdgh_save = cdgh;
+        __m128i w[4];
+        for (int g = 0; g < 16; g++) {
+            if (g < 4) {
+                w[g] = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * g)), byte_swap);
+            } else {
+                __m128i x = _mm_sha256msg1_epu32(w[g & 3], w[(g + 1) & 3]);
+                x = _mm_add_epi32(x, _mm_alignr_epi8(w[(g + 3) & 3], w[(g + 2) & 3], 4));
+                w[g & 3] = _mm_sha256msg2_epu32(x, w[(g + 3) & 3]);
+            }
+            __m128i k = _mm_add_epi32(
+                w[g & 3], _mm_loadu_si128(reinterpret_cast<const __m128i *>(&round_constants[4 * g])));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0E));
+        }
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1B);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_blend_epi16(tmp, cdgh, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+/// 8 个 32 位通道各自右旋转 N 位
+template <int N>
+__attribute__((target("avx2"))) inline __m256i rotr_x8(__m256i x) {
+    return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+}
+
+/**
+ * @brief AVX2 八路实现：lanes[j] 是第 j 条消息当前块的地址，active 中对应位为 0 的通道不更新状态
+ * @param state state[i] 的第 j 个 32 位通道是第 j 条消息的第 i 个状态字
+ */
+__attribute__((target("avx2"))) inline void compress_x8(__m256i state[8],
+                                                        const uint8_t *const lanes[8],
+                                                        __m256i active) {
+    const __m256i byte_swap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+                                                0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    // 把 8 条消息的 8 个字转置成 8 个“同一位置的字”向量
+    __m256i w[16];
+    for (int half = 0; half < 2; half++) {
+        __m256i r[8];
+        for (int j = 0; j < 8; j++) {
+            r[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lanes[j] + 32 * half));
+        }
+        __m256i t[8], u[8];
+        for (int j = 0; j < 8; j += 2) {
+            t[j] = _mm256_unpacklo_epi32(r[j], r[j + 1]);
+            t[j + 1] = _mm256_unpackhi_epi32(r[j], r[j + 1]);
+        }
+        for (int j = 0; j < 8; j += 4) {
+            u[j] = _mm256_unpacklo_epi64(t[j], t[j + 2]);
+            u[j + 1] = _mm256_unpackhi_epi64(t[j], t[j + 2]);
+            u[j + 2] = _mm256_unpacklo_epi64(t[j + 1], t[j + 3]);
+            u[j + 3] = _mm256_unpackhi_epi64(t[j + 1], t[j + 3]);
+        }
+        for (int j = 0; j < 4; j++) {
+            w[8 * half + j] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[j], u[j + 4], 0x20), byte_swap);
+            w[8 * half + j + 4] =
+                _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[j], u[j + 4], 0x31), byte_swap);
+        }
+    }
+
+    __m256i a = state[0], b = state[1], c = state[2], d = state[3];
+    __m256i e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; t++) {
+        if (t >= 16) {
+            const __m256i w15 = w[(t - 15) & 15], w2 = w[(t - 2) & 15];
+            const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<7>(w15), rotr_x8<18>(w15)),
+                                                _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<17>(w2), rotr_x8<19>(w2)),
+                                                _mm256_srli_epi32(w2, 10));
+            w[t & 15] = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], s0),
+                                         _mm256_add_epi32(w[(t - 7) & 15], s1));
+        }
+        const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<6>(e), rotr_x8<11>(e)), rotr_x8<25>(e));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const __m256i temp1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, s1), _mm256_add_epi32(ch, w[t & 15])),
+            _mm256_set1_epi32(int(round_constants[t])));
+        const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<2>(a), rotr_x8<13>(a)), rotr_x8<22>(a));
+        const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(temp1, _mm256_add_epi32(s0, maj));
+    }
+    const __m256i out[8] = {a, b, c, d, e, f, g, h};
+    for (int i = 0; i < 8; i++) {
+        state[i] = _mm256_blendv_epi8(state[i], _mm256_add_epi32(state[i], out[i]), active);
+    }
+}
+
+/// 运行时检测 SHA-NI（连同它依赖的 SSSE3 与 SSE4.1）
+inline bool cpu_has_sha_ni() {
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+    if (!(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1)) return false;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+    return (ebx & bit_SHA) != 0;
+}
+
+/// 运行时检测 AVX2（__builtin_cpu_supports 同时检查操作系统是否保存 YMM 寄存器）
+inline bool cpu_has_avx2() { return __builtin_cpu_supports("avx2"); }
+#else
+inline bool cpu_has_sha_ni() { return false; }
+inline bool cpu_has_avx2() { return false; }
+#endif
+}  // namespace detail
+
+/**
+ * @brief 当前 CPU 是否支持某种实现
+ * @details `cpuid` 在虚拟机中会陷入 hypervisor，一次要几微秒，比哈希一条短消息还慢得多；
+ * 所以检测结果保存在函数内的静态变量中，只在第一次调用时执行 `cpuid`。
+ */
+inline bool supported(implementation impl) {
+    static const bool has_sha_ni = detail::cpu_has_sha_ni();
+    static const bool has_avx2 = detail::cpu_has_avx2();
+    switch (impl) {
+        case implementation::sha_ni:
+            return has_sha_ni;
+        case implementation::avx2_x8:
+            return has_avx2;
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief 单条消息使用的实现：支持 SHA-NI 时用 SHA-NI，否则用可移植实现（只检测一次）
+ */
+inline implementation single_buffer_implementation() {
+    static const implementation impl =
+        supported(implementation::sha_ni) ? implementation::sha_ni : implementation::portable;
+    return impl;
+}
+
+/**
+ * @brief 用指定的实现压缩 blocks 个 64 字节块
+ * @param impl 不能是 `avx2_x8`，且必须被当前 CPU 支持
+ */
+inline void compress(implementation impl, uint32_t state[8], const uint8_t *data, size_t blocks) {
+#if SHA256_X86_DISPATCH
+    if (impl == implementation::sha_ni) return detail::compress_sha_ni(state, data, blocks);
+#endif
+    (void)impl;
+    detail::compress_portable(state, data, blocks);
+}
+
+/**
+ * @brief 用运行时选出的最快实现压缩 blocks 个 64 字节块
+ */
+inline void compress(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    compress(single_buffer_implementation(), state, data, blocks);
+}
+
+/**
+ * @class context
+ * @brief 流式 SHA-256：可以多次 `update()`，最后 `finalize()` 得到摘要
+ * @details 完整的块直接从调用方的缓冲区压缩，不复制输入；只有不足 64 字节的部分会暂存在内部缓冲区
+ */
+class context {
+ public:
+    /**
+     * @param impl 压缩函数的实现，默认为运行时选出的最快实现
+     */
+    explicit context(implementation impl = single_buffer_implementation()) : impl_(impl) {
+        if (impl == implementation::avx2_x8 || !supported(impl)) {
+            throw std::invalid_argument("当前 CPU 不支持这种 SHA-256 实现");
+        }
+        reset();
+    }
+
+    /// 回到初始状态
+    void reset() {
+        std::memcpy(state_, initial_state.data(), sizeof(state_));
+        buffered_ = 0;
+        length_ = 0;
+    }
+
+    /// 追加 size 字节的数据
+    context &update(const void *data, size_t size) {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        length_ += size;
+        if (size == 0) return *this;
+        if (buffered_ > 0) {
+            const size_t take = std::min(size, 64 - buffered_);
+            std::memcpy(buffer_ + buffered_, p, take);
+            buffered_ += take;
+            p += take;
+            size -= take;
+            if (buffered_ < 64) return *this;
+            compress(impl_, state_, buffer_, 1);
+            buffered_ = 0;
+        }
+        if (size >= 64) {
+            compress(impl_, state_, p, size / 64);
+            p += size / 64 * 64;
+            size %= 64;
+        }
+        std::memcpy(buffer_, p, size);
+        buffered_ = size;
+        return *this;
+    }
+
+    context &update(std::string_view data) { return update(data.data(), data.size()); }
+
+    /**
+     * @brief 填充最后的块并返回摘要；之后上下文回到初始状态，可以继续使用
+     */
+    digest finalize() {
+        const uint64_t bits = length_ * 8;
+        buffer_[buffered_++] = 0x80;
+        if (buffered_ > 56) {
+            std::memset(buffer_ + buffered_, 0, 64 - buffered_);
+            compress(impl_, state_, buffer_, 1);
+            buffered_ = 0;
+        }
+        std::memset(buffer_ + buffered_, 0, 56 - buffered_);
+        for (int i = 0; i < 8; i++) buffer_[56 + i] = uint8_t(bits >> (56 - 8 * i));
+        compress(impl_, state_, buffer_, 1);
+        digest out;
+        for (int i = 0; i < 8; i++) detail::store_be32(&out[4 * i], state_[i]);
+        reset();
+        return out;
+    }
+
+ private:
+    implementation impl_;  ///< 压缩函数的实现
+    uint32_t state_[8];    ///< 哈希状态
+    uint8_t buffer_[64];   ///< 不足一块的输入
+    size_t buffered_;      ///< buffer_ 中的字节数
+    uint64_t length_;      ///< 已经输入的字节数
+};
+
+/**
+ * @brief 计算一条消息的摘要
+ */
+inline digest hash(std::string_view message) { return context().update(message).finalize(); }
+
+/**
+ * @brief 摘要的小写十六进制表示
+ */
+inline std::string to_hex(const digest &d) {
+    static const char digits[] = "0123456789abcdef";
+    std::string s(64, '0');
+    for (size_t i = 0; i < 32; i++) {
+        s[2 * i] = digits[d[i] >> 4];
+        s[2 * i + 1] = digits[d[i] & 15];
+    }
+    return s;
+}
+
+#if SHA256_X86_DISPATCH
+namespace detail {
+/**
+ * @brief 用 AVX2 同时哈希最多 8 条消息（不足 8 条时空出的通道不参与）
+ * @details 每条消息的完整块直接从原缓冲区读取，最后一两个填充块在栈上的 128 字节缓冲区中构造。
+ * 各条消息的块数不同：已经结束的通道读取一个全零块，并且不更新状态
+ */
+__attribute__((target("avx2"))) inline void hash_x8(const std::string_view *messages, size_t count,
+                                                    digest *out) {
+    alignas(32) static const uint8_t zero_block[64] = {};
+    alignas(32) uint8_t tails[8][128];
+    size_t full[8], blocks[8], max_blocks = 0;
+    for (size_t j = 0; j < 8; j++) {
+        if (j >= count) {
+            full[j] = blocks[j] = 0;
+            continue;
+        }
+        const size_t n = messages[j].size(), rest = n % 64;
+        full[j] = n / 64;
+        const size_t tail_blocks = rest < 56 ? 1 : 2;
+        blocks[j] = full[j] + tail_blocks;
+        max_blocks = std::max(max_blocks, blocks[j]);
+        uint8_t *tail = tails[j];
+        if (rest) std::memcpy(tail, messages[j].data() + full[j] * 64, rest);  // 空消息的 data() 可以是空指针
+        tail[rest] = 0x80;
+        std::memset(tail + rest + 1, 0, 64 * tail_blocks - rest - 1);
+        const uint64_t bits = uint64_t(n) * 8;
+        for (int i = 0; i < 8; i++) tail[64 * tail_blocks - 8 + i] = uint8_t(bits >> (56 - 8 * i));
+    }
+    __m256i state[8];
+    for (int i = 0; i < 8; i++) state[i] = _mm256_set1_epi32(int(initial_state[i]));
+    for (size_t b = 0; b < max_blocks; b++) {
+        const uint8_t *lanes[8];
+        alignas(32) int32_t active[8];
+        for (size_t j = 0; j < 8; j++) {
+            active[j] = b < blocks[j] ? -1 : 0;
+            if (b < full[j]) {
+                lanes[j] = reinterpret_cast<const uint8_t *>(messages[j].data()) + 64 * b;
+            } else if (b < blocks[j]) {
+                lanes[j] = tails[j] + 64 * (b - full[j]);
+            } else {
+                lanes[j] = zero_block;
+            }
+        }
+        compress_x8(state, lanes, _mm256_load_si256(reinterpret_cast<const __m256i *>(active)));
+    }
+    alignas(32) uint32_t words[8][8];
+    for (int i = 0; i < 8; i++) _mm256_store_si256(reinterpret_cast<__m256i *>(words[i]), state[i]);
+    for (size_t j = 0; j < count; j++) {
+        for (int i = 0; i < 8; i++) store_be32(&out[j][4 * i], words[i][j]);
+    }
+}
+}  // namespace detail
+#endif
+
+/**
+ * @brief 多条消息使用的实现（只检测一次）
+ * @details SHA-NI 每条消息的吞吐量高于 AVX2 八路并行，所以只在没有 SHA-NI 的 CPU 上使用 AVX2
+ */
+inline implementation multi_buffer_implementation() {
+    static const implementation impl =
+        supported(implementation::sha_ni) || !supported(implementation::avx2_x8)
+            ? single_buffer_implementation()
+            : implementation::avx2_x8;
+    return impl;
+}
+
+/**
+ * @brief 计算 count 条独立消息的摘要，out[i] 对应 messages[i]
+ * @param impl 使用的实现，必须被当前 CPU 支持
+ */
+inline void hash_many(const std::string_view *messages, size_t count, digest *out,
+                      implementation impl = multi_buffer_implementation()) {
+    if (!supported(impl)) throw std::invalid_argument("当前 CPU 不支持这种 SHA-256 实现");
+#if SHA256_X86_DISPATCH
+    if (impl == implementation::avx2_x8) {
+        for (size_t i = 0; i < count; i += 8) {
+            detail::hash_x8(messages + i, std::min<size_t>(8, count - i), out + i);
+        }
+        return;
+    }
+#endif
+    context ctx(impl);
+    for (size_t i = 0; i < count; i++) out[i] = ctx.update(messages[i]).finalize();
+}
+
+/**
+ * @brief 计算最终哈希值
+ * @param input 输入字符串
+ * @return std::string 最终哈希值
+ */
+inline std::string sha256(const std::string &input) { return to_hex(hash(input)); }
+}  // namespace sha256
+}  // namespace hashing
@@ -0,0 +1,615 @@
+/**
+ * @file swiss_table.h
+ * @brief 开放地址法的通用哈希表 `HashMap<K, V, Hash, KeyEqual>`（Swiss table 风格）
+ * @details
+ * `linear_probing.h`、`quadratic_probing.h`、`double_hashing.h` 中的演示把 `int` 键直接放在一个
+ * 全局的 `std::vector<Entry>` 里，用特殊键值表示空位和墓碑，扩容时把每个条目重新 add 一遍。
+ * 这里的实现（参考 Abseil 的 `flat_hash_map`）：
+ *
+ * - **元数据与槽分开存放**：每个槽对应一个控制字节，空位为 0x80、墓碑为 0xFE，
+ *   有元素时为哈希值的低 7 位（H2）。键值对放在另一块未初始化的内存里，只有占用的槽才构造对象，
+ *   键可以是任意类型，不需要保留特殊键值。
+ * - **按组探测**：16 个控制字节为一组，用 SSE2 一条比较指令得到组内所有 H2 相同的槽的位掩码，
+ *   只有这些槽才比较键（误判率约 1/128）；组内有空位时查找结束。
+ *   哈希值的高位（H1）选择起始组，之后按三角数跳组（组数是 2 的幂，能走遍所有组）。
+ *   没有 SSE2 时逐字节比较，结果相同。
+ * - **可配置的最大负载因子**：`max_load_factor()` 限制"元素 + 墓碑"占槽位的比例，默认 7/8。
+ *   删除时如果所在组还有空位，直接标成空位而不是墓碑（查找不可能越过这个组）。
+ * - **渐进式扩容**：超过负载上限时分配新表，旧表保留下来，之后每次插入顺带迁移旧表的
+ *   `kMigrateGroups` 个组，把一次 O(n) 的停顿摊到后续插入上；迁移期间查找和删除同时检查两张表。
+ *   `incremental_resize(false)` 恢复成一次性迁移。
+ * - **异构查找**：`Hash` 和 `KeyEqual` 都声明了 `is_transparent` 时，`find`/`contains`/`count`/`erase`
+ *   接受任何可以与键比较的类型，例如用 `std::string_view` 查 `std::string` 键而不构造临时字符串
+ *   （见 `string_hash`）。
+ *
+ * 默认的哈希函数是 `fast_hash::hasher<K>`（见 `fast_hash.h`）。
+ * 用户的哈希值会再经过一次乘法混合，所以 `std::hash<int>` 这样的恒等哈希也能把 H1、H2 分散开。
+ * 插入、扩容和 `clear` 会使迭代器失效；删除不会使其它元素的迭代器失效。
+ * 扩容时键通过 `value_type` 的移动构造搬到新表，`const K` 部分因此会被复制。
+ */
+#pragma once
+
+#include <cstddef>      /// 用于 size_t
+#include <cstdint>      /// 用于 int8_t, uint32_t, uint64_t
+#include <cstring>      /// 用于 std::memset
+#include <functional>   /// 用于 std::hash, std::equal_to
+#include <iterator>     /// 用于 std::forward_iterator_tag
+#include <memory>       /// 用于 std::allocator
+#include <new>          /// 用于 placement new
+#include <stdexcept>    /// 用于 std::out_of_range, std::invalid_argument
+#include <string_view>  /// 用于 std::string_view
+#include <tuple>        /// 用于 std::forward_as_tuple
+#include <type_traits>  /// 用于 std::void_t, std::conditional_t
+#include <utility>      /// 用于 std::pair, std::move, std::swap
+
+#include "./fast_hash.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @addtogroup open_addressing 开放地址法
+ * @{
+ * @namespace swiss_table
+ * @brief 按 16 字节控制组探测的开放地址哈希表
+ */
+namespace swiss_table {
+constexpr size_t kGroupWidth = 16;    ///< 一组的控制字节数
+constexpr size_t kMigrateGroups = 4;  ///< 渐进式扩容时每次插入迁移的组数
+constexpr int8_t kEmpty = -128;       ///< 空位（0x80）
+constexpr int8_t kDeleted = -2;       ///< 墓碑（0xFE）
+
+/**
+ * @brief 16 个控制字节，返回满足条件的槽的位掩码（第 i 位对应组内第 i 个槽）
+ */
+class group {
+ public:
+    explicit group(const int8_t *ctrl) {
+#if defined(__SSE2__)
+        ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+        std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+    }
+
+    /// 控制字节等于 h2 的槽
+    uint32_t match(int8_t h2) const {
+#if defined(__SSE2__)
+        return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; i++) mask |= uint32_t(ctrl_[i] == h2) << i;
+        return mask;
+#endif
+    }
+
+    /// 空位
+    uint32_t match_empty() const { return match(kEmpty); }
+
+    /// 空位或墓碑（最高位为 1 的控制字节）
+    uint32_t match_empty_or_deleted() const {
+#if defined(__SSE2__)
+        return uint32_t(_mm_movemask_epi8(ctrl_));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; i++) mask |= uint32_t(ctrl_[i] < 0) << i;
+        return mask;
+#endif
+    }
+
+ private:
+#if defined(__SSE2__)
+    __m128i ctrl_;
+#else
+    int8_t ctrl_[kGroupWidth];
+#endif
+};
+
+/**
+ * @brief 透明的字符串哈希：`HashMap<std::string, V, string_hash, std::equal_to<>>`
+ * 可以直接用 `std::string_view` 或字符串字面量查找
+ */
+struct string_hash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view s) const { return size_t(fast_hash::hash_bytes(s)); }
+};
+
+/**
+ * @brief Swiss table 风格的哈希表
+ * @tparam K 键
+ * @tparam V 值
+ * @tparam Hash 哈希函数
+ * @tparam KeyEqual 键的相等比较
+ */
+template <typename K, typename V, typename Hash = fast_hash::hasher<K>,
+          typename KeyEqual = std::equal_to<K>>
+class HashMap {
+    /// 哈希与比较都透明时才开放异构查找
+    template <typename H, typename E, typename = void>
+    struct transparent : std::false_type {};
+    template <typename H, typename E>
+    struct transparent<H, E, std::void_t<typename H::is_transparent, typename E::is_transparent>>
+        : std::true_type {};
+    template <typename H>
+    using if_transparent = std::enable_if_t<transparent<H, KeyEqual>::value>;
+
+ public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+
+ private:
+    /**
+     * @brief 一张表：控制字节与槽分开分配
+     */
+    struct table {
+        int8_t *ctrl = nullptr;       ///< groups * kGroupWidth 个控制字节
+        value_type *slots = nullptr;  ///< 与控制字节一一对应的槽（只有占用的槽构造了对象）
+        size_t groups = 0;            ///< 组数，0 或 2 的幂
+        size_t size = 0;              ///< 元素个数
+        size_t used = 0;              ///< 元素 + 墓碑
+        size_t limit = 0;             ///< used 的上限（由最大负载因子决定）
+
+        size_t capacity() const { return groups * kGroupWidth; }
+    };
+
+    template <bool Const>
+    class basic_iterator {
+        using map_type = std::conditional_t<Const, const HashMap, HashMap>;
+
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename HashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const value_type &, value_type &>;
+        using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+
+        basic_iterator() = default;
+        /// 非 const 迭代器可以转换成 const 迭代器
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false> &other)  // NOLINT(runtime/explicit)
+            : map_(other.map_), which_(other.which_), index_(other.index_) {}
+
+        reference operator*() const { return map_->table_at(which_).slots[index_]; }
+        pointer operator->() const { return &**this; }
+
+        basic_iterator &operator++() {
+            index_++;
+            skip_empty();
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const basic_iterator &other) const {
+            return which_ == other.which_ && index_ == other.index_;
+        }
+        bool operator!=(const basic_iterator &other) const { return !(*this == other); }
+
+     private:
+        friend class HashMap;
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(map_type *map, int which, size_t index)
+            : map_(map), which_(which), index_(index) {}
+
+        /// 前进到下一个占用的槽；当前表走完后进入旧表，两张表都走完后是 end()
+        void skip_empty() {
+            while (which_ < 2) {
+                const table &t = map_->table_at(which_);
+                while (index_ < t.capacity() && t.ctrl[index_] < 0) index_++;
+                if (index_ < t.capacity()) return;
+                which_++;
+                index_ = 0;
+            }
+        }
+
+        map_type *map_ = nullptr;
+        int which_ = 2;     ///< 0：当前表，1：正在迁移的旧表，2：end()
+        size_t index_ = 0;  ///< 槽号
+    };
+
+ public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    HashMap() = default;
+
+    explicit HashMap(size_t bucket_count, const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual())
+        : hash_(hash), equal_(equal) {
+        reserve(bucket_count);
+    }
+
+    HashMap(const HashMap &other)
+        : hash_(other.hash_), equal_(other.equal_), max_load_(other.max_load_),
+          incremental_(other.incremental_) {
+        reserve(other.size());
+        for (const auto &kv : other) insert(kv);
+    }
+
+    HashMap(HashMap &&other) noexcept { swap(other); }
+
+    HashMap &operator=(HashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~HashMap() {
+        destroy(&cur_);
+        destroy(&old_);
+    }
+
+    void swap(HashMap &other) noexcept {
+        std::swap(cur_, other.cur_);
+        std::swap(old_, other.old_);
+        std::swap(migrate_pos_, other.migrate_pos_);
+        std::swap(hash_, other.hash_);
+        std::swap(equal_, other.equal_);
+        std::swap(max_load_, other.max_load_);
+        std::swap(incremental_, other.incremental_);
+    }
+
+    iterator begin() { return first(iterator(this, 0, 0)); }
+    iterator end() { return iterator(this, 2, 0); }
+    const_iterator begin() const { return first(const_iterator(this, 0, 0)); }
+    const_iterator end() const { return const_iterator(this, 2, 0); }
+
+    size_t size() const { return cur_.size + old_.size; }
+    bool empty() const { return size() == 0; }
+
+    /// 当前表的槽数（迁移期间不含旧表）
+    size_t capacity() const { return cur_.capacity(); }
+
+    float load_factor() const { return capacity() ? float(cur_.size) / float(capacity()) : 0.0f; }
+
+    float max_load_factor() const { return max_load_; }
+
+    /**
+     * @brief 设置最大负载因子（元素与墓碑占槽位的比例上限）
+     * @throws std::invalid_argument 不在 [1/16, 15/16] 内
+     */
+    void max_load_factor(float ml) {
+        if (!(ml >= 1.0f / 16 && ml <= 15.0f / 16)) {
+            throw std::invalid_argument("最大负载因子必须在 [1/16, 15/16] 内");
+        }
+        max_load_ = ml;
+        cur_.limit = limit_for(cur_.capacity());
+    }
+
+    bool incremental_resize() const { return incremental_; }
+
+    /// 关闭渐进式扩容时，立即完成尚未结束的迁移
+    void incremental_resize(bool enabled) {
+        incremental_ = enabled;
+        if (!enabled) finish_migration();
+    }
+
+    /// 是否有尚未迁移完的旧表
+    bool migrating() const { return old_.groups != 0; }
+
+    /**
+     * @brief 预留至少能放下 n 个元素的空间（一次性完成迁移）
+     */
+    void reserve(size_t n) {
+        finish_migration();
+        size_t groups = cur_.groups ? cur_.groups : 1;
+        while (limit_for(groups * kGroupWidth) < n) groups *= 2;
+        if (groups != cur_.groups) {
+            start_resize(groups);
+            finish_migration();
+        }
+    }
+
+    void clear() {
+        destroy(&old_);
+        migrate_pos_ = 0;
+        for (size_t i = 0; i < cur_.capacity(); i++) {
+            if (cur_.ctrl[i] >= 0) cur_.slots[i].~value_type();
+        }
+        if (cur_.ctrl) std::memset(cur_.ctrl, uint8_t(kEmpty), cur_.capacity());
+        cur_.size = cur_.used = 0;
+    }
+
+    /**
+     * @brief 键不存在时用 args 构造值并插入
+     * @returns 指向该键的迭代器，以及是否插入了新元素
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K &key, Args &&...args) {
+        return emplace_impl(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(K &&key, Args &&...args) {
+        return emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type &kv) { return try_emplace(kv.first, kv.second); }
+
+    std::pair<iterator, bool> insert(value_type &&kv) {
+        return try_emplace(kv.first, std::move(kv.second));
+    }
+
+    /**
+     * @brief 插入或覆盖
+     */
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const K &key, M &&value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) result.first->second = std::forward<M>(value);
+        return result;
+    }
+
+    V &operator[](const K &key) { return try_emplace(key).first->second; }
+    V &operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+    /**
+     * @throws std::out_of_range 键不存在
+     */
+    V &at(const K &key) {
+        auto it = find(key);
+        if (it == end()) throw std::out_of_range("键不存在");
+        return it->second;
+    }
+
+    const V &at(const K &key) const {
+        auto it = find(key);
+        if (it == end()) throw std::out_of_range("键不存在");
+        return it->second;
+    }
+
+    iterator find(const K &key) { return find_impl<iterator>(this, key); }
+    const_iterator find(const K &key) const { return find_impl<const_iterator>(this, key); }
+
+    /// 异构查找：Hash 与 KeyEqual 都透明时可用
+    template <typename Q, typename H = Hash, typename = if_transparent<H>>
+    iterator find(const Q &key) {
+        return find_impl<iterator>(this, key);
+    }
+
+    template <typename Q, typename H = Hash, typename = if_transparent<H>>
+    const_iterator find(const Q &key) const {
+        return find_impl<const_iterator>(this, key);
+    }
+
+    bool contains(const K &key) const { return find(key) != end(); }
+
+    template <typename Q, typename H = Hash, typename = if_transparent<H>>
+    bool contains(const Q &key) const {
+        return find(key) != end();
+    }
+
+    size_t count(const K &key) const { return contains(key) ? 1 : 0; }
+
+    template <typename Q, typename H = Hash, typename = if_transparent<H>>
+    size_t count(const Q &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief 删除迭代器指向的元素，其它迭代器仍然有效
+     */
+    void erase(iterator it) { erase_slot(it.which_, it.index_); }
+
+    /**
+     * @returns 删除的元素个数（0 或 1）
+     */
+    size_t erase(const K &key) { return erase_impl(key); }
+
+    template <typename Q, typename H = Hash, typename = if_transparent<H>>
+    size_t erase(const Q &key) {
+        return erase_impl(key);
+    }
+
+ private:
+    /// 混合用户哈希：乘以 2^64 / φ 后把高 32 位折到低位，H2 与 H1 都依赖全部输入位
+    template <typename Q>
+    size_t hash_of(const Q &key) const {
+        uint64_t h = uint64_t(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+        return size_t(h ^ (h >> 32));
+    }
+
+    static int8_t h2(size_t h) { return int8_t(h & 0x7F); }
+
+    size_t limit_for(size_t capacity) const {
+        if (capacity == 0) return 0;
+        size_t limit = size_t(double(capacity) * max_load_);
+        return limit == 0 ? 1 : limit;
+    }
+
+    table &table_at(int which) { return which == 0 ? cur_ : old_; }
+    const table &table_at(int which) const { return which == 0 ? cur_ : old_; }
+
+    template <typename It>
+    static It first(It it) {
+        it.skip_empty();
+        return it;
+    }
+
+    /**
+     * @brief 在一张表中查找键
+     * @returns 槽号，找不到时为 npos
+     */
+    template <typename Q>
+    size_t find_in(const table &t, const Q &key, size_t h) const {
+        if (t.groups == 0) return npos;
+        const size_t mask = t.groups - 1;
+        size_t g = (h >> 7) & mask;
+        for (size_t step = 1;; step++) {
+            const group grp(t.ctrl + g * kGroupWidth);
+            for (uint32_t m = grp.match(h2(h)); m; m &= m - 1) {
+                const size_t i = g * kGroupWidth + __builtin_ctz(m);
+                if (equal_(t.slots[i].first, key)) return i;
+            }
+            if (grp.match_empty()) return npos;
+            g = (g + step) & mask;
+        }
+    }
+
+    /**
+     * @brief 找到键 h 的第一个空位或墓碑（调用方保证键不在表中、表中有空位）
+     */
+    static size_t find_slot(const table &t, size_t h) {
+        const size_t mask = t.groups - 1;
+        size_t g = (h >> 7) & mask;
+        for (size_t step = 1;; step++) {
+            const uint32_t m = group(t.ctrl + g * kGroupWidth).match_empty_or_deleted();
+            if (m) return g * kGroupWidth + __builtin_ctz(m);
+            g = (g + step) & mask;
+        }
+    }
+
+    template <typename It, typename Map, typename Q>
+    static It find_impl(Map *map, const Q &key) {
+        const size_t h = map->hash_of(key);
+        size_t i = map->find_in(map->cur_, key, h);
+        if (i != npos) return It(map, 0, i);
+        if (map->migrating()) {
+            i = map->find_in(map->old_, key, h);
+            if (i != npos) return It(map, 1, i);
+        }
+        return It(map, 2, 0);
+    }
+
+    template <typename KeyArg, typename... Args>
+    std::pair<iterator, bool> emplace_impl(KeyArg &&key, Args &&...args) {
+        const size_t h = hash_of(key);
+        size_t i = find_in(cur_, key, h);
+        if (i != npos) return {iterator(this, 0, i), false};
+        if (migrating()) {
+            i = find_in(old_, key, h);
+            if (i != npos) return {iterator(this, 1, i), false};
+        }
+        if (cur_.groups == 0) start_resize(1);
+        i = find_slot(cur_, h);
+        if (cur_.ctrl[i] == kEmpty && cur_.used >= cur_.limit) {
+            grow();
+            i = find_slot(cur_, h);
+        }
+        new (&cur_.slots[i]) value_type(std::piecewise_construct,
+                                         std::forward_as_tuple(std::forward<KeyArg>(key)),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+        place(&cur_, i, h);
+        if (migrating()) migrate(kMigrateGroups);
+        // 迁移只会把元素搬进当前表的其它槽，i 不变
+        return {iterator(this, 0, i), true};
+    }
+
+    /// 槽 i 已经构造好元素，更新控制字节与计数
+    static void place(table *t, size_t i, size_t h) {
+        if (t->ctrl[i] == kEmpty) t->used++;
+        t->ctrl[i] = h2(h);
+        t->size++;
+    }
+
+    template <typename Q>
+    size_t erase_impl(const Q &key) {
+        const size_t h = hash_of(key);
+        size_t i = find_in(cur_, key, h);
+        if (i != npos) {
+            erase_slot(0, i);
+            return 1;
+        }
+        if (migrating()) {
+            i = find_in(old_, key, h);
+            if (i != npos) {
+                erase_slot(1, i);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    void erase_slot(int which, size_t i) {
+        table &t = table_at(which);
+        t.slots[i].~value_type();
+        t.size--;
+        // 组内还有空位时，任何查找到这个组都会停下，没有探测链会经过这里，可以直接标成空位。
+        // 旧表总是留墓碑：迁移会把元素标成墓碑，这里保持一致
+        const size_t g = i / kGroupWidth;
+        if (which == 0 && group(t.ctrl + g * kGroupWidth).match_empty()) {
+            t.ctrl[i] = kEmpty;
+            t.used--;
+        } else {
+            t.ctrl[i] = kDeleted;
+        }
+    }
+
+    /// 当前表达到负载上限：墓碑很多时原地重建，否则组数翻倍
+    void grow() {
+        finish_migration();
+        start_resize(cur_.size * 2 <= cur_.limit ? cur_.groups : cur_.groups * 2);
+        if (!incremental_) finish_migration();
+    }
+
+    /// 分配新的当前表，原来的当前表变成待迁移的旧表
+    void start_resize(size_t groups) {
+        table t;
+        t.groups = groups;
+        t.ctrl = new int8_t[t.capacity()];
+        std::memset(t.ctrl, uint8_t(kEmpty), t.capacity());
+        t.slots = std::allocator<value_type>().allocate(t.capacity());
+        t.limit = limit_for(t.capacity());
+        old_ = cur_;
+        cur_ = t;
+        migrate_pos_ = 0;
+        if (old_.size == 0) destroy(&old_);
+    }
+
+    /**
+     * @brief 把旧表接下来的 n 个组搬到当前表
+     * @details 搬走的槽标成墓碑而不是空位，否则旧表中还没搬的元素的探测链会被截断
+     */
+    void migrate(size_t n) {
+        for (; n > 0 && migrate_pos_ < old_.groups; n--, migrate_pos_++) {
+            for (size_t i = migrate_pos_ * kGroupWidth; i < (migrate_pos_ + 1) * kGroupWidth; i++) {
+                if (old_.ctrl[i] < 0) continue;
+                const size_t h = hash_of(old_.slots[i].first);
+                const size_t j = find_slot(cur_, h);
+                new (&cur_.slots[j]) value_type(std::move(old_.slots[i]));
+                place(&cur_, j, h);
+                old_.slots[i].~value_type();
+                old_.ctrl[i] = kDeleted;
+                old_.size--;
+            }
+        }
+        if (migrate_pos_ == old_.groups || old_.size == 0) destroy(&old_);
+    }
+
+    void finish_migration() {
+        if (migrating()) migrate(old_.groups);
+    }
+
+    /// 析构所有元素并释放一张表
+    void destroy(table *t) {
+        if (t->groups == 0) return;
+        for (size_t i = 0; i < t->capacity(); i++) {
+            if (t->ctrl[i] >= 0) t->slots[i].~value_type();
+        }
+        std::allocator<value_type>().deallocate(t->slots, t->capacity());
+        delete[] t->ctrl;
+        *t = table();
+    }
+
+    static constexpr size_t npos = size_t(-1);
+
+    table cur_;                 ///< 当前表：新元素都插到这里
+    table old_;                 ///< 渐进式扩容中尚未迁移完的旧表（groups 为 0 表示没有）
+    size_t migrate_pos_ = 0;    ///< 旧表中下一个要迁移的组
+    Hash hash_;                 ///< 哈希函数
+    KeyEqual equal_;            ///< 键的相等比较
+    float max_load_ = 0.875f;   ///< 最大负载因子
+    bool incremental_ = true;   ///< 是否渐进式扩容
+};
+}  // namespace swiss_table
+/**
+ * @}
+ */
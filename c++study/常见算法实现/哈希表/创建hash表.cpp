@@ -3,6 +3,8 @@
  * @author [vasutomar](https://github.com/vasutomar)
  * @author [Krishna Vedala](https://github.com/kvedala)
  * @brief 实现 [哈希链](https://en.wikipedia.org/wiki/Hash_chain)。
+ * @note 单线程实现。多个读线程与写线程共用一张表时见 `concurrent_hash_map.h`
+ * （分片锁、无锁读、基于纪元的回收与节点池）。
  */
 
 #include <cmath>
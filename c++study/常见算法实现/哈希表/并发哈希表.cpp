@@ -0,0 +1,299 @@
+/**
+ * @file
+ * @brief 并发哈希表 `concurrent_hash::concurrent_map` 的测试与多线程吞吐量基准测试
+ * @details 数据结构本身见 `concurrent_hash_map.h`。
+ *
+ * 用法：`./a.out [键数] [每组毫秒数]`，默认 10 万个键、每组 300 毫秒。
+ * 基准测试在若干读线程与写线程同时运行时统计每秒完成的操作数，
+ * 与 `std::unordered_map` 加 `std::shared_mutex` 读写锁、加 `std::mutex` 互斥锁两种做法比较。
+ */
+#include <algorithm>      /// 用于 std::max
+#include <atomic>         /// 用于 std::atomic
+#include <cassert>        /// 用于 assert
+#include <chrono>         /// 用于基准测试计时
+#include <cstdint>        /// 用于 uint64_t
+#include <cstdlib>        /// 用于 std::strtoull
+#include <iostream>       /// 用于输入输出操作
+#include <mutex>          /// 用于 std::mutex
+#include <optional>       /// 用于 std::optional
+#include <random>         /// 用于 std::mt19937_64
+#include <shared_mutex>   /// 用于 std::shared_mutex
+#include <stdexcept>      /// 用于 std::invalid_argument
+#include <string>         /// 用于 std::string
+#include <thread>         /// 用于 std::thread
+#include <type_traits>    /// 用于 std::is_same_v
+#include <unordered_map>  /// 用于 std::unordered_map
+#include <utility>        /// 用于 std::pair
+#include <vector>         /// 用于 std::vector
+
+#include "./concurrent_hash_map.h"
+
+using concurrent_hash::concurrent_map;
+
+/**
+ * @brief 值里带上键，读者据此检查读到的节点是否完整
+ */
+static std::string value_of(int key, int version) {
+    return std::to_string(key) + ":" + std::to_string(version) + ":padding-to-defeat-sso";
+}
+
+static bool belongs_to(const std::string &value, int key) {
+    const std::string prefix = std::to_string(key) + ":";
+    return value.compare(0, prefix.size(), prefix) == 0;
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(22);
+
+    // 第1个测试：基本操作
+    concurrent_map<std::string, int> map(5);
+    assert(map.shard_count() == 8 && map.size() == 0 && !map.find("a"));
+    assert(map.insert("one", 1) && map.insert("two", 2) && !map.insert("one", 100));
+    assert(*map.find("one") == 1 && map.contains("two") && !map.contains("three"));
+    assert(!map.insert_or_assign("one", 11) && map.insert_or_assign("three", 3));
+    int seen = 0;
+    assert(map.visit("one", [&](const int &v) { seen = v; }) && seen == 11);
+    assert(map.erase("two") && !map.erase("two") && !map.contains("two") && map.size() == 2);
+    bool thrown = false;
+    try {
+        concurrent_map<int, int> bad(0);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：单线程随机操作与 std::unordered_map 比较（分片少、初始桶少，反复扩容）
+    for (size_t shards : {1, 4, 64}) {
+        concurrent_map<int, std::string> m(shards);
+        std::unordered_map<int, std::string> expected;
+        for (int op = 0; op < 60000; op++) {
+            int key = int(rng() % 5000);
+            switch (rng() % 4) {
+                case 0: {
+                    std::string v = value_of(key, op);
+                    assert(m.insert(key, v) == expected.emplace(key, v).second);
+                    break;
+                }
+                case 1: {
+                    std::string v = value_of(key, op);
+                    assert(m.insert_or_assign(key, v) == !expected.count(key));
+                    expected[key] = v;
+                    break;
+                }
+                case 2:
+                    assert(m.erase(key) == (expected.erase(key) == 1));
+                    break;
+                default: {
+                    auto found = m.find(key);
+                    auto it = expected.find(key);
+                    assert(found.has_value() == (it != expected.end()));
+                    if (found) assert(*found == it->second);
+                }
+            }
+            assert(m.size() == expected.size());
+        }
+        for (const auto &kv : expected) assert(*m.find(kv.first) == kv.second);
+    }
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：节点池复用回收的节点，反复覆盖、插入删除和扩容都不会让分配的槽数远超元素个数
+    concurrent_map<int, int> reuse(4);
+    for (int i = 0; i < 1000; i++) reuse.insert(i, i);
+    const size_t before = reuse.pooled_nodes();
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 1000; i++) reuse.insert_or_assign(i, round);
+    }
+    assert(reuse.pooled_nodes() == before && reuse.pending_reclaim() <= 2);
+    reuse.collect();
+    reuse.collect();
+    assert(reuse.pending_reclaim() == 0 && *reuse.find(999) == 199);
+    concurrent_map<int, int> churn(4);
+    size_t peak = 0;
+    for (int op = 0; op < 200000; op++) {
+        const int key = int(rng() % 5000);
+        if (rng() % 2) {
+            churn.insert_or_assign(key, op);
+        } else {
+            churn.erase(key);
+        }
+        peak = std::max(peak, churn.size());
+        assert(churn.pending_reclaim() <= 2);
+    }
+    // 每个分片的池按块翻倍增长，槽数不超过该分片元素个数峰值的两倍左右
+    assert(churn.pooled_nodes() <= 3 * peak);
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：多个读者与写者并发，读者读到的值必须完整且属于所查的键
+    const int kKeys = 4000, kWriters = 3, kReaders = 4, kRounds = 4;
+    concurrent_map<int, std::string> shared(16);
+    for (int k = 0; k < kKeys; k += 2) shared.insert(k, value_of(k, 0));
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < kReaders; r++) {
+        threads.emplace_back([&, r] {
+            std::mt19937_64 local(100 + r);
+            uint64_t done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                int key = int(local() % kKeys);
+                shared.visit(key, [&](const std::string &v) { assert(belongs_to(v, key)); });
+                if (auto v = shared.find(key)) assert(belongs_to(*v, key));
+                done++;
+            }
+            reads += done;
+        });
+    }
+    // 写者 w 只写 key % kWriters == w 的键：结束后每个键的状态是确定的
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; w++) {
+        writers.emplace_back([&, w] {
+            for (int round = 1; round <= kRounds; round++) {
+                for (int k = w; k < kKeys; k += kWriters) {
+                    if (k % 5 == round % 5) {
+                        shared.erase(k);
+                    } else {
+                        shared.insert_or_assign(k, value_of(k, round));
+                    }
+                }
+            }
+        });
+    }
+    for (auto &t : writers) t.join();
+    stop = true;
+    for (auto &t : threads) t.join();
+    size_t expected_size = 0;
+    for (int k = 0; k < kKeys; k++) {
+        auto v = shared.find(k);
+        if (k % 5 == kRounds % 5) {
+            assert(!v);
+        } else {
+            assert(v && *v == value_of(k, kRounds));
+            expected_size++;
+        }
+    }
+    assert(shared.size() == expected_size && reads.load() > 0);
+    shared.collect();
+    shared.collect();
+    assert(shared.pending_reclaim() == 0);
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief std::unordered_map 加一把锁；Lock 为 std::shared_mutex 时读者共享加锁
+ */
+template <typename Lock>
+class locked_map {
+ public:
+    std::optional<uint64_t> find(uint64_t key) const {
+        if constexpr (std::is_same_v<Lock, std::shared_mutex>) {
+            std::shared_lock<Lock> lock(mutex_);
+            return lookup(key);
+        } else {
+            std::lock_guard<Lock> lock(mutex_);
+            return lookup(key);
+        }
+    }
+
+    void insert_or_assign(uint64_t key, uint64_t value) {
+        std::lock_guard<Lock> lock(mutex_);
+        map_[key] = value;
+    }
+
+    void erase(uint64_t key) {
+        std::lock_guard<Lock> lock(mutex_);
+        map_.erase(key);
+    }
+
+ private:
+    std::optional<uint64_t> lookup(uint64_t key) const {
+        auto it = map_.find(key);
+        if (it == map_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    mutable Lock mutex_;
+    std::unordered_map<uint64_t, uint64_t> map_;
+};
+
+/**
+ * @brief 一组读写线程运行 ms 毫秒后的吞吐量（百万次/秒）
+ */
+struct throughput {
+    double reads, writes;
+};
+
+/**
+ * @brief 先放入 n 个键，然后 readers 个线程随机查找、writers 个线程随机覆盖或删除（9:1）
+ */
+template <typename Map>
+static throughput run(Map &map, size_t n, int readers, int writers, int ms) {
+    for (uint64_t k = 0; k < n; k++) map.insert_or_assign(k, k);
+    std::atomic<bool> start{false}, stop{false};
+    std::atomic<uint64_t> reads{0}, writes{0}, found{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers + writers; i++) {
+        const bool writer = i >= readers;
+        threads.emplace_back([&, i, writer] {
+            std::mt19937_64 rng(1000 + i);
+            uint64_t done = 0, hits = 0;
+            while (!start.load()) std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed)) {
+                // 每 64 次操作检查一次 stop，减少对同一缓存行的读取
+                for (int j = 0; j < 64; j++) {
+                    const uint64_t key = rng() % (n + n / 8);
+                    if (!writer) {
+                        hits += map.find(key).has_value();
+                    } else if (rng() % 10) {
+                        map.insert_or_assign(key, key + done);
+                    } else {
+                        map.erase(key);
+                    }
+                }
+                done += 64;
+            }
+            (writer ? writes : reads) += done;
+            found += hits;
+        });
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    start = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    stop = true;
+    for (auto &t : threads) t.join();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    assert(readers == 0 || found.load() > 0);
+    return {reads / s / 1e6, writes / s / 1e6};
+}
+
+static void benchmark(size_t n, int ms) {
+    std::cout << "\n基准测试: " << n << " 个键，每组 " << ms << " 毫秒，硬件线程数 "
+              << std::thread::hardware_concurrency() << "（读/写为百万次每秒）\n";
+    const std::pair<int, int> mixes[] = {{1, 0}, {4, 0}, {4, 1}, {8, 1}, {8, 2}, {2, 2}};
+    for (auto [readers, writers] : mixes) {
+        concurrent_map<uint64_t, uint64_t> sharded(64, n);
+        locked_map<std::shared_mutex> rw;
+        locked_map<std::mutex> exclusive;
+        throughput a = run(sharded, n, readers, writers, ms);
+        throughput b = run(rw, n, readers, writers, ms);
+        throughput c = run(exclusive, n, readers, writers, ms);
+        std::cout << readers << " 读 " << writers << " 写: concurrent_map " << a.reads << " / "
+                  << a.writes << "，shared_mutex " << b.reads << " / " << b.writes << "，mutex "
+                  << c.reads << " / " << c.writes << "\n";
+    }
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000,
+              argc > 2 ? int(std::strtoull(argv[2], nullptr, 10)) : 300);
+    return 0;
+}
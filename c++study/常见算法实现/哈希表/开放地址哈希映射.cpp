@@ -0,0 +1,339 @@
+/**
+ * @file
+ * @brief Swiss table 风格哈希表 `swiss_table::HashMap` 的测试与基准测试
+ * @details 数据结构本身见 `swiss_table.h`。
+ *
+ * 用法：`./a.out [键数]`，默认 100 万个键。
+ * 基准测试与 `std::unordered_map` 以及 `linear_probing.h`、`quadratic_probing.h`、
+ * `double_hashing.h` 三个探测演示比较（演示在每次探测时输出信息，计时期间把 std::cout 关掉）。
+ */
+#include <algorithm>      /// 用于 std::max, std::min
+#include <cassert>        /// 用于 assert
+#include <chrono>         /// 用于基准测试计时
+#include <cstdint>        /// 用于 uint32_t, uint64_t
+#include <cstdlib>        /// 用于 std::strtoull
+#include <iostream>       /// 用于输入输出操作
+#include <random>         /// 用于 std::mt19937_64
+#include <stdexcept>      /// 用于 std::out_of_range
+#include <string>         /// 用于 std::string
+#include <string_view>    /// 用于 std::string_view
+#include <unordered_map>  /// 用于 std::unordered_map
+#include <unordered_set>  /// 用于 std::unordered_set
+#include <vector>         /// 用于 std::vector
+
+#include "./double_hashing.h"
+#include "./linear_probing.h"
+#include "./quadratic_probing.h"
+#include "./swiss_table.h"
+
+using swiss_table::HashMap;
+
+/**
+ * @brief 所有键的哈希值都相同：每次查找都要走完整条探测链
+ */
+struct constant_hash {
+    size_t operator()(int) const { return 42; }
+};
+
+/**
+ * @brief 与 std::unordered_map 做随机的插入、删除、查找，并逐项核对
+ */
+template <typename Hash>
+static void compare_with_std(float max_load, bool incremental, int key_range, int ops,
+                             std::mt19937_64 &rng) {
+    HashMap<int, std::string, Hash> map;
+    map.max_load_factor(max_load);
+    map.incremental_resize(incremental);
+    std::unordered_map<int, std::string> expected;
+    for (int op = 0; op < ops; op++) {
+        int key = int(rng() % key_range) - key_range / 2;
+        switch (rng() % 4) {
+            case 0:
+            case 1: {
+                std::string value = std::to_string(key * 7);
+                auto result = map.try_emplace(key, value);
+                assert(result.second == expected.emplace(key, value).second);
+                assert(result.first->first == key && result.first->second == value);
+                break;
+            }
+            case 2:
+                assert(map.erase(key) == expected.erase(key));
+                break;
+            default: {
+                auto it = map.find(key);
+                auto jt = expected.find(key);
+                assert((it == map.end()) == (jt == expected.end()));
+                if (jt != expected.end()) assert(it->second == jt->second);
+            }
+        }
+        assert(map.size() == expected.size());
+    }
+    // 迭代恰好覆盖每个元素一次（迁移期间跨两张表）
+    std::unordered_set<int> seen;
+    for (const auto &kv : map) {
+        assert(seen.insert(kv.first).second);
+        assert(expected.at(kv.first) == kv.second);
+    }
+    assert(seen.size() == expected.size());
+}
+
+/**
+ * @brief 自我测试函数
+ * @returns void
+ */
+static void tests() {
+    std::mt19937_64 rng(21);
+
+    // 第1个测试：基本操作
+    HashMap<std::string, int> map;
+    assert(map.empty() && map.find("a") == map.end() && map.begin() == map.end());
+    map["one"] = 1;
+    map["two"] = 2;
+    assert(map.insert({"three", 3}).second);
+    assert(!map.insert({"one", 100}).second && map.at("one") == 1);
+    map.insert_or_assign("one", 11);
+    assert(map.size() == 3 && map.at("one") == 11 && map.count("two") == 1);
+    bool thrown = false;
+    try {
+        map.at("four");
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(map.erase("two") == 1 && map.erase("two") == 0 && !map.contains("two"));
+    map.erase(map.find("three"));
+    assert(map.size() == 1 && map.begin()->first == "one");
+    HashMap<std::string, int> copy = map, moved = std::move(copy);
+    assert(moved.size() == 1 && moved.at("one") == 11);
+    map.clear();
+    assert(map.empty() && map.begin() == map.end() && moved.size() == 1);
+    thrown = false;
+    try {
+        map.max_load_factor(1.0f);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "第1个测试: 通过！\n";
+
+    // 第2个测试：异构查找，不构造 std::string
+    HashMap<std::string, int, swiss_table::string_hash, std::equal_to<>> words;
+    for (int i = 0; i < 1000; i++) words.try_emplace("word" + std::to_string(i), i);
+    std::string_view probe = "word123";
+    assert(words.find(probe)->second == 123);
+    assert(words.contains("word999") && !words.contains(std::string_view("word1000")));
+    assert(words.count(probe) == 1 && words.erase(probe) == 1 && !words.contains(probe));
+    std::cout << "第2个测试: 通过！\n";
+
+    // 第3个测试：随机操作与 std::unordered_map 比较（不同负载因子、一次性/渐进式扩容、退化的哈希）
+    for (float max_load : {1.0f / 16, 0.5f, 0.875f, 15.0f / 16}) {
+        for (bool incremental : {false, true}) {
+            compare_with_std<std::hash<int>>(max_load, incremental, 5000, 40000, rng);
+            compare_with_std<std::hash<int>>(max_load, incremental, 200, 5000, rng);
+            compare_with_std<constant_hash>(max_load, incremental, 300, 3000, rng);
+        }
+    }
+    std::cout << "第3个测试: 通过！\n";
+
+    // 第4个测试：渐进式扩容期间的查找、删除与迭代
+    HashMap<int, int> growing;
+    bool saw_migration = false;
+    for (int i = 0; i < 100000; i++) {
+        growing[i] = -i;
+        if (growing.migrating()) {
+            saw_migration = true;
+            assert(growing.at(i / 2) == -(i / 2));
+        }
+    }
+    assert(saw_migration && growing.size() == 100000);
+    for (int i = 0; i < 100000; i += 3) growing.erase(i);
+    size_t visited = 0;
+    for (auto it = growing.begin(); it != growing.end(); ++it) {
+        assert(it->first % 3 != 0 && it->second == -it->first);
+        visited++;
+    }
+    assert(visited == growing.size());
+    growing.reserve(1 << 20);
+    assert(!growing.migrating() && growing.capacity() >= (1 << 20) && growing.at(1) == -1);
+    std::cout << "第4个测试: 通过！\n";
+}
+
+/**
+ * @brief 计时辅助：返回每次操作的纳秒数
+ */
+template <typename F>
+static double ns_per_op(size_t ops, F &&f) {
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(ops);
+}
+
+/**
+ * @brief 一组操作的耗时（ns/次）
+ */
+struct timings {
+    double insert, hit, miss, erase;
+    size_t found;
+};
+
+/**
+ * @brief 插入 n 个键、命中查找、未命中查找、删除一半
+ */
+template <typename Insert, typename Find, typename Erase>
+static timings run(const std::vector<int> &keys, const std::vector<int> &misses, Insert insert,
+                   Find find, Erase erase) {
+    const size_t n = keys.size();
+    timings t{};
+    t.insert = ns_per_op(n, [&] {
+        for (int k : keys) insert(k);
+    });
+    t.hit = ns_per_op(n, [&] {
+        for (int k : keys) t.found += find(k);
+    });
+    t.miss = ns_per_op(n, [&] {
+        for (int k : misses) t.found += find(k);
+    });
+    t.erase = ns_per_op(n / 2, [&] {
+        for (size_t i = 0; i < n / 2; i++) erase(keys[i]);
+    });
+    return t;
+}
+
+static void report(const char *name, const timings &t) {
+    std::cout << name << ": 插入 " << t.insert << "，命中 " << t.hit << "，未命中 " << t.miss
+              << "，删除 " << t.erase << " ns/次（命中 " << t.found << " 次）\n";
+}
+
+/**
+ * @brief 探测演示：把全局表重置为 16 个槽，计时期间关掉 std::cout
+ * @note 演示的 notPresent（0）同时也是槽号 0，放在槽 0 的键查找时会被当成未找到
+ */
+template <typename Entry, typename... Ops>
+static timings run_prober(std::vector<Entry> &table, int &total_size, int &size,
+                          const std::vector<int> &keys, const std::vector<int> &misses,
+                          Ops... ops) {
+    total_size = 16;
+    size = 0;
+    table = std::vector<Entry>(total_size);
+    auto *saved = std::cout.rdbuf(nullptr);
+    timings t = run(keys, misses, ops...);
+    std::cout.rdbuf(saved);
+    std::cout.clear();
+    return t;
+}
+
+/**
+ * @brief 单次插入的最长耗时：一次性扩容时等于一次完整的重新哈希。
+ * 单核机器上偶尔的调度停顿也会计入，所以运行 3 次取最小的最大值
+ */
+static double worst_insert_us(const std::vector<int> &keys, bool incremental) {
+    double best = 1e300;
+    for (int round = 0; round < 3; round++) {
+        HashMap<int, int> map;
+        map.incremental_resize(incremental);
+        double worst = 0;
+        for (int k : keys) {
+            auto t0 = std::chrono::steady_clock::now();
+            map[k] = k;
+            auto t1 = std::chrono::steady_clock::now();
+            worst = std::max(worst, std::chrono::duration<double, std::micro>(t1 - t0).count());
+        }
+        best = std::min(best, worst);
+    }
+    return best;
+}
+
+static void benchmark(size_t n) {
+    std::mt19937_64 rng(2121);
+    // 键取 [1, 2^30)：探测演示把 0 当作空位、-1 当作墓碑，并用 int 计算 hash + i
+    std::unordered_set<int> distinct;
+    std::vector<int> keys, misses;
+    while (keys.size() < n) {
+        int k = int(1 + rng() % 0x3FFFFFFF);
+        if (distinct.insert(k).second) keys.push_back(k);
+    }
+    while (misses.size() < n) {
+        int k = int(1 + rng() % 0x3FFFFFFF);
+        if (!distinct.count(k)) misses.push_back(k);
+    }
+    std::cout << "\n基准测试（" << n << " 个随机 int 键）\n";
+
+    {
+        HashMap<int, int> map;
+        report("swiss_table::HashMap（渐进式扩容）",
+               run(keys, misses, [&](int k) { map[k] = k; },
+                   [&](int k) { return map.find(k) != map.end(); }, [&](int k) { map.erase(k); }));
+    }
+    {
+        HashMap<int, int> map;
+        map.incremental_resize(false);
+        report("swiss_table::HashMap（一次性扩容）",
+               run(keys, misses, [&](int k) { map[k] = k; },
+                   [&](int k) { return map.find(k) != map.end(); }, [&](int k) { map.erase(k); }));
+    }
+    {
+        std::unordered_map<int, int> map;
+        report("std::unordered_map",
+               run(keys, misses, [&](int k) { map[k] = k; },
+                   [&](int k) { return map.find(k) != map.end(); }, [&](int k) { map.erase(k); }));
+    }
+    {
+        namespace lp = linear_probing;
+        report("linear_probing（线性探测演示）",
+               run_prober(lp::table, lp::totalSize, lp::size, keys, misses,
+                          [](int k) { lp::add(k); },
+                          [](int k) { return lp::linearProbe(k, true) != lp::notPresent; },
+                          [](int k) { lp::remove(k); }));
+    }
+    {
+        namespace qp = quadratic_probing;
+        report("quadratic_probing（二次探测演示）",
+               run_prober(qp::table, qp::totalSize, qp::size, keys, misses,
+                          [](int k) { qp::add(k); },
+                          [](int k) { return qp::quadraticProbe(k, true) != qp::notPresent; },
+                          [](int k) { qp::remove(k); }));
+    }
+    {
+        namespace dh = double_hashing;
+        report("double_hashing（双重哈希演示）",
+               run_prober(dh::table, dh::totalSize, dh::size, keys, misses,
+                          [](int k) { dh::add(k); },
+                          [](int k) { return dh::doubleHash(k, true) != dh::notPresent; },
+                          [](int k) { dh::remove(k); }));
+    }
+
+    std::cout << "单次插入最长耗时: 渐进式扩容 " << worst_insert_us(keys, true)
+              << " us，一次性扩容 " << worst_insert_us(keys, false) << " us\n";
+
+    // 字符串键：异构查找直接用 std::string_view，std::unordered_map 每次要构造 std::string
+    std::vector<std::string> words(n);
+    for (size_t i = 0; i < n; i++) words[i] = "key-" + std::to_string(keys[i]) + "-padding-to-defeat-sso";
+    std::vector<std::string_view> views(words.begin(), words.end());
+    HashMap<std::string, int, swiss_table::string_hash, std::equal_to<>> by_view;
+    std::unordered_map<std::string, int> by_string;
+    for (size_t i = 0; i < n; i++) {
+        by_view.try_emplace(words[i], int(i));
+        by_string.emplace(words[i], int(i));
+    }
+    size_t hits = 0;
+    double t_view = ns_per_op(n, [&] {
+        for (auto v : views) hits += by_view.contains(v);
+    });
+    double t_string = ns_per_op(n, [&] {
+        for (auto v : views) hits += by_string.count(std::string(v));
+    });
+    assert(hits == 2 * n);
+    std::cout << "string_view 查找字符串键: HashMap 异构查找 " << t_view
+              << " ns/次，std::unordered_map（构造 std::string）" << t_string << " ns/次\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000);
+    return 0;
+}
@@ -0,0 +1,299 @@
+/**
+ * @file
+ * @brief 非加密快速哈希 `fast_hash` 的测试、雪崩质量与吞吐量基准测试
+ * @details 哈希函数本身见 `fast_hash.h`。
+ *
+ * 用法：`./a.out [雪崩测试样本数]`，默认 20000。
+ * - 雪崩（SMHasher 的 Avalanche 测试）：随机取键，翻转每一个输入位，统计每个输出位翻转的概率，
+ *   输出与 50% 偏离最大的一格（偏差 = |2p - 1|）。理想的哈希只剩下采样噪声；
+ * - 吞吐量：不同长度的字节串与 64 位整数，单个调用与批量接口；
+ * - 作为 `swiss_table::HashMap` 的默认哈希时的字符串查找。
+ *
+ * 对比的是 `std::hash`、FNV-1a，以及布隆过滤器原来使用的 DJB2 与乘法哈希。
+ */
+#include <algorithm>      /// 用于 std::max
+#include <cassert>        /// 用于 assert
+#include <chrono>         /// 用于基准测试计时
+#include <cmath>          /// 用于 std::sqrt, std::abs
+#include <cstdint>        /// 用于 uint64_t
+#include <cstdlib>        /// 用于 std::strtoull
+#include <cstring>        /// 用于 std::memcpy
+#include <functional>     /// 用于 std::hash
+#include <iomanip>        /// 用于 std::setw
+#include <iostream>       /// 用于输入输出操作
+#include <random>         /// 用于 std::mt19937_64
+#include <string>         /// 用于 std::string
+#include <string_view>    /// 用于 std::string_view
+#include <unordered_set>  /// 用于 std::unordered_set
+#include <vector>         /// 用于 std::vector
+
+#include "./fast_hash.h"
+#include "./swiss_table.h"
+
+/// 64 位 FNV-1a
+static uint64_t fnv1a(std::string_view s) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/// DJB2（布隆过滤器 `hashDJB2` 的 64 位版本）
+static uint64_t djb2(std::string_view s) {
+    uint64_t h = 5381;
+    for (unsigned char c : s) h = (h << 5) + h + c;
+    return h;
+}
+
+/// Fibonacci 乘法哈希
+static uint64_t multiplicative(uint64_t x) { return x * 0x9e3779b97f4a7c15ULL; }
+
+/// 布隆过滤器 `hashInt_2` 使用的混合函数
+static uint64_t bloom_int_mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief 雪崩测试：返回所有 (输入位, 输出位) 中最大的偏差 |2p - 1|
+ * @param hash 接受 std::string_view 的哈希函数
+ * @param key_bytes 键长
+ * @param samples 随机键的个数
+ */
+template <typename F>
+static double worst_bias(F hash, size_t key_bytes, size_t samples, uint64_t seed = 1) {
+    std::mt19937_64 rng(seed);
+    const size_t in_bits = key_bytes * 8;
+    std::vector<uint32_t> flips(in_bits * 64, 0);
+    std::string key(key_bytes, '\0');
+    for (size_t s = 0; s < samples; s++) {
+        for (auto &c : key) c = char(rng());
+        const uint64_t h0 = hash(std::string_view(key));
+        for (size_t bit = 0; bit < in_bits; bit++) {
+            key[bit >> 3] ^= char(1 << (bit & 7));
+            uint64_t diff = h0 ^ hash(std::string_view(key));
+            key[bit >> 3] ^= char(1 << (bit & 7));
+            uint32_t *row = &flips[bit * 64];
+            for (int out = 0; out < 64; out++, diff >>= 1) row[out] += uint32_t(diff & 1);
+        }
+    }
+    double worst = 0;
+    for (uint32_t f : flips) worst = std::max(worst, std::abs(2.0 * f / double(samples) - 1.0));
+    return worst;
+}
+
+/// 把 8 字节的键当作 64 位整数
+template <typename F>
+static auto as_u64(F hash) {
+    return [hash](std::string_view s) {
+        uint64_t x;
+        std::memcpy(&x, s.data(), 8);
+        return uint64_t(hash(x));
+    };
+}
+
+/**
+ * @brief 测试
+ */
+static void tests() {
+    using fast_hash::hash_bytes;
+    using fast_hash::hash_u64;
+
+    // 1. 确定性、种子、透明的字符串哈希
+    const std::string s = "the quick brown fox";
+    assert(hash_bytes(s) == hash_bytes(s.data(), s.size()));
+    assert(hash_bytes(s, 1) != hash_bytes(s, 2));
+    assert(hash_u64(42, 1) != hash_u64(42, 2));
+    fast_hash::hasher<std::string> hs(7);
+    fast_hash::hasher<std::string_view> hv(7);
+    assert(hs(s) == hv(std::string_view(s)));
+    assert(hs(s) == fast_hash::string_hasher(7)("the quick brown fox"));
+    assert(fast_hash::hasher<int>()(5) == size_t(hash_u64(5)));
+    assert(fast_hash::hasher<unsigned long>(3)(5) == size_t(hash_u64(5, 3)));
+    int x = 0;
+    assert(fast_hash::hasher<int *>()(&x) == size_t(hash_u64(uint64_t(reinterpret_cast<uintptr_t>(&x)))));
+    assert(fast_hash::hasher<double>()(1.5) == size_t(hash_u64(std::hash<double>{}(1.5))));
+    // 任何种子下哈希值都不是常数，包括使 seed ^ kSecret[1] 为 0 的种子
+    for (uint64_t seed : {uint64_t(0), fast_hash::kSecret[0], fast_hash::kSecret[1], ~uint64_t(0)}) {
+        std::unordered_set<uint64_t> values;
+        for (uint64_t k = 0; k < 1000; k++) values.insert(hash_u64(k, seed));
+        assert(values.size() == 1000);
+    }
+    std::cout << "第1个测试: 通过！\n";
+
+    // 2. 没有 128 位整数时的乘法与 __int128 一致
+    std::mt19937_64 rng(25);
+    for (int i = 0; i < 100000; i++) {
+        uint64_t a = rng(), b = rng();
+        if (i < 4) a = b = ~uint64_t(0) >> i;
+        uint64_t c = a, d = b;
+        fast_hash::multiply(a, b);
+        fast_hash::detail::multiply_portable(c, d);
+        assert(a == c && b == d);
+    }
+    std::cout << "第2个测试: 通过！\n";
+
+    // 3. 批量接口与逐个调用一致（覆盖每一种长度分支）
+    std::vector<std::string> strings;
+    for (size_t n = 0; n <= 300; n++) {
+        std::string t(n, '\0');
+        for (auto &c : t) c = char(rng());
+        strings.push_back(t);
+    }
+    std::vector<std::string_view> views(strings.begin(), strings.end());
+    std::vector<uint64_t> out(views.size());
+    fast_hash::hash_many(views.data(), views.size(), out.data(), 99);
+    for (size_t i = 0; i < views.size(); i++) assert(out[i] == hash_bytes(views[i], 99));
+    std::vector<uint64_t> ints(1000);
+    for (auto &v : ints) v = rng();
+    out.resize(ints.size());
+    fast_hash::hash_many(ints.data(), ints.size(), out.data(), 5);
+    for (size_t i = 0; i < ints.size(); i++) assert(out[i] == hash_u64(ints[i], 5));
+    std::cout << "第3个测试: 通过！\n";
+
+    // 4. 没有 64 位碰撞：全零串的每个长度、连续整数、随机短串
+    std::unordered_set<uint64_t> seen;
+    const std::string zeros(1000, '\0');
+    for (size_t n = 0; n <= zeros.size(); n++) assert(seen.insert(hash_bytes(zeros.data(), n)).second);
+    seen.clear();
+    for (uint64_t i = 0; i < 200000; i++) assert(seen.insert(hash_u64(i)).second);
+    seen.clear();
+    std::unordered_set<std::string> keys;
+    while (keys.size() < 100000) {
+        std::string t(rng() % 24, '\0');
+        for (auto &c : t) c = char('a' + rng() % 26);
+        if (keys.insert(t).second) assert(seen.insert(hash_bytes(t)).second);
+    }
+    std::cout << "第4个测试: 通过！\n";
+
+    // 5. 雪崩：2000 个样本时的采样噪声约为 0.022（一个标准差），最大偏差应在 0.15 以内
+    // （1 字节的键只有 256 个，样本重复，噪声本身就超过这个界限，所以从 2 字节开始）
+    auto bytes = [](std::string_view k) { return hash_bytes(k); };
+    for (size_t n : {2, 3, 4, 8, 12, 16, 17, 40, 64}) assert(worst_bias(bytes, n, 2000) < 0.15);
+    assert(worst_bias(as_u64([](uint64_t v) { return hash_u64(v); }), 8, 2000) < 0.15);
+    // 对照：FNV-1a 的最后一个字节只经过一次乘法，高位影响不到低位
+    assert(worst_bias(fnv1a, 8, 2000) > 0.5);
+    std::cout << "第5个测试: 通过！\n";
+}
+
+/**
+ * @brief 雪崩质量表
+ */
+static void avalanche_benchmark(size_t samples) {
+    std::cout << "\n雪崩测试: 最大偏差（“噪声”是理想哈希在该样本数下的大致最大偏差，"
+              << "1.0 表示某个输出位完全不受某个输入位影响）\n"
+              << std::setprecision(3) << std::setw(10) << "键长" << std::setw(10) << "样本" << std::setw(10)
+              << "噪声" << std::setw(12) << "fast_hash" << std::setw(12) << "std::hash" << std::setw(12) << "FNV-1a"
+              << std::setw(12) << "DJB2\n";
+    auto fast = [](std::string_view k) { return fast_hash::hash_bytes(k); };
+    auto stdh = [](std::string_view k) { return uint64_t(std::hash<std::string_view>{}(k)); };
+    for (size_t n : {4, 8, 16, 32, 64}) {
+        // 长键每个样本的工作量与键长的平方成正比
+        const size_t m = n <= 16 ? samples : samples * 16 / n;
+        std::cout << std::setw(8) << n << std::setw(10) << m << std::setw(10) << 4.5 / std::sqrt(double(m))
+                  << std::setw(12) << worst_bias(fast, n, m) << std::setw(12)
+                  << worst_bias(stdh, n, m) << std::setw(12) << worst_bias(fnv1a, n, m) << std::setw(12)
+                  << worst_bias(djb2, n, m) << "\n";
+    }
+    std::cout << "64 位整数: hash_u64 " << worst_bias(as_u64([](uint64_t v) { return fast_hash::hash_u64(v); }), 8, samples)
+              << "，std::hash " << worst_bias(as_u64([](uint64_t v) { return uint64_t(std::hash<uint64_t>{}(v)); }), 8, samples)
+              << "，乘法哈希 " << worst_bias(as_u64(multiplicative), 8, samples) << "，布隆过滤器 hashInt_2 "
+              << worst_bias(as_u64(bloom_int_mix), 8, samples) << "\n";
+}
+
+/// 每秒处理的字节数（GB/s）：每轮调用一次 run，总共处理约 64 MiB
+template <typename F>
+static double gbps(F run, size_t bytes) {
+    const int rounds = int(std::max<size_t>(1, (size_t(64) << 20) / bytes));
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) run();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return double(bytes) * rounds / s / 1e9;
+}
+
+/**
+ * @brief 吞吐量
+ */
+static void throughput_benchmark() {
+    std::mt19937_64 rng(1);
+    uint64_t sink = 0;
+    std::cout << "\n吞吐量（GB/s）\n"
+              << std::setw(10) << "键长" << std::setw(12) << "fast_hash" << std::setw(12) << "批量" << std::setw(12)
+              << "std::hash" << std::setw(12) << "FNV-1a\n";
+    for (size_t n : {8, 16, 32, 64, 256, 1024, 65536}) {
+        const size_t count = std::max<size_t>(1, 4096 / n * 16);
+        std::string buffer(n * count, '\0');
+        for (auto &c : buffer) c = char(rng());
+        std::vector<std::string_view> keys;
+        for (size_t i = 0; i < count; i++) keys.emplace_back(buffer.data() + i * n, n);
+        std::vector<uint64_t> out(count);
+        const size_t bytes = buffer.size();
+        auto each = [&](auto hash) {
+            return [&, hash] {
+                for (auto k : keys) sink += hash(k);
+            };
+        };
+        double fast = gbps(each([](std::string_view k) { return fast_hash::hash_bytes(k); }), bytes);
+        double bulk = gbps(
+            [&] {
+                fast_hash::hash_many(keys.data(), count, out.data());
+                sink += out[0];
+            },
+            bytes);
+        double stdh = gbps(each([](std::string_view k) { return uint64_t(std::hash<std::string_view>{}(k)); }), bytes);
+        double fnv = gbps(each(fnv1a), bytes);
+        std::cout << std::setw(8) << n << std::setw(12) << fast << std::setw(12) << bulk << std::setw(12) << stdh
+                  << std::setw(12) << fnv << "\n";
+    }
+
+    // 64 位整数：单个调用与批量
+    std::vector<uint64_t> ints(1 << 16), out(ints.size());
+    for (auto &v : ints) v = rng();
+    const int rounds = 200;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (auto v : ints) sink += fast_hash::hash_u64(v, uint64_t(r));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        fast_hash::hash_many(ints.data(), ints.size(), out.data(), uint64_t(r));
+        sink += out[r];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    const double total = double(ints.size()) * rounds;
+    std::cout << "64 位整数: hash_u64 " << std::chrono::duration<double, std::nano>(t1 - t0).count() / total
+              << " ns/个，hash_many " << std::chrono::duration<double, std::nano>(t2 - t1).count() / total
+              << " ns/个\n";
+
+    // HashMap<std::string, int> 的查找：默认的 fast_hash::hasher 与 std::hash
+    std::vector<std::string> words;
+    for (int i = 0; i < 200000; i++) words.push_back("user:" + std::to_string(rng()) + "/profile");
+    auto lookups = [&](auto &map) {
+        for (size_t i = 0; i < words.size(); i++) map.insert_or_assign(words[i], int(i));
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < 5; r++) {
+            for (const auto &w : words) sink += uint64_t(map.find(w)->second);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+               (5.0 * double(words.size()));
+    };
+    swiss_table::HashMap<std::string, int> with_fast;
+    swiss_table::HashMap<std::string, int, std::hash<std::string>> with_std;
+    std::cout << "HashMap<std::string, int> 查找: fast_hash " << lookups(with_fast) << " ns/次，std::hash "
+              << lookups(with_std) << " ns/次\n";
+    std::cout << "(校验和 " << sink << ")\n";
+}
+
+/**
+ * @brief 主函数
+ * @returns 0 表示退出
+ */
+int main(int argc, char **argv) {
+    tests();
+    avalanche_benchmark(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000);
+    throughput_benchmark();
+    return 0;
+}
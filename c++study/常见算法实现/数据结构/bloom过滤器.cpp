@@ -16,6 +16,8 @@
  *
  * 基本布隆过滤器不支持删除元素，因此在我们的情况下
  * 不需要实现布隆过滤器和位集合的删除功能。
+ *
+ * 不指定哈希函数时，使用 `fast_hash.h` 中以 0, 1, ..., k-1 为种子的 k 个 `fast_hash::hasher<T>`。
  * @author [DanArmor](https://github.com/DanArmor)
  */
 
@@ -26,6 +28,8 @@
 #include <vector>            /// 用于 std::vector
 #include <iostream>          /// 用于 IO 操作
 
+#include "../哈希表/fast_hash.h"
+
 /**
  * @namespace data_structures
  * @brief 数据结构算法
@@ -101,6 +105,7 @@ class BloomFilter {
  public:
     BloomFilter(std::size_t,
                 std::initializer_list<std::function<std::size_t(T)>>);
+    explicit BloomFilter(std::size_t, std::size_t = 2);
     void add(T);
     bool contains(T);
 };
@@ -119,6 +124,22 @@ BloomFilter<T>::BloomFilter(
     std::initializer_list<std::function<std::size_t(T)>> funks)
     : set(size), hashFunks(funks) {}
 
+/**
+ * @brief 使用默认哈希函数的布隆过滤器构造函数
+ *
+ * @tparam T 需要过滤的元素类型
+ * @param size 布隆过滤器的初始大小
+ * @param hashCount 哈希函数的个数，第 i 个是以 i 为种子的 `fast_hash::hasher<T>`
+ * @returns none
+ */
+template <typename T>
+BloomFilter<T>::BloomFilter(std::size_t size, std::size_t hashCount)
+    : set(size) {
+    for (std::size_t i = 0; i < hashCount; i++) {
+        hashFunks.emplace_back(fast_hash::hasher<T>(i));
+    }
+}
+
 /**
  * @brief 布隆过滤器的添加函数
  *
@@ -252,6 +273,34 @@ static void test_bloom_filter_int() {
     }
 }
 
+/**
+ * @brief 测试使用默认哈希函数的布隆过滤器：不漏报，误报率接近理论值
+ * @returns void
+ */
+static void test_bloom_filter_default() {
+    // 1000 个块（每块 8 位），4 个哈希函数，500 个元素：理论误报率约 (1 - e^(-4*500/8000))^4 ≈ 0.24%
+    data_structures::BloomFilter<std::string> filter(1000, 4);
+    for (int i = 0; i < 500; i++) {
+        filter.add("key" + std::to_string(i));
+    }
+    for (int i = 0; i < 500; i++) {
+        assert(filter.contains("key" + std::to_string(i)));
+    }
+    int falsePositives = 0;
+    for (int i = 500; i < 10500; i++) {
+        falsePositives += filter.contains("key" + std::to_string(i));
+    }
+    assert(falsePositives < 100);  // 小于 1%
+
+    data_structures::BloomFilter<int> ints(20);
+    for (int x : {100, 200, 300, 50}) {
+        ints.add(x);
+    }
+    for (int x : {100, 200, 300, 50}) {
+        assert(ints.contains(x));
+    }
+}
+
 /**
  * @brief 测试位集合
  *
@@ -278,6 +327,7 @@ int main() {
     test_bitset();  // 运行位集合的测试，因为布隆过滤器依赖于它
     test_bloom_filter_string();
     test_bloom_filter_int();
+    test_bloom_filter_default();
     
     std::cout << "所有测试均已成功通过！\n";
     return 0;
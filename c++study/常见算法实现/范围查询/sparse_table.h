@@ -0,0 +1,158 @@
+/**
+ * @file sparse_table.h
+ * @brief [Sparse Table](https://en.wikipedia.org/wiki/Range_minimum_query) 区间最小值查询
+ * （`range_queries::sparse_table`）
+ * @details 从 `Sparse Table.cpp` 中拆出，供其它模块（例如 `string/suffix_array.h`）包含使用。
+ *
+ * Sparse Table 是一种可以快速回答区间查询的数据结构，特别适用于求区间最小值或最大值。
+ * 对于区间最小值（或等效的区间最大值）查询，它可以在 O(1) 时间内计算出答案。
+ *
+ * 原来的三个函数（`computeLogs`、`buildTable`、`getMinimum`）保留了接口，
+ * 修正了几处边界问题：日志表少了一项（`buildTable` 会读到 `logs[n]`）、
+ * 每一层的最后一个区间没有填、层数固定为 20（n 超过 2^20 时越界）。
+ * 新代码应使用 `range_min`：所有层放在一个连续数组里，层数按 n 计算，比较函数可以自定义。
+ *
+ * * 时间复杂度：
+ *   * 构建：O(NlogN)
+ *   * 区间查询：O(1)
+ */
+#pragma once
+
+#include <algorithm>   /// 用于 std::min
+#include <cstddef>     /// 用于 size_t
+#include <functional>  /// 用于 std::less
+#include <utility>     /// 用于 std::move
+#include <vector>      /// 用于 std::vector
+
+/**
+ * @namespace range_queries
+ * @brief 范围查询算法
+ */
+namespace range_queries {
+/**
+ * @namespace sparse_table
+ * @brief 使用 Sparse Table 进行范围查询
+ */
+namespace sparse_table {
+
+/**
+ * 该函数预计算了日志表，用于后续的计算。
+ * @param A 输入数组
+ * @return 返回相应的日志表，logs[i] = floor(log2(i))，共 A.size() + 1 项
+ */
+template <typename T>
+std::vector<T> computeLogs(const std::vector<T>& A) {
+    int n = A.size();
+    std::vector<T> logs(std::max(n + 1, 2));
+    logs[1] = 0;  // 初始化 logs[1] = 0
+    // 计算从 2 开始的每个数的 log 值
+    for (int i = 2; i <= n; i++) {
+        logs[i] = logs[i / 2] + 1;  // log(i) = log(i / 2) + 1
+    }
+    return logs;
+}
+
+/**
+ * 该函数构建了主数据结构 Sparse Table。
+ * @param A 输入数组
+ * @param logs 事先计算好的日志表
+ * @return 返回构建好的 Sparse Table 数据结构
+ */
+template <typename T>
+std::vector<std::vector<T> > buildTable(const std::vector<T>& A,
+                                        const std::vector<T>& logs) {
+    int n = A.size();
+    std::vector<std::vector<T> > table(logs[n] + 1, std::vector<T>(n + 5, 0));
+    int curLen = 0;
+    // 对于每个可能的区间长度 1, 2, 4, 8, ..., 进行处理
+    for (int i = 0; i <= logs[n]; i++) {
+        curLen = 1 << i;  // 当前长度是 2^i
+        for (int j = 0; j + curLen <= n; j++) {
+            if (curLen == 1) {
+                table[i][j] = A[j];  // 只有一个元素时，直接赋值
+            } else {
+                // 否则，取左半部分和右半部分的最小值
+                table[i][j] =
+                    std::min(table[i - 1][j], table[i - 1][j + curLen / 2]);
+            }
+        }
+    }
+    return table;
+}
+
+/**
+ * 该函数用于查询区间 [beg, end] 的最小值。
+ * @param beg 查询范围的起始索引
+ * @param end 查询范围的结束索引
+ * @param logs 事先计算好的日志表
+ * @param table Sparse Table 数据结构
+ * @return 返回区间 [beg, end] 的最小值
+ */
+template <typename T>
+T getMinimum(int beg, int end, const std::vector<T>& logs,
+             const std::vector<std::vector<T> >& table) {
+    int p = logs[end - beg + 1];  // 计算区间长度的日志值
+    int pLen = 1 << p;  // 计算区间长度的实际值
+    return std::min(table[p][beg], table[p][end - pLen + 1]);  // 返回最小值
+}
+
+/**
+ * @brief 区间最小值查询的 Sparse Table
+ * @details 第 k 层的第 j 项是区间 [j, j + 2^k) 的最小值，所有层依次放在 `table_` 中，
+ * 第 k 层从 `k * n` 开始。查询 [beg, end] 时取两段长度为 2^p、覆盖整个区间（可以重叠）的最小值。
+ * @tparam T 元素类型
+ * @tparam Compare 比较函数，用 `std::greater<T>` 即为区间最大值
+ */
+template <typename T, typename Compare = std::less<T>>
+class range_min {
+ public:
+    range_min() = default;
+
+    explicit range_min(std::vector<T> values, Compare comp = Compare())
+        : n_(values.size()), comp_(comp) {
+        size_t levels = 1;
+        while ((size_t(1) << levels) <= n_) levels++;
+        table_ = std::move(values);
+        table_.resize(levels * n_);
+        for (size_t k = 1; k < levels; k++) {
+            const T* prev = table_.data() + (k - 1) * n_;
+            T* cur = table_.data() + k * n_;
+            const size_t half = size_t(1) << (k - 1);
+            for (size_t j = 0; j + 2 * half <= n_; j++) {
+                cur[j] = pick(prev[j], prev[j + half]);
+            }
+        }
+    }
+
+    /**
+     * @brief 元素个数
+     */
+    size_t size() const { return n_; }
+
+    /**
+     * @brief 区间 [beg, end] 的最小值（两端都包含，要求 beg <= end < size()）
+     */
+    T query(size_t beg, size_t end) const {
+        const size_t p = floor_log2(end - beg + 1);
+        const T* level = table_.data() + p * n_;
+        return pick(level[beg], level[end + 1 - (size_t(1) << p)]);
+    }
+
+    /**
+     * @brief 占用的内存（字节）
+     */
+    size_t memory_bytes() const { return table_.capacity() * sizeof(T); }
+
+ private:
+    static size_t floor_log2(size_t x) {
+        return size_t(8 * sizeof(unsigned long long) - 1) - size_t(__builtin_clzll(x));
+    }
+
+    T pick(const T& a, const T& b) const { return comp_(b, a) ? b : a; }
+
+    size_t n_ = 0;          ///< 元素个数
+    Compare comp_{};        ///< 比较函数
+    std::vector<T> table_;  ///< 各层依次排列的表
+};
+}  // namespace sparse_table
+}  // namespace range_queries